@@ -35,6 +35,9 @@
 #include "log.h"
 #include "types.h"
 
+#ifdef FEATURE_PROFILING
+alarm_context_t *alarm_context_list = NULL;
+#endif
 
 alarm_context_t *alarm_context_new(const char *name)
 {
@@ -54,10 +57,29 @@ void alarm_context_init(alarm_context_t *context, const char *name)
 
     context->num_pending_alarms = 0;
     context->next_pending_alarm_clk = (CLOCK) ~0L;
+    context->next_pending_alarm_idx = -1;
+
+#ifdef FEATURE_PROFILING
+    context->next_context = alarm_context_list;
+    alarm_context_list = context;
+#endif
 }
 
 void alarm_context_destroy(alarm_context_t *context)
 {
+#ifdef FEATURE_PROFILING
+    {
+        alarm_context_t **cp;
+
+        for (cp = &alarm_context_list; *cp != NULL; cp = &(*cp)->next_context) {
+            if (*cp == context) {
+                *cp = context->next_context;
+                break;
+            }
+        }
+    }
+#endif
+
     lib_free(context->name);
 
     /* Destroy all the alarms.  */
@@ -85,6 +107,8 @@ void alarm_context_time_warp(alarm_context_t *context, CLOCK warp_amount,
         return;
     }
 
+    /* Shifting every pending alarm by the same amount keeps the heap
+       ordered.  */
     for (i = 0; i < context->num_pending_alarms; i++) {
         if (warp_direction > 0) {
             context->pending_alarms[i].clk += warp_amount;
@@ -112,6 +136,10 @@ static void alarm_init(alarm_t *alarm, alarm_context_t *context,
 
     alarm->pending_idx = -1;      /* Not pending.  */
 
+#ifdef FEATURE_PROFILING
+    alarm->dispatch_count = 0;
+#endif
+
     /* Add to the head of the alarm list of the alarm context.  */
     if (context->alarms == NULL) {
         context->alarms = alarm;
@@ -182,27 +210,29 @@ void alarm_unset(alarm_t *alarm)
         last = --context->num_pending_alarms;
 
         if (last != idx) {
-            /* Let's copy the struct by hand to make sure stupid compilers
-               don't do stupid things.  */
+            CLOCK clk;
+
+            /* Fill the hole with the last heap entry and restore the heap
+               order from there.  Let's copy the struct by hand to make sure
+               stupid compilers don't do stupid things.  */
+            clk = context->pending_alarms[idx].clk;
             context->pending_alarms[idx].alarm
                 = context->pending_alarms[last].alarm;
             context->pending_alarms[idx].clk
                 = context->pending_alarms[last].clk;
 
-            context->pending_alarms[idx].alarm->pending_idx = idx;
-        }
-
-        if (context->next_pending_alarm_idx == idx) {
-            alarm_context_update_next_pending(context);
-        } else if (context->next_pending_alarm_idx == last) {
-            context->next_pending_alarm_idx = idx;
+            if (context->pending_alarms[idx].clk < clk) {
+                alarm_context_sift_up(context, idx);
+            } else {
+                alarm_context_sift_down(context, idx);
+            }
         }
     } else {
         context->num_pending_alarms = 0;
-        context->next_pending_alarm_clk = (CLOCK) ~0L;
-        context->next_pending_alarm_idx = -1;
     }
 
+    alarm_context_update_next_pending(context);
+
     alarm->pending_idx = -1;
 }
 
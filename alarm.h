@@ -54,6 +54,11 @@ struct alarm_s {
 
     /* Link to the next and previous alarms in the list.  */
     struct alarm_s *next, *prev;
+
+#ifdef FEATURE_PROFILING
+    /* Number of times this alarm has been dispatched.  */
+    unsigned long dispatch_count;
+#endif
 };
 typedef struct alarm_s alarm_t;
 
@@ -74,19 +79,31 @@ struct alarm_context_s {
     /* Alarm list.  */
     struct alarm_s *alarms;
 
-    /* Pending alarm array.  Statically allocated because it's slightly
-       faster this way.  */
+    /* Pending alarm array, kept as a binary min-heap ordered by `clk' so
+       that the next alarm is always at index 0.  Statically allocated
+       because it's slightly faster this way.  */
     pending_alarms_t pending_alarms[ALARM_CONTEXT_MAX_PENDING_ALARMS];
     unsigned int num_pending_alarms;
 
     /* Clock tick for the next pending alarm.  */
     CLOCK next_pending_alarm_clk;
 
-    /* Pending alarm number.  */
+    /* Pending alarm number.  Always 0 (the heap root) while any alarm is
+       pending, -1 otherwise.  */
     int next_pending_alarm_idx;
+
+#ifdef FEATURE_PROFILING
+    /* Link to the next context in `alarm_context_list'.  */
+    struct alarm_context_s *next_context;
+#endif
 };
 typedef struct alarm_context_s alarm_context_t;
 
+#ifdef FEATURE_PROFILING
+/* All existing alarm contexts, for the profiler.  */
+extern alarm_context_t *alarm_context_list;
+#endif
+
 /* ------------------------------------------------------------------------ */
 
 extern alarm_context_t *alarm_context_new(const char *name);
@@ -109,38 +126,87 @@ inline static CLOCK alarm_context_next_pending_clk(alarm_context_t *context)
     return context->next_pending_alarm_clk;
 }
 
-inline static void alarm_context_update_next_pending(alarm_context_t *context)
+/* Move the pending alarm at `idx' towards the root of the heap until its
+   parent is not later than it.  */
+inline static void alarm_context_sift_up(alarm_context_t *context, int idx)
 {
-    CLOCK next_pending_alarm_clk = (CLOCK)~0L;
-    int next_pending_alarm_idx;
-    unsigned int i;
+    pending_alarms_t *heap = context->pending_alarms;
+    alarm_t *alarm = heap[idx].alarm;
+    CLOCK clk = heap[idx].clk;
 
-    next_pending_alarm_idx = context->next_pending_alarm_idx;
+    while (idx > 0) {
+        int parent = (idx - 1) >> 1;
 
-    for (i = 0; i < context->num_pending_alarms; i++) {
-        CLOCK pending_clk = context->pending_alarms[i].clk;
+        if (heap[parent].clk <= clk) {
+            break;
+        }
+        heap[idx].alarm = heap[parent].alarm;
+        heap[idx].clk = heap[parent].clk;
+        heap[idx].alarm->pending_idx = idx;
+        idx = parent;
+    }
+
+    heap[idx].alarm = alarm;
+    heap[idx].clk = clk;
+    alarm->pending_idx = idx;
+}
 
-        if (pending_clk <= next_pending_alarm_clk) {
-            next_pending_alarm_clk = pending_clk;
-            next_pending_alarm_idx = (int)i;
+/* Move the pending alarm at `idx' away from the root of the heap until
+   neither child is earlier than it.  */
+inline static void alarm_context_sift_down(alarm_context_t *context, int idx)
+{
+    pending_alarms_t *heap = context->pending_alarms;
+    int num = (int)(context->num_pending_alarms);
+    alarm_t *alarm = heap[idx].alarm;
+    CLOCK clk = heap[idx].clk;
+
+    while (1) {
+        int child = (idx << 1) + 1;
+
+        if (child >= num) {
+            break;
+        }
+        if (child + 1 < num && heap[child + 1].clk < heap[child].clk) {
+            child++;
         }
+        if (clk <= heap[child].clk) {
+            break;
+        }
+        heap[idx].alarm = heap[child].alarm;
+        heap[idx].clk = heap[child].clk;
+        heap[idx].alarm->pending_idx = idx;
+        idx = child;
     }
 
-    context->next_pending_alarm_clk = next_pending_alarm_clk;
-    context->next_pending_alarm_idx = next_pending_alarm_idx;
+    heap[idx].alarm = alarm;
+    heap[idx].clk = clk;
+    alarm->pending_idx = idx;
+}
+
+inline static void alarm_context_update_next_pending(alarm_context_t *context)
+{
+    if (context->num_pending_alarms > 0) {
+        context->next_pending_alarm_clk = context->pending_alarms[0].clk;
+        context->next_pending_alarm_idx = 0;
+    } else {
+        context->next_pending_alarm_clk = (CLOCK)~0L;
+        context->next_pending_alarm_idx = -1;
+    }
 }
 
 inline static void alarm_context_dispatch(alarm_context_t *context,
                                           CLOCK cpu_clk)
 {
     CLOCK offset;
-    int idx;
     alarm_t *alarm;
 
     offset = (CLOCK)(cpu_clk - context->next_pending_alarm_clk);
 
-    idx = context->next_pending_alarm_idx;
-    alarm = context->pending_alarms[idx].alarm;
+    alarm = context->pending_alarms[0].alarm;
+
+#ifdef FEATURE_PROFILING
+    alarm->dispatch_count++;
+#endif
 
     (alarm->callback)(offset, alarm->data);
 }
@@ -169,21 +235,23 @@ inline static void alarm_set(alarm_t *alarm, CLOCK cpu_clk)
 
         context->num_pending_alarms++;
 
-        if (cpu_clk < context->next_pending_alarm_clk) {
-            context->next_pending_alarm_clk = cpu_clk;
-            context->next_pending_alarm_idx = new_idx;
-        }
-
-        alarm->pending_idx = new_idx;
+        alarm_context_sift_up(context, new_idx);
     } else {
+        CLOCK old_clk;
+
         /* Already pending: modify.  */
 
+        old_clk = context->pending_alarms[idx].clk;
         context->pending_alarms[idx].clk = cpu_clk;
-        if (context->next_pending_alarm_clk > cpu_clk
-            || idx == context->next_pending_alarm_idx) {
-            alarm_context_update_next_pending(context);
+
+        if (cpu_clk < old_clk) {
+            alarm_context_sift_up(context, idx);
+        } else if (cpu_clk > old_clk) {
+            alarm_context_sift_down(context, idx);
         }
     }
+
+    alarm_context_update_next_pending(context);
 }
 
 #endif
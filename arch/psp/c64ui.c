@@ -33,6 +33,7 @@
 #include "lib/pl_ini.h"
 #include "lib/pl_util.h"
 #include "lib/pl_gfx.h"
+#include "lib/pl_rewind.h"
 #include "libmz/unzip.h"
 
 #include <stdio.h>
@@ -60,6 +61,10 @@
 #include "sound.h"
 #include "archdep.h"
 #include "c64cartsystem.h"
+#include "interrupt.h"
+#include "snapshot.h"
+#include "vsync.h"
+#include "network.h"
 
 #define TAB_QUICKLOAD 0
 #define TAB_STATE     1
@@ -82,6 +87,8 @@
 #define OPTION_REFRESH_RATE  0x0C
 #define OPTION_VSYNC         0x0D
 #define OPTION_PALETTE       0x0E
+#define OPTION_REWIND        0x0F
+#define OPTION_RUN_AHEAD     0x10
 
 #define SYSTEM_SCRNSHOT     0x11
 #define SYSTEM_RESET        0x12
@@ -96,6 +103,9 @@
 #define SYSTEM_TAPE         0x27
 #define SYSTEM_DRIVE8       0x28
 
+#define REWIND_CAPTURE_INTERVAL 5            /* frames between captures */
+#define REWIND_STATE_MAX_SIZE   (512 * 1024) /* uncompressed snapshot cap */
+
 #define GET_DRIVE(code) ((code)&0x0F)
 #define GET_DRIVE_MENU_ID(code) (((code)&0x0F)|0x20)
 
@@ -159,6 +169,11 @@ PL_MENU_OPTIONS_BEGIN(PaletteOptions)
   PL_MENU_OPTION("Pepto-PAL", PALETTE_PEPTO_PAL)
   PL_MENU_OPTION("Colodore", PALETTE_COLODORE)
 PL_MENU_OPTIONS_END
+PL_MENU_OPTIONS_BEGIN(RunAheadOptions)
+  PL_MENU_OPTION("Disabled", 0)
+  PL_MENU_OPTION("1 frame", 1)
+  PL_MENU_OPTION("2 frames", 2)
+PL_MENU_OPTIONS_END
 PL_MENU_OPTIONS_BEGIN(PspClockFreqOptions)
   PL_MENU_OPTION("222 MHz", 222)
   PL_MENU_OPTION("266 MHz", 266)
@@ -219,6 +234,7 @@ PL_MENU_OPTIONS_BEGIN(MappableButtons)
   /* Special */
   PL_MENU_OPTION("Special: Open Menu",     (SPC|SPC_MENU))
   PL_MENU_OPTION("Special: Show keyboard", (SPC|SPC_KYBD))
+  PL_MENU_OPTION("Special: Rewind",        (SPC|SPC_REWIND))
   /* Function keys */
   PL_MENU_OPTION("Joystick Up",    JOY|0x01)
   PL_MENU_OPTION("Joystick Down",  JOY|0x02)
@@ -341,6 +357,10 @@ PL_MENU_ITEMS_BEGIN(OptionMenuDef)
   PL_MENU_HEADER("Enhancements")
   PL_MENU_ITEM("Autoload slot",OPTION_AUTOLOAD,AutoloadSlots,
                "\026\250\020 Select save state to be loaded automatically")
+  PL_MENU_ITEM("Rewind",OPTION_REWIND,ToggleOptions,
+               "\026\250\020 Keep a rewind history (map \"Special: Rewind\" to a button to use it)")
+  PL_MENU_ITEM("Run-ahead",OPTION_RUN_AHEAD,RunAheadOptions,
+               "\026\250\020 Show frames emulated ahead of time to reduce input lag (needs more CPU)")
   PL_MENU_HEADER("Performance")
   PL_MENU_ITEM("VSync (NTSC only)",OPTION_VSYNC,ToggleOptions,
                "\026\250\020 Enable/disable vertical blanking synchronization")
@@ -534,6 +554,13 @@ static PspImage *psp_menu_bg;
 static PspImage *psp_blank_ss_icon;
 static int psp_exit_menu;
 static int psp_options_loaded = 0;
+static pl_rewind psp_rewind;
+static int psp_rewind_ready = 0;
+static int psp_rewind_frames = 0;
+static snapshot_stream_t *psp_rewind_stream = NULL;
+static snapshot_stream_t *psp_run_ahead_stream = NULL;
+static int psp_run_ahead_left = 0;
+static int psp_run_ahead_hold = 0;
 extern PspImage *Screen;
 psp_ctrl_map_t current_map;
 
@@ -548,6 +575,15 @@ static PspImage* psp_load_state_icon(const char *path);
 static int psp_load_state(const char *path);
 static PspImage* psp_save_state(const char *path);
 
+static int  psp_rewind_get_state_size();
+static int  psp_rewind_save_state(void *buffer, int size);
+static int  psp_rewind_load_state(const void *buffer, int size);
+static void psp_rewind_enable(int enable);
+static void psp_rewind_clear();
+
+static int  psp_run_ahead_hook(int *skip_next_frame);
+static void psp_run_ahead_enable(int enable);
+
 static void psp_display_state_tab();
 static void psp_display_control_tab();
 static void psp_display_system_tab();
@@ -569,6 +605,8 @@ int c64ui_init(int *argc, char **argv)
   if (!pl_file_exists(psp_temp_path))
     pl_file_mkdir_recursive(psp_temp_path);
 
+  vsync_set_run_ahead_hook(psp_run_ahead_hook);
+
   /* Initialize menus */
   pl_menu_create(&OptionUiMenu.Menu, OptionMenuDef);
   pl_menu_create(&SystemUiMenu.Menu, SystemMenuDef);
@@ -646,6 +684,8 @@ void c64ui_shutdown()
     if (*psp_tmp_file[i] && pl_file_exists(psp_tmp_file[i]))
       pl_file_rm(psp_tmp_file[i]);
 
+  psp_rewind_enable(0);
+  psp_run_ahead_enable(0);
   psp_save_options();
 }
 
@@ -876,11 +916,34 @@ static int psp_load_state(const char *path)
   PspImage *image = pspImageLoadPngFd(f);
   pspImageDestroy(image);
 
-  /* Load the state data */
-  /* HACK: snapshot saving overridden in snapshot.c */
-  int status = machine_read_snapshot((char*)f, 0);
+  /* Read the state data that follows the image */
+  long offset = ftell(f);
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f) - offset;
+  fseek(f, offset, SEEK_SET);
+
+  void *buffer;
+  if (size <= 0 || !(buffer = malloc(size)))
+  {
+    fclose(f);
+    return 0;
+  }
+  int nread = fread(buffer, 1, size, f);
   fclose(f);
 
+  /* Load the state data */
+  int status = -1;
+  if (nread == size)
+  {
+    snapshot_stream_t *stream = snapshot_memory_read_fopen(buffer, size);
+    status = machine_read_snapshot_stream(stream, 0);
+    snapshot_fclose(stream);
+  }
+  free(buffer);
+
+  /* History leading up to the loaded state no longer applies */
+  psp_rewind_clear();
+
   return status == 0;
 }
 
@@ -916,17 +979,232 @@ static PspImage* psp_save_state(const char *path)
   }
 
   /* Write the state */
-  /* HACK: snapshot saving overridden in snapshot.c */
-  if (machine_write_snapshot((char*)f, 0, 0, 0) < 0)
+  snapshot_stream_t *stream = snapshot_memory_write_fopen(0);
+  size_t size;
+  const void *data;
+  if (machine_write_snapshot_stream(stream, 0, 0, 0) < 0
+    || !(data = snapshot_memory_get_buffer(stream, &size))
+    || fwrite(data, 1, size, f) < size)
   {
     pspImageDestroy(thumb);
     thumb = NULL;
   }
+  snapshot_fclose(stream);
 
   fclose(f);
   return thumb;
 }
 
+/* Rewind */
+static int psp_rewind_get_state_size()
+{
+  return REWIND_STATE_MAX_SIZE;
+}
+
+static int psp_rewind_save_state(void *buffer, int size)
+{
+  /* Reuse one stream, so its buffer is only allocated once */
+  if (!psp_rewind_stream)
+    psp_rewind_stream = snapshot_memory_write_fopen(REWIND_STATE_MAX_SIZE);
+  snapshot_memory_reset(psp_rewind_stream);
+
+  if (machine_write_snapshot_stream(psp_rewind_stream, 0, 0, 0) < 0)
+    return 0;
+
+  size_t written;
+  const void *data = snapshot_memory_get_buffer(psp_rewind_stream, &written);
+  if (written > (size_t)size)
+    return 0;
+
+  memcpy(buffer, data, written);
+  return (int)written;
+}
+
+static int psp_rewind_load_state(const void *buffer, int size)
+{
+  snapshot_stream_t *stream = snapshot_memory_read_fopen(buffer, size);
+  int status = machine_read_snapshot_stream(stream, 0);
+  snapshot_fclose(stream);
+
+  return status == 0;
+}
+
+static void psp_rewind_enable(int enable)
+{
+  if (enable && !psp_rewind_ready)
+  {
+    psp_rewind_ready = pl_rewind_init(&psp_rewind,
+                                      psp_rewind_save_state,
+                                      psp_rewind_load_state,
+                                      psp_rewind_get_state_size);
+    if (!psp_rewind_ready)
+      log_error(LOG_DEFAULT, "Not enough memory for rewind history");
+  }
+  else if (!enable && psp_rewind_ready)
+  {
+    pl_rewind_destroy(&psp_rewind);
+    psp_rewind_ready = 0;
+  }
+
+  if (!enable && psp_rewind_stream)
+  {
+    snapshot_fclose(psp_rewind_stream);
+    psp_rewind_stream = NULL;
+  }
+
+  psp_rewind_frames = 0;
+}
+
+static void psp_rewind_clear()
+{
+  if (psp_rewind_ready)
+    pl_rewind_reset(&psp_rewind);
+  psp_rewind_frames = 0;
+  psp_run_ahead_clear();
+}
+
+static void psp_rewind_save_trap(WORD unused_addr, void *data)
+{
+  if (psp_rewind_ready && !pl_rewind_save(&psp_rewind))
+    DBG(("Rewind capture failed"));
+}
+
+static void psp_rewind_restore_trap(WORD unused_addr, void *data)
+{
+  if (psp_rewind_ready)
+    pl_rewind_restore(&psp_rewind);
+}
+
+/* Called once per frame. While the rewind button is held, steps back one
+   captured state per frame; otherwise captures a state every
+   REWIND_CAPTURE_INTERVAL frames */
+void psp_rewind_update(int rewind_held)
+{
+  if (!psp_options.rewind)
+    return;
+
+  if (!psp_rewind_ready)
+  {
+    psp_rewind_enable(1);
+    if (!psp_rewind_ready)
+    {
+      psp_options.rewind = 0;
+      return;
+    }
+  }
+
+  if (rewind_held)
+  {
+    /* A pending run-ahead capture would undo the step back */
+    psp_run_ahead_clear();
+    psp_rewind_frames = 0;
+    interrupt_maincpu_trigger_trap(psp_rewind_restore_trap, NULL);
+  }
+  else if (++psp_rewind_frames >= REWIND_CAPTURE_INTERVAL)
+  {
+    psp_rewind_frames = 0;
+    interrupt_maincpu_trigger_trap(psp_rewind_save_trap, NULL);
+  }
+}
+
+/* Run-ahead */
+static void psp_run_ahead_save_trap(WORD unused_addr, void *data)
+{
+  /* The machine changed under the capture (reset, state load, rewind) */
+  if (psp_run_ahead_hold)
+    return;
+
+  if (!psp_run_ahead_stream)
+    psp_run_ahead_stream = snapshot_memory_write_fopen(REWIND_STATE_MAX_SIZE);
+  snapshot_memory_reset(psp_run_ahead_stream);
+
+  if (machine_write_snapshot_stream(psp_run_ahead_stream, 0, 0, 0) < 0)
+  {
+    DBG(("Run-ahead capture failed"));
+    return;
+  }
+
+  /* Sound of the speculative frames is dropped along with them. The first
+     speculative frame is the one normal mode would show next, so it takes
+     one more than psp_options.run_ahead to get ahead of it */
+  sound_mark_samples();
+  psp_run_ahead_left = psp_options.run_ahead + 1;
+}
+
+static void psp_run_ahead_restore_trap(WORD unused_addr, void *data)
+{
+  size_t size;
+  const void *buffer = snapshot_memory_get_buffer(psp_run_ahead_stream, &size);
+  snapshot_stream_t *stream = snapshot_memory_read_fopen(buffer, size);
+  machine_read_snapshot_stream(stream, 0);
+  snapshot_fclose(stream);
+
+  sound_drop_marked_samples();
+
+  /* Show the speculative frame before the next real frame is emulated */
+  psp_refresh_finish();
+}
+
+/* Called from vsync_do_vsync() at the end of every frame. Each real frame
+   is captured and followed by psp_options.run_ahead + 1 speculative frames,
+   which see the input read at the real frame; the last one is displayed,
+   and the machine is then put back to the captured state. The real frames
+   are emulated, paced and heard, but never drawn. */
+static int psp_run_ahead_hook(int *skip_next_frame)
+{
+  if (psp_run_ahead_left > 0)
+  {
+    if (--psp_run_ahead_left > 0)
+    {
+      /* Only the last speculative frame needs drawing */
+      *skip_next_frame = (psp_run_ahead_left > 1);
+      return 1;
+    }
+
+    psp_refresh_screen();
+    interrupt_maincpu_trigger_trap(psp_run_ahead_restore_trap, NULL);
+    *skip_next_frame = 1;
+    return 1;
+  }
+
+  if (psp_run_ahead_hold)
+  {
+    psp_run_ahead_hold = 0;
+    return 0;
+  }
+
+  if (psp_run_ahead_active())
+    interrupt_maincpu_trigger_trap(psp_run_ahead_save_trap, NULL);
+
+  return 0;
+}
+
+static void psp_run_ahead_enable(int enable)
+{
+  if (!enable && psp_run_ahead_stream)
+  {
+    snapshot_fclose(psp_run_ahead_stream);
+    psp_run_ahead_stream = NULL;
+  }
+
+  psp_run_ahead_clear();
+}
+
+/* Nonzero when real frames are not displayed by vsyncarch_presync(). Not
+   used over the network, as both peers must emulate the same frames */
+int psp_run_ahead_active()
+{
+  return psp_options.run_ahead > 0 && !network_connected();
+}
+
+/* Abandons the current capture; call whenever the machine state is
+   replaced outside of run-ahead */
+void psp_run_ahead_clear()
+{
+  psp_run_ahead_left = 0;
+  psp_run_ahead_hold = 1;
+}
+
 static void psp_load_options()
 {
   pl_file_path path;
@@ -950,6 +1228,8 @@ static void psp_load_options()
   psp_options.control_mode = pl_ini_get_int(&file, "Menu", "ControlMode", 0);
   psp_options.animate_menu = pl_ini_get_int(&file, "Menu", "Animate", 1);
   psp_options.toggle_vk = pl_ini_get_int(&file, "Input", "VKMode", 0);
+  psp_options.rewind = pl_ini_get_int(&file, "System", "Rewind", 0);
+  psp_options.run_ahead = pl_ini_get_int(&file, "System", "RunAhead", 0);
   pl_ini_get_string(&file, "File", "GamePath", NULL, psp_game_path, sizeof(psp_game_path));
 
   /* VICE settings */
@@ -1008,6 +1288,8 @@ static int psp_save_options()
   pl_ini_set_int(&file, "Menu", "ControlMode", psp_options.control_mode);
   pl_ini_set_int(&file, "Menu", "Animate", psp_options.animate_menu);
   pl_ini_set_int(&file, "Input", "VKMode", psp_options.toggle_vk);
+  pl_ini_set_int(&file, "System", "Rewind", psp_options.rewind);
+  pl_ini_set_int(&file, "System", "RunAhead", psp_options.run_ahead);
   pl_ini_set_string(&file, "File", "GamePath", psp_game_path);
 
   /* VICE settings */
@@ -1169,6 +1451,7 @@ static int psp_load_game(const char *path)
   datasette_control(DATASETTE_CONTROL_RESET);
   tape_image_detach(1);
   file_system_detach_disk(GET_DRIVE(8));
+  psp_rewind_clear();
 
   const char *game_path = prepare_file(path, 0);
 
@@ -1234,6 +1517,10 @@ void psp_display_menu()
       pl_menu_select_option_by_value(item, (void*)(int)psp_options.show_border);
       if ((item = pl_menu_find_item_by_id(&OptionUiMenu.Menu, OPTION_VSYNC)))
         pl_menu_select_option_by_value(item, (void*)(int)psp_options.vsync);
+      item = pl_menu_find_item_by_id(&OptionUiMenu.Menu, OPTION_REWIND);
+      pl_menu_select_option_by_value(item, (void*)(int)psp_options.rewind);
+      item = pl_menu_find_item_by_id(&OptionUiMenu.Menu, OPTION_RUN_AHEAD);
+      pl_menu_select_option_by_value(item, (void*)(int)psp_options.run_ahead);
       resources_get_int("RefreshRate", &setting);
       if ((item = pl_menu_find_item_by_id(&OptionUiMenu.Menu, OPTION_REFRESH_RATE)))
         pl_menu_select_option_by_value(item, (void*)setting);
@@ -1471,6 +1758,7 @@ static int OnMenuOk(const void *uimenu, const void* sel_item)
       DBG(("System reset"));
       psp_exit_menu = 1;
       machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+      psp_rewind_clear();
       return 1;
     }
     break;
@@ -1702,6 +1990,14 @@ static int OnMenuItemChanged(const struct PspUiMenu *uimenu,
       psp_options.vsync = (int)option->value;
       resources_set_int("VBLANKSync", (int)option->value);
       break;
+    case OPTION_REWIND:
+      psp_options.rewind = (int)option->value;
+      psp_rewind_enable(psp_options.rewind);
+      break;
+    case OPTION_RUN_AHEAD:
+      psp_options.run_ahead = (int)option->value;
+      psp_run_ahead_enable(psp_options.run_ahead);
+      break;
     case SYSTEM_SND_ENGINE:
       resources_set_int("SidEngine", (int)option->value);
       break;
@@ -16,86 +16,206 @@
    You should have received a copy of the GNU General Public License
    along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
-   Author contact information: 
+   Author contact information:
      Email: dev@psp.akop.org
 */
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "pl_rewind.h"
 
+#define REWIND_KEYFRAME  0x01
+
+/* Zero runs shorter than this are kept inside a literal run, since
+   splitting the run would cost more than it saves */
+#define RLE_MIN_ZERO_RUN 4
+#define RLE_MAX_RUN      0xffff
+
 typedef struct rewind_state
 {
-  void *data;
+  int flags;
+  int state_size;   /* Size of the state this record decodes to */
+  int packed_size;
   struct rewind_state *prev;
   struct rewind_state *next;
 } rewind_state_t;
 
+#define RECORD_DATA(r) ((unsigned char*)((r) + 1))
+
 static int get_free_memory();
 
-int pl_rewind_init(pl_rewind *rewind,
-  int (*save_state)(void *),
-  int (*load_state)(void *),
-  int (*get_state_size)())
+/* Worst-case size of a compressed record for a state of 'size' bytes */
+static int rle_bound(int size)
 {
-	float memory_needed = (float)get_free_memory() * 0.85;
-  int state_data_size = get_state_size();
-  int state_count = (int)(memory_needed 
-                    / (float)(state_data_size + sizeof(rewind_state_t)));
+  return size + (size / RLE_MAX_RUN + 2) * 4;
+}
 
-	if (state_count < 1)
-    return 0;
+static unsigned char* rle_put_run(unsigned char *out, int zeros, int literals)
+{
+  *out++ = zeros & 0xff;
+  *out++ = zeros >> 8;
+  *out++ = literals & 0xff;
+  *out++ = literals >> 8;
+  return out;
+}
 
-  /* First state */
-  rewind_state_t *prev, *curr = NULL;
-  if (!(rewind->start = (rewind_state_t*)malloc(sizeof(rewind_state_t))))
-    return 0;
+/* Compresses src ^ base (or src alone, if base is NULL) as a sequence of
+   (zero run, literal run, literal bytes) tokens. Returns packed size. */
+static int rle_pack(const unsigned char *src,
+                    const unsigned char *base,
+                    int size,
+                    unsigned char *dest)
+{
+  unsigned char *out = dest;
+  int pos = 0;
 
-  if (!(rewind->start->data = malloc(state_data_size)))
+  while (pos < size)
   {
-    free(rewind->start);
-    rewind->start = NULL;
-    return 0;
+    /* Count zero bytes */
+    int zeros = 0;
+    while (pos + zeros < size && zeros < RLE_MAX_RUN
+      && (src[pos + zeros] ^ (base ? base[pos + zeros] : 0)) == 0)
+      zeros++;
+    pos += zeros;
+
+    /* Count literal bytes, swallowing short zero runs */
+    int literals = 0, run = 0;
+    while (pos + literals + run < size && literals + run < RLE_MAX_RUN)
+    {
+      int i = pos + literals + run;
+      if ((src[i] ^ (base ? base[i] : 0)) == 0)
+      {
+        if (++run >= RLE_MIN_ZERO_RUN)
+          break;
+      }
+      else
+      {
+        literals += run + 1;
+        run = 0;
+      }
+    }
+
+    out = rle_put_run(out, zeros, literals);
+
+    int i;
+    for (i = 0; i < literals; i++, pos++)
+      *out++ = src[pos] ^ (base ? base[pos] : 0);
   }
 
-  prev = rewind->start;
+  return out - dest;
+}
 
-  /* The rest */
-  int i;
-  for (i = 1; i < state_count; i++)
+/* Expands packed data onto dest. With apply_xor set, literals are XOR'ed into
+   dest and zero runs leave it untouched; otherwise dest is overwritten. */
+static void rle_unpack(const unsigned char *src,
+                       int packed_size,
+                       unsigned char *dest,
+                       int apply_xor)
+{
+  const unsigned char *end = src + packed_size;
+
+  while (src < end)
   {
-    /* If allocation fails, compose a shorter state chain */
-    if (!(curr = (rewind_state_t*)malloc(sizeof(rewind_state_t))))
-    {
-      state_count = i + 1;
-      break;
-    }
+    int zeros = src[0] | (src[1] << 8);
+    int literals = src[2] | (src[3] << 8);
+    src += 4;
 
-    /* If allocation fails, compose a shorter state chain */
-    if (!(curr->data = malloc(state_data_size)))
+    if (!apply_xor)
+      memset(dest, 0, zeros);
+    dest += zeros;
+
+    if (apply_xor)
     {
-      state_count = i + 1;
-      free(curr);
-      break;
+      int i;
+      for (i = 0; i < literals; i++)
+        dest[i] ^= src[i];
     }
+    else
+      memcpy(dest, src, literals);
+
+    dest += literals;
+    src += literals;
+  }
+}
+
+static void drop_oldest(pl_rewind *rewind)
+{
+  rewind_state_t *oldest = rewind->start;
+  if (!oldest)
+    return;
+
+  rewind->start = oldest->next;
+  if (rewind->start)
+    rewind->start->prev = NULL;
+  else
+    rewind->end = NULL;
+
+  rewind->memory_used -= sizeof(rewind_state_t) + oldest->packed_size;
+  rewind->state_count--;
+  free(oldest);
+}
+
+static rewind_state_t* alloc_record(pl_rewind *rewind, int packed_size)
+{
+  int needed = sizeof(rewind_state_t) + packed_size;
+  if (needed > rewind->memory_budget)
+    return NULL;
 
-    prev->next = curr;
-    curr->prev = prev;
-    prev = curr;
+  /* Make room within the budget */
+  while (rewind->start && rewind->memory_used + needed > rewind->memory_budget)
+    drop_oldest(rewind);
+
+  /* If allocation fails, settle for a shorter chain */
+  rewind_state_t *record;
+  while (!(record = (rewind_state_t*)malloc(needed)))
+  {
+    if (!rewind->start)
+      return NULL;
+    drop_oldest(rewind);
   }
 
-  /* Make circular */
-  rewind->start->prev = prev;
-  curr->next = rewind->start;
+  rewind->memory_used += needed;
+  return record;
+}
+
+int pl_rewind_init(pl_rewind *rewind,
+  int (*save_state)(void *, int),
+  int (*load_state)(const void *, int),
+  int (*get_state_size)())
+{
+  int state_data_size = get_state_size();
+
+  rewind->start = rewind->end = NULL;
+  rewind->current = rewind->scratch = rewind->packed = NULL;
+
+  if (state_data_size < 1)
+    return 0;
+
+  if (!(rewind->current = malloc(state_data_size))
+    || !(rewind->scratch = malloc(state_data_size))
+    || !(rewind->packed = malloc(rle_bound(state_data_size))))
+  {
+    free(rewind->current);
+    free(rewind->scratch);
+    rewind->current = rewind->scratch = NULL;
+    return 0;
+  }
+
+  /* Records are allocated as states come in; leave the other half of
+     free memory for whatever the emulator allocates later on */
+  rewind->memory_budget = get_free_memory() / 2;
+  rewind->memory_used = 0;
 
   /* Init structure */
-  rewind->current = NULL;
   rewind->save_state = save_state;
   rewind->load_state = load_state;
   rewind->get_state_size = get_state_size;
   rewind->state_data_size = state_data_size;
-  rewind->state_count = state_count;
+  rewind->state_count = 0;
+  rewind->have_current = 0;
+  rewind->current_size = 0;
 
   return 1;
 }
@@ -111,65 +231,124 @@ void pl_rewind_realloc(pl_rewind *rewind)
 
 void pl_rewind_destroy(pl_rewind *rewind)
 {
-  rewind->start->prev->next = NULL; /* Prevent infinite loop */
-	rewind_state_t *curr, *next;
-
-  for (curr = rewind->start; curr; curr = next)
-  {
-    next = curr->next;
-    free(curr->data);
-    free(curr);
-  }
+  pl_rewind_reset(rewind);
 
-  rewind->start = NULL;
-  rewind->current = NULL;
+  free(rewind->current);
+  free(rewind->scratch);
+  free(rewind->packed);
+  rewind->current = rewind->scratch = rewind->packed = NULL;
 }
 
 void pl_rewind_reset(pl_rewind *rewind)
 {
-  rewind->current = NULL;
+  while (rewind->start)
+    drop_oldest(rewind);
+
+  rewind->state_count = 0;
+  rewind->memory_used = 0;
+  rewind->have_current = 0;
 }
 
 int pl_rewind_save(pl_rewind *rewind)
 {
-  rewind_state_t *save_slot = 
-    (rewind->current) ? rewind->current->next
-                      : rewind->start;
+  if (!rewind->scratch)
+    return 0;
 
-	if (!rewind->save_state(save_slot->data))
+  int size = rewind->save_state(rewind->scratch, rewind->state_data_size);
+  if (size < 1)
     return 0;
 
-	rewind->current = save_slot;
+  if (rewind->have_current)
+  {
+    /* Record how to get from the new state back to the current one */
+    int flags = 0, packed_size;
+    if (size == rewind->current_size)
+      packed_size = rle_pack(rewind->current, rewind->scratch,
+                             size, rewind->packed);
+    else
+    {
+      flags = REWIND_KEYFRAME;
+      packed_size = rle_pack(rewind->current, NULL,
+                             rewind->current_size, rewind->packed);
+    }
 
-  /* Move starting point forward, if we've reached the start node */
-  if (save_slot->next == rewind->start)
-    rewind->start = rewind->start->next;
+    rewind_state_t *record = alloc_record(rewind, packed_size);
+    if (record)
+    {
+      record->flags = flags;
+      record->state_size = rewind->current_size;
+      record->packed_size = packed_size;
+      memcpy(RECORD_DATA(record), rewind->packed, packed_size);
+
+      record->next = NULL;
+      record->prev = rewind->end;
+      if (rewind->end)
+        rewind->end->next = record;
+      else
+        rewind->start = record;
+      rewind->end = record;
+      rewind->state_count++;
+    }
+    else
+    {
+      /* Too large to keep; the chain can't reach past this point */
+      while (rewind->start)
+        drop_oldest(rewind);
+    }
+  }
+
+  /* New state becomes current */
+  void *swap = rewind->current;
+  rewind->current = rewind->scratch;
+  rewind->scratch = swap;
+  rewind->current_size = size;
+  rewind->have_current = 1;
 
   return 1;
 }
 
 int pl_rewind_restore(pl_rewind *rewind)
 {
-  rewind_state_t *load_slot = rewind->current;
-  if (!(load_slot && rewind->load_state(load_slot->data)))
+  if (!(rewind->have_current
+    && rewind->load_state(rewind->current, rewind->current_size)))
     return 0;
 
   /* Can't go past the starting point */
-  if (load_slot != rewind->start)
-    rewind->current = rewind->current->prev;
+  rewind_state_t *record = rewind->end;
+  if (!record)
+    return 1;
+
+  /* Step the current state back by one */
+  if (record->flags & REWIND_KEYFRAME)
+    rle_unpack(RECORD_DATA(record), record->packed_size,
+               rewind->current, 0);
+  else
+    rle_unpack(RECORD_DATA(record), record->packed_size,
+               rewind->current, 1);
+  rewind->current_size = record->state_size;
+
+  rewind->end = record->prev;
+  if (rewind->end)
+    rewind->end->next = NULL;
+  else
+    rewind->start = NULL;
+
+  rewind->memory_used -= sizeof(rewind_state_t) + record->packed_size;
+  rewind->state_count--;
+  free(record);
 
   return 1;
 }
 
 static int get_free_memory()
 {
-  const int 
+  const int
     chunk_size = 65536, // 64 kB
     chunks = 1024; // 65536 * 1024 = 64 MB
   void *mem_reserv[chunks];
   int total_mem = 0, i;
 
-  /* Initialize */	
+  /* Initialize */
   for (i = 0; i < chunks; i++)
     mem_reserv[i] = NULL;
 
@@ -189,7 +368,6 @@ static int get_free_memory()
       break;
     free(mem_reserv[i]);
   }
-	
-	return total_mem;
-}
 
+  return total_mem;
+}
@@ -16,12 +16,12 @@
    You should have received a copy of the GNU General Public License
    along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
-   Author contact information: 
+   Author contact information:
      Email: dev@psp.akop.org
 */
-
-#ifndef _PL_REWIND_H
-#define _PL_REWIND_H
+
+#ifndef _PL_REWIND_H
+#define _PL_REWIND_H
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,20 +29,33 @@ extern "C" {
 
 struct rewind_state;
 
+/* States are kept as a chain of compressed records, newest last. Only the
+   most recent state is held uncompressed; every record holds what is
+   needed to step back from its state to the one before it - either an
+   RLE-compressed XOR delta (when both states have the same size), or a
+   complete keyframe copy of the older state. Dropping the oldest record
+   therefore never invalidates the rest of the chain. */
 typedef struct
 {
-  int state_data_size;
-  int state_count;
+  int state_data_size;   /* Capacity of a single uncompressed state */
+  int state_count;       /* Number of states that can be stepped back to */
+  int memory_budget;     /* Maximum bytes spent on compressed records */
+  int memory_used;
+  int have_current;
+  int current_size;
+  void *current;         /* Most recently saved state, uncompressed */
+  void *scratch;         /* Incoming state / decompression target */
+  void *packed;          /* Compression output buffer */
   struct rewind_state *start;
-  struct rewind_state *current;
-  int (*save_state)(void *);
-  int (*load_state)(void *);
+  struct rewind_state *end;
+  int (*save_state)(void *, int);
+  int (*load_state)(const void *, int);
   int (*get_state_size)();
 } pl_rewind;
 
 int  pl_rewind_init(pl_rewind *rewind,
-  int (*save_state)(void *),
-  int (*load_state)(void *),
+  int (*save_state)(void *, int),
+  int (*load_state)(const void *, int),
   int (*get_state_size)());
 void pl_rewind_realloc(pl_rewind *rewind);
 void pl_rewind_destroy(pl_rewind *rewind);
@@ -53,5 +66,5 @@ int  pl_rewind_restore(pl_rewind *rewind);
 #ifdef __cplusplus
 }
 #endif
-
-#endif // _PL_REWIND_H
+
+#endif // _PL_REWIND_H
@@ -209,6 +209,18 @@ void pspVideoEnd()
   sceGuSync(0, 0);
 }
 
+/* Close the display list without waiting for the GE to execute it;
+   pspVideoSync() must be called before the next pspVideoBegin() */
+void pspVideoFinish()
+{
+  sceGuFinish();
+}
+
+void pspVideoSync()
+{
+  sceGuSync(0, 0);
+}
+
 void pspVideoPutImage(const PspImage *image, int dx, int dy, int dw, int dh)
 {
   sceGuScissor(dx, dy, dx + dw, dy + dh);
@@ -38,6 +38,7 @@ TODO:
 #include <stdio.h>
 #include <unistd.h>
 #include <pthread.h>
+#include <sched.h>
 #define DBG(x)	/*(x)*/
 #define TEST_BUFSIZE	10
 #else
@@ -87,6 +88,7 @@ void sfifo_close(sfifo_t *f)
 
 /*
  * Empty FIFO buffer
+ * Only safe while neither side is using the FIFO
  */
 void sfifo_flush(sfifo_t *f)
 {
@@ -95,6 +97,15 @@ void sfifo_flush(sfifo_t *f)
 	f->writepos = 0;
 }
 
+/*
+ * Drop everything currently in the FIFO
+ * Reader side only; safe while the writer is running
+ */
+void sfifo_discard(sfifo_t *f)
+{
+	f->readpos = f->writepos;
+}
+
 /*
  * Write bytes to a FIFO
  * Return number of bytes written, or an error code
@@ -125,7 +136,10 @@ int sfifo_write(sfifo_t *f, const void *_buf, int len)
 		i = 0;
 	}
 	memcpy(f->buffer + i, buf, len);
-	f->writepos = i + len;
+
+	/* Publish the data only after it has been copied */
+	SFIFO_BARRIER();
+	f->writepos = (i + len) & SFIFO_SIZEMASK(f);
 
 	return total;
 }
@@ -191,6 +205,9 @@ int sfifo_read(sfifo_t *f, void *_buf, int len)
 	else
 		total = len;
 
+	/* Don't read the data before its write position was seen */
+	SFIFO_BARRIER();
+
 	i = f->readpos;
 	if(i + len > f->size)
 	{
@@ -200,7 +217,10 @@ int sfifo_read(sfifo_t *f, void *_buf, int len)
 		i = 0;
 	}
 	memcpy(buf, f->buffer + i, len);
-	f->readpos = i + len;
+
+	/* Release the space only after the data has been copied out */
+	SFIFO_BARRIER();
+	f->readpos = (i + len) & SFIFO_SIZEMASK(f);
 
 	return total;
 }
@@ -246,85 +266,97 @@ int sfifo_read_user(sfifo_t *f, void *buf, int len)
 #endif
 
 #ifdef _SFIFO_TEST_
+/*
+ * Stress test: one thread writes a running byte counter in random
+ * sized chunks, the main thread reads it back in random sized chunks
+ * and checks that nothing is lost, duplicated or reordered.
+ * Build and run it from the top of the source tree:
+ *
+ *	gcc -D_SFIFO_TEST_ -I. -Iarch/psp arch/psp/sfifo.c -lpthread
+ *	./a.out
+ */
+#define TEST_BYTES	(4 * 1024 * 1024)
+
+static int test_failed = 0;
+
 void *sender(void *arg)
 {
 	char buf[TEST_BUFSIZE*2];
+	unsigned int seed = 1;
+	unsigned char cnt = 0;
+	long sent = 0;
 	int i,j;
-	int cnt = 0;
 	int res;
 	sfifo_t *sf = (sfifo_t *)arg;
-	while(1)
+
+	while(sent < TEST_BYTES && !test_failed)
 	{
-		j = sfifo_space(sf);
+		j = rand_r(&seed) % sizeof(buf) + 1;
 		for(i = 0; i < j; ++i)
+			buf[i] = (char)(cnt + i);
+		res = sfifo_write(sf, buf, j);
+		if(res < 0 || res > j)
 		{
-			++cnt;
-			buf[i] = cnt;
+			printf("Write failed! (%d)\n", res);
+			test_failed = 1;
+			break;
 		}
-		res = sfifo_write(sf, &buf, j);
-		if(res != j)
-		{
-			printf("Write failed!\n");
-			sleep(1);
-		} else if(res)
-			printf("Wrote %d\n", res);
+		if(!res)
+			sched_yield();
+		cnt += res;
+		sent += res;
 	}
+	return NULL;
 }
+
 int main()
 {
 	sfifo_t sf;
-	char last = 0;
+	unsigned char expect = 0;
+	unsigned int seed = 2;
+	long received = 0;
 	pthread_t thread;
-	char buf[100] = "---------------------------------------";
-
-	printf("sfifo_init(&sf, %d) = %d\n",
-			TEST_BUFSIZE, sfifo_init(&sf, TEST_BUFSIZE)
-		);
-
-#if 0
-	printf("sfifo_write(&sf,\"0123456789\",7) = %d\n",
-		sfifo_write(&sf,"0123456789",7) );
-
-	printf("sfifo_write(&sf,\"abcdefghij\",7) = %d\n",
-		sfifo_write(&sf,"abcdefghij",7) );
-
-	printf("sfifo_read(&sf,buf,8) = %d\n",
-		sfifo_read(&sf,buf,8) );
-
-	buf[20] = 0;
-	printf("buf =\"%s\"\n",buf);
-
-	printf("sfifo_write(&sf,\"0123456789\",7) = %d\n",
-		sfifo_write(&sf,"0123456789",7) );
+	char buf[TEST_BUFSIZE*2];
+	int i,j;
+	int res;
 
-	printf("sfifo_read(&sf,buf,10) = %d\n",
-		sfifo_read(&sf,buf,10) );
+	if(sfifo_init(&sf, TEST_BUFSIZE))
+	{
+		printf("sfifo_init() failed\n");
+		return 1;
+	}
 
-	buf[20] = 0;
-	printf("buf =\"%s\"\n",buf);
-#else
 	pthread_create(&thread, NULL, sender, &sf);
 
-	while(1)
+	while(received < TEST_BYTES && !test_failed)
 	{
-		static int c = 0;
-		++last;
-		while( sfifo_read(&sf,buf,1) != 1 )
-			/*sleep(1)*/;
-		if(last != buf[0])
+		j = sfifo_used(&sf);
+		if(j < 0 || j >= sf.size)
 		{
-			printf("Error %d!\n", buf[0]-last);
-			last = buf[0];
+			printf("Bad fill level %d\n", j);
+			test_failed = 1;
+			break;
 		}
-		else
-			printf("Ok. (%d)\n",++c);
+		res = sfifo_read(&sf, buf, rand_r(&seed) % sizeof(buf) + 1);
+		for(i = 0; i < res; ++i, ++expect)
+			if((unsigned char)buf[i] != expect)
+			{
+				printf("Error at byte %ld: got %d, expected %d\n",
+					received + i, (unsigned char)buf[i], expect);
+				test_failed = 1;
+				break;
+			}
+		if(!res)
+			sched_yield();
+		received += res;
 	}
-#endif
 
+	pthread_join(thread, NULL);
 	sfifo_close(&sf);
-	printf("sfifo_close(&sf)\n");
 
-	return 0;
+	printf("%s, %ld bytes transferred\n",
+		test_failed ? "FAILED" : "Ok", received);
+	return test_failed;
 }
 
 #endif
@@ -58,12 +58,34 @@ typedef int sfifo_atomic_t;
 #	define	SFIFO_MAX_BUFFER_SIZE	0x7fffffff
 #endif
 
+#ifndef SFIFO_CACHE_LINE
+#	define	SFIFO_CACHE_LINE	64
+#endif
+
+/*
+ * Keeps the compiler from moving buffer accesses across the
+ * position updates. This is enough on single core targets and
+ * on x86; other SMP targets need a real memory barrier here.
+ */
+#ifdef __GNUC__
+#	define	SFIFO_BARRIER()	__asm__ __volatile__("" : : : "memory")
+#else
+#	define	SFIFO_BARRIER()
+#endif
+
+/*
+ * readpos is only ever written by the reader and writepos only by
+ * the writer. They live on separate cache lines so the two sides
+ * never bounce the same line back and forth.
+ */
 typedef struct sfifo_t
 {
 	char *buffer;
 	int size;			/* Number of bytes */
-	sfifo_atomic_t readpos;		/* Read position */
-	sfifo_atomic_t writepos;	/* Write position */
+	volatile sfifo_atomic_t readpos;	/* Read position */
+	char pad0[SFIFO_CACHE_LINE - sizeof(sfifo_atomic_t)];
+	volatile sfifo_atomic_t writepos;	/* Write position */
+	char pad1[SFIFO_CACHE_LINE - sizeof(sfifo_atomic_t)];
 } sfifo_t;
 
 #define SFIFO_SIZEMASK(x)	((x)->size - 1)
@@ -77,6 +99,7 @@ void sfifo_close(sfifo_t *f);
 void sfifo_flush(sfifo_t *f);
 int sfifo_write(sfifo_t *f, const void *buf, int len);
 int sfifo_read(sfifo_t *f, void *buf, int len);
+void sfifo_discard(sfifo_t *f);
 #define sfifo_used(x)	(((x)->writepos - (x)->readpos) & SFIFO_SIZEMASK(x))
 #define sfifo_space(x)	((x)->size - 1 - sfifo_used(x))
 
@@ -41,6 +41,8 @@ typedef struct psp_options
   int joyport;
   int show_border;
   int vsync;
+  int rewind;
+  int run_ahead;
 } psp_options_t;
 
 #define SPC 0x100
@@ -49,6 +51,7 @@ typedef struct psp_options
 
 #define SPC_MENU 0x01
 #define SPC_KYBD 0x02
+#define SPC_REWIND 0x03
 
 #define CK(x,y,z) (KBD|(((x&0xf) << 4)|(y&0xf)))
 #define CKROW(ck) ((ck&0xf0)>>4)
@@ -60,6 +63,9 @@ extern psp_ctrl_map_t current_map;
 
 extern int ui_vblank_sync_enabled();
 extern void psp_display_menu();
+extern void psp_rewind_update(int rewind_held);
+extern int psp_run_ahead_active();
+extern void psp_run_ahead_clear();
 
 extern void ui_exit(void);
 extern void ui_display_speed(float percent, float framerate, int warp_flag);
@@ -34,6 +34,13 @@
 #endif
 
 PspImage *Screen = NULL;
+/* Copy of the last completed frame; the GE renders from this while the
+   next frame is emulated into Screen */
+static PspImage *Display = NULL;
+static int render_pending = 0;
+/* Lines of Screen changed since they were last copied to Display */
+static unsigned char dirty_lines[512];
+static int have_dirty_lines = 0;
 static struct video_canvas_s *activeCanvas = NULL;
 static float last_framerate = 0;
 static float last_percent = 0;
@@ -56,6 +63,7 @@ static pl_vk_layout psp_keyboard;
 static inline void psp_keyboard_toggle(unsigned int code, int on);
 
 static void video_psp_display_menu();
+static void psp_mark_dirty(int y, int h);
 static void pause_trap(WORD unused_addr, void *data);
 
 typedef struct psp_ctrl_mask_to_index_map
@@ -124,6 +132,13 @@ video_canvas_t *video_canvas_create(video_canvas_t *canvas, unsigned int *width,
 
 void video_canvas_destroy(struct video_canvas_s *canvas)
 {
+  psp_refresh_finish();
+
+  if (Display)
+  {
+    pspImageDestroy(Display);
+    Display = NULL;
+  }
   if (Screen)
   {
     pspImageDestroy(Screen);
@@ -169,6 +184,10 @@ static int video_frame_buffer_alloc(video_canvas_t *canvas,
   {
     if (!(Screen = pspImageCreateVram(512, 512, PSP_IMAGE_INDEXED)))
       return -1;
+
+    /* Without room for a second buffer, rendering stays synchronous */
+    Display = pspImageCreateVram(512, 512, PSP_IMAGE_INDEXED);
+    psp_mark_dirty(0, 512);
   }
 
   *fb_pitch = (Screen->Depth / 8) * Screen->Width;
@@ -199,6 +218,9 @@ int video_canvas_set_palette(struct video_canvas_s *canvas,
     return 0;
   }
 
+  /* The GE may still be reading the palette of the previous frame */
+  psp_refresh_finish();
+
   canvas->palette = palette;
   DBG(("video_canvas_set_palette, size:%d", palette->num_entries));
   unsigned int i;
@@ -208,9 +230,14 @@ int video_canvas_set_palette(struct video_canvas_s *canvas,
         palette->entries[i].red,
         palette->entries[i].green,
         palette->entries[i].blue);
+    if (Display)
+      Display->Palette[i] = Screen->Palette[i];
     DBG(("video_canvas_set_palette r:%d, g:%d, b:%d", palette->entries[i].red, palette->entries[i].green, palette->entries[i].blue));
   }
   Screen->PalSize = palette->num_entries;
+  if (Display)
+    Display->PalSize = Screen->PalSize;
+  psp_mark_dirty(0, 512);
   return 0;
 }
 
@@ -248,12 +275,14 @@ static void video_psp_display_menu()
 static void pause_trap(WORD unused_addr, void *data)
 {
   DBG(("pause_trap"));
+  psp_refresh_finish();
   psp_reset_viewport(&Screen->Viewport, 1);
   sound_suspend();
 
   psp_display_menu(); /* Display menu */
 
   psp_reset_viewport(&Screen->Viewport, psp_options.show_border);
+  psp_mark_dirty(0, 512);
 
   /* Set up viewing sizes */
   float ratio;
@@ -311,6 +340,8 @@ void psp_input_poll()
   /* Reset joystick */
   joystick_value[psp_options.joyport] = 0;
 
+  int rewind_held = 0;
+
   /* Parse input */
   static SceCtrlData pad;
   if (pspCtrlPollControls(&pad))
@@ -391,10 +422,32 @@ void psp_input_poll()
 
           show_kybd_held = on;
           break;
+        case SPC_REWIND:
+          rewind_held |= on;
+          break;
         }
       }
     }
   }
+
+  psp_rewind_update(rewind_held);
+}
+
+/* Note lines [y; y + h) of Screen as changed */
+static void psp_mark_dirty(int y, int h)
+{
+  if (y < 0)
+  {
+    h += y;
+    y = 0;
+  }
+  if (y + h > 512)
+    h = 512 - y;
+  if (h <= 0)
+    return;
+
+  memset(dirty_lines + y, 1, h);
+  have_dirty_lines = 1;
 }
 
 void video_canvas_refresh(struct video_canvas_s *canvas,
@@ -403,18 +456,81 @@ void video_canvas_refresh(struct video_canvas_s *canvas,
                           unsigned int w, unsigned int h)
 {
   /* This is where the emulator usually performs screen refresh */
-  /* Moved it to pre-sync routine, so that drawing is performed constantly */
+  /* Moved it to pre-sync routine, so that drawing is performed constantly;
+     only remember which lines of the draw buffer changed */
+  psp_mark_dirty(ys, h);
 }
 
-void psp_refresh_screen()
+/* Wait for the GE to finish the frame started by psp_refresh_screen()
+   and display it. The vsync code calls this before the next frame is
+   emulated, so the GE overlaps with the end-of-frame work (vsync jobs,
+   sound flush) and the frame is still shown within the same frame */
+void psp_refresh_finish()
 {
-  if (!Screen || !activeCanvas)
+  if (!render_pending)
     return;
 
+  render_pending = 0;
+  pspVideoSync();
+
   /* Wait for video synch, if enabled */
   if (psp_options.vsync && ntsc_mode)
     pspVideoWaitVSync();
 
+  /* Swap buffers */
+  pspVideoSwapBuffers();
+}
+
+void psp_refresh_screen()
+{
+  PspImage *source;
+  int y;
+
+  if (!Screen || !activeCanvas)
+    return;
+
+  /* The previous frame must be out before its buffers are reused */
+  psp_refresh_finish();
+
+  // Needed for palette
+  if (!activeCanvas->videoconfig->color_tables.updated)
+  { /* update colors as necessary */
+    video_color_update_palette(activeCanvas);
+  }
+
+  /* Hand the visible part of the frame over to the GE, so that emulation
+     of the next frame can overwrite Screen while this one is drawn */
+  source = Screen;
+  if (Display)
+  {
+    const PspViewport *port = &Screen->Viewport;
+
+    /* Nothing changed and nothing drawn on top: keep showing the last
+       frame */
+    if (!have_dirty_lines && clear_screen < 0 && !keyboard_visible
+        && !psp_options.show_fps && !psp_options.show_osi)
+      return;
+
+    if (have_dirty_lines)
+    {
+      for (y = port->Y; y < port->Y + port->Height; y++)
+        if (dirty_lines[y])
+          memcpy((u8*)Display->Pixels + y * Display->Width + port->X,
+                 (u8*)Screen->Pixels + y * Screen->Width + port->X,
+                 port->Width);
+      memset(dirty_lines, 0, sizeof(dirty_lines));
+      have_dirty_lines = 0;
+    }
+    Display->Viewport = *port;
+    source = Display;
+  }
+  else
+  {
+    /* Wait for video synch, if enabled */
+    if (psp_options.vsync && ntsc_mode)
+      pspVideoWaitVSync();
+  }
+
   /* Update the display */
   pspVideoBegin();
 
@@ -430,14 +546,8 @@ void psp_refresh_screen()
       pspVideoFillRect(0, 0, SCR_WIDTH, line_height, PSP_COLOR_BLACK);
   }
 
-  // Needed for palette
-  if (!activeCanvas->videoconfig->color_tables.updated)
-  { /* update colors as necessary */
-    video_color_update_palette(activeCanvas);
-  }
-
   /* Draw the screen */
-  pl_gfx_put_image(Screen, screen_x, screen_y, screen_w, screen_h);
+  pl_gfx_put_image(source, screen_x, screen_y, screen_w, screen_h);
 
   /* Draw keyboard */
   if (keyboard_visible)
@@ -463,6 +573,15 @@ void psp_refresh_screen()
       pspVideoPrint(&PspStockFont, tape_icon_offset, 0, PSP_CHAR_TAPE, PSP_COLOR_GREEN);
   }
 
+  if (Display)
+  {
+    /* Let the GE run; psp_refresh_finish() shows the frame before the
+       next one is emulated */
+    pspVideoFinish();
+    render_pending = 1;
+    return;
+  }
+
   pspVideoEnd();
 
   /* Swap buffers */
@@ -482,6 +601,7 @@ int video_init()
 
 void video_shutdown()
 {
+  psp_refresh_finish();
 }
 
 int video_arch_cmdline_options_init(void)
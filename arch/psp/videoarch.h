@@ -24,6 +24,7 @@ typedef struct video_canvas_s video_canvas_t;
 
 extern void psp_input_poll();
 extern void psp_refresh_screen();
+extern void psp_refresh_finish();
 extern void psp_reset_viewport(PspViewport *port, int show_border);
 
 #endif
@@ -72,6 +72,8 @@ void vsyncarch_display_speed(double speed, double frame_rate, int warp_enabled)
 /* Sleep a number of timer units. */
 void vsyncarch_sleep(unsigned long delay)
 {
+  /* Show the frame the GE is drawing before idling */
+  psp_refresh_finish();
   sceKernelDelayThread(delay);
 }
 
@@ -80,8 +82,10 @@ void vsyncarch_presync(void)
     psp_input_poll();
     kbdbuf_flush();
 
-    /* Refresh screen */
-    psp_refresh_screen();
+    /* Refresh screen; with run-ahead, the last speculative frame is shown
+       instead */
+    if (!psp_run_ahead_active())
+        psp_refresh_screen();
 }
 
 void_hook_t vsync_set_event_dispatcher(void_hook_t hook)
@@ -93,6 +97,9 @@ void_hook_t vsync_set_event_dispatcher(void_hook_t hook)
 
 void vsyncarch_postsync(void)
 {
+    /* Show the frame now, unless vsyncarch_sleep() already did */
+    psp_refresh_finish();
+
     /* Dispatch all the pending UI events.  */
     ui_dispatch_events();
 }
@@ -1331,6 +1331,16 @@ int machine_read_snapshot(const char *name, int event_mode)
     return c64_snapshot_read(name, event_mode);
 }
 
+int machine_write_snapshot_stream(struct snapshot_stream_s *f, int save_roms, int save_disks, int event_mode)
+{
+    return c64_snapshot_write_stream(f, save_roms, save_disks, event_mode);
+}
+
+int machine_read_snapshot_stream(struct snapshot_stream_s *f, int event_mode)
+{
+    return c64_snapshot_read_stream(f, event_mode);
+}
+
 /* ------------------------------------------------------------------------- */
 /* FIXME: those two shouldnt be here anymore */
 int machine_autodetect_psid(const char *name)
@@ -66,16 +66,29 @@ static unsigned int order = 0;
 
 /* ---------------------------------------------------------------------------------------------------------- */
 
-static io_source_list_t c64io_d000_head = { NULL, NULL, NULL };
-static io_source_list_t c64io_d100_head = { NULL, NULL, NULL };
-static io_source_list_t c64io_d200_head = { NULL, NULL, NULL };
-static io_source_list_t c64io_d300_head = { NULL, NULL, NULL };
-static io_source_list_t c64io_d400_head = { NULL, NULL, NULL };
-static io_source_list_t c64io_d500_head = { NULL, NULL, NULL };
-static io_source_list_t c64io_d600_head = { NULL, NULL, NULL };
-static io_source_list_t c64io_d700_head = { NULL, NULL, NULL };
-static io_source_list_t c64io_de00_head = { NULL, NULL, NULL };
-static io_source_list_t c64io_df00_head = { NULL, NULL, NULL };
+/* Each page keeps a table of the device handling every address, so that
+   accesses only walk the list where devices overlap. The tables are
+   rebuilt whenever a device is registered or unregistered; a device that
+   changes its address range must re-register. */
+typedef struct io_page_s {
+    io_source_list_t head;      /* must be first, see io_page_of() */
+    io_source_t *read_table[0x100];
+    io_source_t *store_table[0x100];
+} io_page_t;
+
+/* table entry for addresses claimed by more than one device */
+static io_source_t io_source_overlap;
+
+static io_page_t c64io_d000;
+static io_page_t c64io_d100;
+static io_page_t c64io_d200;
+static io_page_t c64io_d300;
+static io_page_t c64io_d400;
+static io_page_t c64io_d500;
+static io_page_t c64io_d600;
+static io_page_t c64io_d700;
+static io_page_t c64io_de00;
+static io_page_t c64io_df00;
 
 static void io_source_detach(io_source_detach_t *source)
 {
@@ -292,7 +305,8 @@ static void io_source_log_collisions(uint16_t addr, int amount, io_source_list_t
     }
 }
 
-static inline uint8_t io_read(io_source_list_t *list, uint16_t addr)
+/* read from all devices of the list, handling collisions */
+static uint8_t io_read_list(io_source_list_t *list, uint16_t addr)
 {
     io_source_list_t *current = list->next;
     int io_source_counter = 0;
@@ -302,8 +316,6 @@ static inline uint8_t io_read(io_source_list_t *list, uint16_t addr)
     uint8_t firstval = 0;
     unsigned int lowest_order = 0xffffffff;
 
-    vicii_handle_pending_alarms_external(0);
-
     while (current) {
         if (current->device->read != NULL) {
             if ((addr >= current->device->start_address) && (addr <= current->device->end_address)) {
@@ -371,6 +383,30 @@ static inline uint8_t io_read(io_source_list_t *list, uint16_t addr)
     return vicii_read_phi1();
 }
 
+static inline uint8_t io_read(io_page_t *page, uint16_t addr)
+{
+    io_source_t *device = page->read_table[addr & 0xff];
+    uint8_t retval;
+
+    vicii_handle_pending_alarms_external(0);
+
+    if (device == NULL) {
+        return vicii_read_phi1();
+    }
+
+    if (device != &io_source_overlap
+        && addr >= device->start_address && addr <= device->end_address) {
+        /* a single device, no collision possible */
+        retval = device->read((uint16_t)(addr & device->address_mask));
+        if (device->io_source_valid) {
+            return retval;
+        }
+        return vicii_read_phi1();
+    }
+
+    return io_read_list(&page->head, addr);
+}
+
 /* peek from I/O area with no side-effects */
 static inline uint8_t io_peek(io_source_list_t *list, uint16_t addr)
 {
@@ -390,15 +426,14 @@ static inline uint8_t io_peek(io_source_list_t *list, uint16_t addr)
     return vicii_read_phi1();
 }
 
-static inline void io_store(io_source_list_t *list, uint16_t addr, uint8_t value)
+/* write to all devices of the list */
+static void io_store_list(io_source_list_t *list, uint16_t addr, uint8_t value)
 {
     int writes = 0;
     uint16_t addy = 0xffff;
     io_source_list_t *current = list->next;
     void (*store)(uint16_t address, uint8_t data) = NULL;
 
-    vicii_handle_pending_alarms_external_write();
-
     while (current) {
         if (current->device->store != NULL) {
             if (addr >= current->device->start_address && addr <= current->device->end_address) {
@@ -420,6 +455,73 @@ static inline void io_store(io_source_list_t *list, uint16_t addr, uint8_t value
     }
 }
 
+static inline void io_store(io_page_t *page, uint16_t addr, uint8_t value)
+{
+    io_source_t *device = page->store_table[addr & 0xff];
+
+    vicii_handle_pending_alarms_external_write();
+
+    if (device == NULL) {
+        return;
+    }
+
+    if (device != &io_source_overlap
+        && addr >= device->start_address && addr <= device->end_address) {
+        device->store((uint16_t)(addr & device->address_mask), value);
+        return;
+    }
+
+    io_store_list(&page->head, addr, value);
+}
+
+/* ---------------------------------------------------------------------------------------------------------- */
+
+static inline io_page_t *io_page_of(io_source_list_t *item)
+{
+    while (item->previous != NULL) {
+        item = item->previous;
+    }
+    return (io_page_t *)item;
+}
+
+static void io_table_add(io_source_t **table, io_source_t *device)
+{
+    unsigned int i, first, last;
+
+    if (device->end_address < device->start_address) {
+        return;
+    }
+
+    first = device->start_address & 0xff;
+    if ((device->end_address & 0xff00) != (device->start_address & 0xff00)) {
+        last = 0xff;
+    } else {
+        last = device->end_address & 0xff;
+    }
+
+    for (i = first; i <= last; i++) {
+        table[i] = (table[i] == NULL) ? device : &io_source_overlap;
+    }
+}
+
+/* rebuild the dispatch tables of a page from its device list */
+static void io_page_update(io_page_t *page)
+{
+    io_source_list_t *current;
+
+    memset(page->read_table, 0, sizeof(page->read_table));
+    memset(page->store_table, 0, sizeof(page->store_table));
+
+    for (current = page->head.next; current != NULL; current = current->next) {
+        if (current->device->read != NULL) {
+            io_table_add(page->read_table, current->device);
+        }
+        if (current->device->store != NULL) {
+            io_table_add(page->store_table, current->device);
+        }
+    }
+}
+
 /* ---------------------------------------------------------------------------------------------------------- */
 
 io_source_list_t *io_source_register(io_source_t *device)
@@ -432,34 +534,34 @@ io_source_list_t *io_source_register(io_source_t *device)
 
     switch (device->start_address & 0xff00) {
         case 0xd000:
-            current = &c64io_d000_head;
+            current = &c64io_d000.head;
             break;
         case 0xd100:
-            current = &c64io_d100_head;
+            current = &c64io_d100.head;
             break;
         case 0xd200:
-            current = &c64io_d200_head;
+            current = &c64io_d200.head;
             break;
         case 0xd300:
-            current = &c64io_d300_head;
+            current = &c64io_d300.head;
             break;
         case 0xd400:
-            current = &c64io_d400_head;
+            current = &c64io_d400.head;
             break;
         case 0xd500:
-            current = &c64io_d500_head;
+            current = &c64io_d500.head;
             break;
         case 0xd600:
-            current = &c64io_d600_head;
+            current = &c64io_d600.head;
             break;
         case 0xd700:
-            current = &c64io_d700_head;
+            current = &c64io_d700.head;
             break;
         case 0xde00:
-            current = &c64io_de00_head;
+            current = &c64io_de00.head;
             break;
         case 0xdf00:
-            current = &c64io_df00_head;
+            current = &c64io_df00.head;
             break;
     }
 
@@ -472,16 +574,21 @@ io_source_list_t *io_source_register(io_source_t *device)
     retval->next = NULL;
     retval->device->order = order++;
 
+    io_page_update(io_page_of(retval));
+
     return retval;
 }
 
 void io_source_unregister(io_source_list_t *device)
 {
     io_source_list_t *prev;
+    io_page_t *page;
 
     assert(device != NULL);
     DBG(("IO: unregister id:%d name:%s\n", device->device->cart_id, device->device->name));
 
+    page = io_page_of(device);
+
     prev = device->previous;
     prev->next = device->next;
 
@@ -496,70 +603,72 @@ void io_source_unregister(io_source_list_t *device)
     }
 
     lib_free(device);
+
+    io_page_update(page);
 }
 
 void cartio_shutdown(void)
 {
     io_source_list_t *current;
 
-    current = c64io_d000_head.next;
+    current = c64io_d000.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_d000_head.next;
+        current = c64io_d000.head.next;
     }
 
-    current = c64io_d100_head.next;
+    current = c64io_d100.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_d100_head.next;
+        current = c64io_d100.head.next;
     }
 
-    current = c64io_d200_head.next;
+    current = c64io_d200.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_d200_head.next;
+        current = c64io_d200.head.next;
     }
 
-    current = c64io_d300_head.next;
+    current = c64io_d300.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_d300_head.next;
+        current = c64io_d300.head.next;
     }
 
-    current = c64io_d400_head.next;
+    current = c64io_d400.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_d400_head.next;
+        current = c64io_d400.head.next;
     }
 
-    current = c64io_d500_head.next;
+    current = c64io_d500.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_d500_head.next;
+        current = c64io_d500.head.next;
     }
 
-    current = c64io_d600_head.next;
+    current = c64io_d600.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_d600_head.next;
+        current = c64io_d600.head.next;
     }
 
-    current = c64io_d700_head.next;
+    current = c64io_d700.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_d700_head.next;
+        current = c64io_d700.head.next;
     }
 
-    current = c64io_de00_head.next;
+    current = c64io_de00.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_de00_head.next;
+        current = c64io_de00.head.next;
     }
 
-    current = c64io_df00_head.next;
+    current = c64io_df00.head.next;
     while (current) {
         io_source_unregister(current);
-        current = c64io_df00_head.next;
+        current = c64io_df00.head.next;
     }
 }
 
@@ -573,181 +682,181 @@ void cartio_set_highest_order(unsigned int nr)
 uint8_t c64io_d000_read(uint16_t addr)
 {
     DBGRW(("IO: io-d000 r %04x\n", addr));
-    return io_read(&c64io_d000_head, addr);
+    return io_read(&c64io_d000, addr);
 }
 
 uint8_t c64io_d000_peek(uint16_t addr)
 {
     DBGRW(("IO: io-d000 p %04x\n", addr));
-    return io_peek(&c64io_d000_head, addr);
+    return io_peek(&c64io_d000.head, addr);
 }
 
 void c64io_d000_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-d000 w %04x %02x\n", addr, value));
-    io_store(&c64io_d000_head, addr, value);
+    io_store(&c64io_d000, addr, value);
 }
 
 uint8_t c64io_d100_read(uint16_t addr)
 {
     DBGRW(("IO: io-d100 r %04x\n", addr));
-    return io_read(&c64io_d100_head, addr);
+    return io_read(&c64io_d100, addr);
 }
 
 uint8_t c64io_d100_peek(uint16_t addr)
 {
     DBGRW(("IO: io-d100 p %04x\n", addr));
-    return io_peek(&c64io_d100_head, addr);
+    return io_peek(&c64io_d100.head, addr);
 }
 
 void c64io_d100_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-d100 w %04x %02x\n", addr, value));
-    io_store(&c64io_d100_head, addr, value);
+    io_store(&c64io_d100, addr, value);
 }
 
 uint8_t c64io_d200_read(uint16_t addr)
 {
     DBGRW(("IO: io-d200 r %04x\n", addr));
-    return io_read(&c64io_d200_head, addr);
+    return io_read(&c64io_d200, addr);
 }
 
 uint8_t c64io_d200_peek(uint16_t addr)
 {
     DBGRW(("IO: io-d200 p %04x\n", addr));
-    return io_peek(&c64io_d200_head, addr);
+    return io_peek(&c64io_d200.head, addr);
 }
 
 void c64io_d200_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-d200 w %04x %02x\n", addr, value));
-    io_store(&c64io_d200_head, addr, value);
+    io_store(&c64io_d200, addr, value);
 }
 
 uint8_t c64io_d300_read(uint16_t addr)
 {
     DBGRW(("IO: io-d300 r %04x\n", addr));
-    return io_read(&c64io_d300_head, addr);
+    return io_read(&c64io_d300, addr);
 }
 
 uint8_t c64io_d300_peek(uint16_t addr)
 {
     DBGRW(("IO: io-d300 p %04x\n", addr));
-    return io_peek(&c64io_d300_head, addr);
+    return io_peek(&c64io_d300.head, addr);
 }
 
 void c64io_d300_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-d300 w %04x %02x\n", addr, value));
-    io_store(&c64io_d300_head, addr, value);
+    io_store(&c64io_d300, addr, value);
 }
 
 uint8_t c64io_d400_read(uint16_t addr)
 {
     DBGRW(("IO: io-d400 r %04x\n", addr));
-    return io_read(&c64io_d400_head, addr);
+    return io_read(&c64io_d400, addr);
 }
 
 uint8_t c64io_d400_peek(uint16_t addr)
 {
     DBGRW(("IO: io-d400 p %04x\n", addr));
-    return io_peek(&c64io_d400_head, addr);
+    return io_peek(&c64io_d400.head, addr);
 }
 
 void c64io_d400_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-d400 w %04x %02x\n", addr, value));
-    io_store(&c64io_d400_head, addr, value);
+    io_store(&c64io_d400, addr, value);
 }
 
 uint8_t c64io_d500_read(uint16_t addr)
 {
     DBGRW(("IO: io-d500 r %04x\n", addr));
-    return io_read(&c64io_d500_head, addr);
+    return io_read(&c64io_d500, addr);
 }
 
 uint8_t c64io_d500_peek(uint16_t addr)
 {
     DBGRW(("IO: io-d500 p %04x\n", addr));
-    return io_peek(&c64io_d500_head, addr);
+    return io_peek(&c64io_d500.head, addr);
 }
 
 void c64io_d500_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-d500 w %04x %02x\n", addr, value));
-    io_store(&c64io_d500_head, addr, value);
+    io_store(&c64io_d500, addr, value);
 }
 
 uint8_t c64io_d600_read(uint16_t addr)
 {
     DBGRW(("IO: io-d600 r %04x\n", addr));
-    return io_read(&c64io_d600_head, addr);
+    return io_read(&c64io_d600, addr);
 }
 
 uint8_t c64io_d600_peek(uint16_t addr)
 {
     DBGRW(("IO: io-d600 p %04x\n", addr));
-    return io_peek(&c64io_d600_head, addr);
+    return io_peek(&c64io_d600.head, addr);
 }
 
 void c64io_d600_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-d600 w %04x %02x\n", addr, value));
-    io_store(&c64io_d600_head, addr, value);
+    io_store(&c64io_d600, addr, value);
 }
 
 uint8_t c64io_d700_read(uint16_t addr)
 {
     DBGRW(("IO: io-d700 r %04x\n", addr));
-    return io_read(&c64io_d700_head, addr);
+    return io_read(&c64io_d700, addr);
 }
 
 uint8_t c64io_d700_peek(uint16_t addr)
 {
     DBGRW(("IO: io-d700 p %04x\n", addr));
-    return io_peek(&c64io_d700_head, addr);
+    return io_peek(&c64io_d700.head, addr);
 }
 
 void c64io_d700_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-d700 w %04x %02x\n", addr, value));
-    io_store(&c64io_d700_head, addr, value);
+    io_store(&c64io_d700, addr, value);
 }
 
 uint8_t c64io_de00_read(uint16_t addr)
 {
     DBGRW(("IO: io-de00 r %04x\n", addr));
-    return io_read(&c64io_de00_head, addr);
+    return io_read(&c64io_de00, addr);
 }
 
 uint8_t c64io_de00_peek(uint16_t addr)
 {
     DBGRW(("IO: io-de00 p %04x\n", addr));
-    return io_peek(&c64io_de00_head, addr);
+    return io_peek(&c64io_de00.head, addr);
 }
 
 void c64io_de00_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-de00 w %04x %02x\n", addr, value));
-    io_store(&c64io_de00_head, addr, value);
+    io_store(&c64io_de00, addr, value);
 }
 
 uint8_t c64io_df00_read(uint16_t addr)
 {
     DBGRW(("IO: io-df00 r %04x\n", addr));
-    return io_read(&c64io_df00_head, addr);
+    return io_read(&c64io_df00, addr);
 }
 
 uint8_t c64io_df00_peek(uint16_t addr)
 {
     DBGRW(("IO: io-df00 p %04x\n", addr));
-    return io_peek(&c64io_df00_head, addr);
+    return io_peek(&c64io_df00.head, addr);
 }
 
 void c64io_df00_store(uint16_t addr, uint8_t value)
 {
     DBGRW(("IO: io-df00 w %04x %02x\n", addr, value));
-    io_store(&c64io_df00_head, addr, value);
+    io_store(&c64io_df00, addr, value);
 }
 
 /* ---------------------------------------------------------------------------------------------------------- */
@@ -770,16 +879,16 @@ static void io_source_ioreg_add_onelist(struct mem_ioreg_list_s **mem_ioreg_list
 /* add all registered I/O devices to the list for the monitor */
 void io_source_ioreg_add_list(struct mem_ioreg_list_s **mem_ioreg_list)
 {
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d000_head.next);
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d100_head.next);
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d200_head.next);
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d300_head.next);
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d400_head.next);
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d500_head.next);
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d600_head.next);
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d700_head.next);
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_de00_head.next);
-    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_df00_head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d000.head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d100.head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d200.head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d300.head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d400.head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d500.head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d600.head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_d700.head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_de00.head.next);
+    io_source_ioreg_add_onelist(mem_ioreg_list, c64io_df00.head.next);
 }
 
 /* ---------------------------------------------------------------------------------------------------------- */
@@ -130,7 +130,8 @@ static sound_chip_t sid_sound_chip = {
     sid_sound_machine_reset,
     sid_sound_machine_cycle_based,
     sid_sound_machine_channels,
-    1 /* chip enabled */
+    1, /* chip enabled */
+    sid_sound_machine_adjust_sampling_frequency
 };
 
 static uint16_t sid_sound_chip_offset = 0;
@@ -50,6 +50,7 @@
 #include "mem.h"
 #include "monitor.h"
 #include "mos6510.h"
+#include "profile.h"
 #include "rotation.h"
 #include "snapshot.h"
 #include "types.h"
@@ -163,6 +164,7 @@ static void cpu_reset(drive_context_t *drv)
     interrupt_cpu_status_reset(drv->cpu->int_status);
 
     *(drv->clk_ptr) = 6;
+    drv->cpu->idle = 0;
     rotation_reset(drv->drive);
     machine_drive_reset(drv);
 
@@ -176,6 +178,7 @@ void drivecpu_reset_clk(drive_context_t *drv)
     drv->cpu->last_clk = maincpu_clk;
     drv->cpu->last_exc_cycles = 0;
     drv->cpu->stop_clk = 0;
+    drv->cpu->idle = 0;
 }
 
 void drivecpu_reset(drive_context_t *drv)
@@ -293,6 +296,13 @@ inline static uint32_t drive_trap_handler(drive_context_t *drv)
             }
 
             *(drv->clk_ptr) = next_clk;
+
+            /* Nothing but an interrupt can take the DOS out of its idle
+               loop while the motor is off, so stop executing it.  */
+            if (!(drv->drive->byte_ready_active & 0x04)
+                && !drv->cpu->int_status->global_pending_int) {
+                drv->cpu->idle = 1;
+            }
         }
         return 0;
     }
@@ -372,6 +382,9 @@ void drivecpu_execute(drive_context_t *drv, CLOCK clk_value)
     CLOCK cycles;
     int tcycles;
     drivecpu_context_t *cpu;
+#ifdef FEATURE_PROFILING
+    CLOCK profile_start_clk;
+#endif
 
 #define reg_a   (cpu->cpu_regs.a)
 #define reg_x   (cpu->cpu_regs.x)
@@ -402,6 +415,33 @@ void drivecpu_execute(drive_context_t *drv, CLOCK clk_value)
         cpu->cycle_accum &= 0xffff;
     }
 
+    /* While the drive is idle, only alarms can change its state: dispatch
+       them directly instead of running the idle loop in between.  */
+    while (cpu->idle && (int) (*(drv->clk_ptr) - cpu->stop_clk) < 0) {
+        CLOCK next_clk;
+
+        if (cpu->int_status->global_pending_int
+            || drv->drive->idling_method != DRIVE_IDLE_TRAP_IDLE) {
+            cpu->idle = 0;
+            break;
+        }
+
+        next_clk = alarm_context_next_pending_clk(cpu->alarm_context);
+
+        if (next_clk >= cpu->stop_clk) {
+            *(drv->clk_ptr) = cpu->stop_clk;
+        } else {
+            if (next_clk > *(drv->clk_ptr)) {
+                *(drv->clk_ptr) = next_clk;
+            }
+            alarm_context_dispatch(cpu->alarm_context, *(drv->clk_ptr));
+        }
+    }
+
+#ifdef FEATURE_PROFILING
+    profile_start_clk = *(drv->clk_ptr);
+#endif
+
     /* Run drive CPU emulation until the stop_clk clock has been reached.
      * There appears to be a nasty 32-bit overflow problem here, so we
      * paper over it by only considering subtractions of 2nd complement
@@ -420,6 +460,9 @@ void drivecpu_execute(drive_context_t *drv, CLOCK clk_value)
 
 #define ALARM_CONTEXT (cpu->alarm_context)
 
+/* the condition of the loop above, for the threaded opcode dispatch */
+#define CPU_LOOP_CONTINUE() ((int) (CLK - cpu->stop_clk) < 0)
+
 #define JAM() drive_jam(drv)
 
 #define ROM_TRAP_ALLOWED() 1
@@ -452,6 +495,8 @@ void drivecpu_execute(drive_context_t *drv, CLOCK clk_value)
 #include "6510core.c"
     }
 
+    PROFILE_ADD(PROFILE_DRIVE_CYCLES, *(drv->clk_ptr) - profile_start_clk);
+
     cpu->last_clk = clk_value;
     drivecpu_sleep(drv);
 }
@@ -671,6 +716,8 @@ int drivecpu_snapshot_read_module(drive_context_t *drv, snapshot_t *s)
     MOS6510_REGS_SET_PC(&(cpu->cpu_regs), pc);
     MOS6510_REGS_SET_STATUS(&(cpu->cpu_regs), status);
 
+    cpu->idle = 0;
+
     log_message(drv->drive->log, "RESET (For undump).");
 
     interrupt_cpu_status_reset(cpu->int_status);
@@ -45,6 +45,7 @@
 #include "machine.h"
 #include "mem.h"
 #include "monitor.h"
+#include "profile.h"
 #include "r65c02.h"
 #include "rotation.h"
 #include "snapshot.h"
@@ -362,6 +363,9 @@ void drivecpu65c02_execute(drive_context_t *drv, CLOCK clk_value)
     int tcycles;
     drivecpu_context_t *cpu;
     int cpu_type = CPU_R65C02;
+#ifdef FEATURE_PROFILING
+    CLOCK profile_start_clk;
+#endif
 
 #define reg_a   (cpu->cpu_R65C02_regs.a)
 #define reg_x   (cpu->cpu_R65C02_regs.x)
@@ -392,6 +396,10 @@ void drivecpu65c02_execute(drive_context_t *drv, CLOCK clk_value)
         cpu->cycle_accum &= 0xffff;
     }
 
+#ifdef FEATURE_PROFILING
+    profile_start_clk = *(drv->clk_ptr);
+#endif
+
     /* Run drive CPU emulation until the stop_clk clock has been reached.
      * There appears to be a nasty 32-bit overflow problem here, so we
      * paper over it by only considering subtractions of 2nd complement
@@ -432,6 +440,8 @@ void drivecpu65c02_execute(drive_context_t *drv, CLOCK clk_value)
 #include "65c02core.c"
     }
 
+    PROFILE_ADD(PROFILE_DRIVE_CYCLES, *(drv->clk_ptr) - profile_start_clk);
+
     cpu->last_clk = clk_value;
     drivecpu65c02_sleep(drv);
 }
@@ -81,6 +81,11 @@ typedef struct drivecpu_context_s {
 
     CLOCK stop_clk;
 
+    /* Nonzero while the drive firmware sits in its idle loop with the motor
+       off.  The drive clock is then fast-forwarded from alarm to alarm until
+       an interrupt becomes pending or the IEC bus changes.  */
+    int idle;
+
     CLOCK cycle_accum;
     uint8_t *d_bank_base;
     unsigned int d_bank_start;
@@ -227,14 +227,20 @@ static uint8_t iecbus_cpu_read_conf1(CLOCK clock)
 static void iecbus_cpu_write_conf1(uint8_t data, CLOCK clock)
 {
     drive_t *drive;
+    uint8_t old_bus;
 
     drive = drive_context[0]->drive;
     drive_cpu_execute_one(drive_context[0], clock);
 
     DEBUG_IEC_CPU_WRITE(data);
 
+    old_bus = iecbus.cpu_bus;
     iec_update_cpu_bus(data);
 
+    if (old_bus != iecbus.cpu_bus) {
+        drive_context[0]->cpu->idle = 0;
+    }
+
     if (iec_old_atn != (iecbus.cpu_bus & 0x10)) {
         iec_old_atn = iecbus.cpu_bus & 0x10;
         switch (drive->type) {
@@ -285,14 +291,20 @@ static uint8_t iecbus_cpu_read_conf2(CLOCK clock)
 static void iecbus_cpu_write_conf2(uint8_t data, CLOCK clock)
 {
     drive_t *drive;
+    uint8_t old_bus;
 
     drive = drive_context[1]->drive;
     drive_cpu_execute_one(drive_context[1], clock);
 
     DEBUG_IEC_CPU_WRITE(data);
 
+    old_bus = iecbus.cpu_bus;
     iec_update_cpu_bus(data);
 
+    if (old_bus != iecbus.cpu_bus) {
+        drive_context[1]->cpu->idle = 0;
+    }
+
     if (iec_old_atn != (iecbus.cpu_bus & 0x10)) {
         iec_old_atn = iecbus.cpu_bus & 0x10;
         switch (drive->type) {
@@ -344,14 +356,22 @@ static uint8_t iecbus_cpu_read_conf3(CLOCK clock)
 static void iecbus_cpu_write_conf3(uint8_t data, CLOCK clock)
 {
     unsigned int dnr;
+    uint8_t old_bus;
 
     drive_cpu_execute_all(clock);
     serial_iec_device_exec(clock);
 
     DEBUG_IEC_CPU_WRITE(data);
 
+    old_bus = iecbus.cpu_bus;
     iec_update_cpu_bus(data);
 
+    if (old_bus != iecbus.cpu_bus) {
+        for (dnr = 0; dnr < DRIVE_NUM; dnr++) {
+            drive_context[dnr]->cpu->idle = 0;
+        }
+    }
+
     if (iec_old_atn != (iecbus.cpu_bus & 0x10)) {
         iec_old_atn = iecbus.cpu_bus & 0x10;
 
@@ -142,6 +142,12 @@ extern int machine_write_snapshot(const char *name, int save_roms,
 /* Read a snapshot.  */
 extern int machine_read_snapshot(const char *name, int even_mode);
 
+/* Write/read a snapshot to/from a memory stream.  */
+struct snapshot_stream_s;
+extern int machine_write_snapshot_stream(struct snapshot_stream_s *f, int save_roms,
+                                         int save_disks, int event_mode);
+extern int machine_read_snapshot_stream(struct snapshot_stream_s *f, int event_mode);
+
 /* handle pending interrupts - needed by libsid.a.  */
 extern void machine_handle_pending_alarms(int num_write_cycles);
 
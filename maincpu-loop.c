@@ -0,0 +1,186 @@
+/*
+ * maincpu-loop.c - Main loop of the emulated 6510 processor.
+ *
+ * Written by
+ *  Ettore Perazzoli <ettore@comm2000.it>
+ *  Andreas Boose <viceteam@t-online.de>
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/* This file is included by maincpu.c, once for every instance of the main
+   loop.  MAINCPU_LOOP is the name of the function to define and
+   CPU_MEMHISTORY selects whether it records cpu history and the memory
+   map.  With `resume' set the registers are taken from maincpu_regs
+   instead of resetting the machine.  */
+
+static void MAINCPU_LOOP(int resume)
+{
+#ifndef C64DTV
+    /* Notice that using a struct for these would make it a lot slower (at
+       least, on gcc 2.7.2.x).  */
+    uint8_t reg_a = 0;
+    uint8_t reg_x = 0;
+    uint8_t reg_y = 0;
+#else
+    int reg_a_read_idx = 0;
+    int reg_a_write_idx = 0;
+    int reg_x_idx = 2;
+    int reg_y_idx = 1;
+
+#define reg_a_write(c)                      \
+    do {                                    \
+        dtv_registers[reg_a_write_idx] = c; \
+        if (reg_a_write_idx >= 3) {         \
+            maincpu_resync_limits();        \
+        }                                   \
+    } while (0);
+#define reg_a_read dtv_registers[reg_a_read_idx]
+#define reg_x_write(c)                \
+    do {                              \
+        dtv_registers[reg_x_idx] = c; \
+        if (reg_x_idx >= 3) {         \
+            maincpu_resync_limits();  \
+        }                             \
+    } while (0);
+
+#define reg_x_read dtv_registers[reg_x_idx]
+#define reg_y_write(c)                \
+    do {                              \
+        dtv_registers[reg_y_idx] = c; \
+        if (reg_y_idx >= 3) {         \
+            maincpu_resync_limits();  \
+        }                             \
+    } while (0);
+#define reg_y_read dtv_registers[reg_y_idx]
+#endif
+    uint8_t reg_p = 0;
+    uint8_t reg_sp = 0;
+    uint8_t flag_n = 0;
+    uint8_t flag_z = 0;
+#ifndef NEED_REG_PC
+    unsigned int reg_pc;
+#endif
+    uint8_t *bank_base;
+    int bank_start = 0;
+    int bank_limit = 0;
+
+    o_bank_base = &bank_base;
+    o_bank_start = &bank_start;
+    o_bank_limit = &bank_limit;
+
+    if (resume) {
+        /* coming back from the other instance of the main loop */
+        goto import_registers;
+    }
+
+    machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+
+#ifdef PSP
+    while (!ExitPSP) {
+#else
+    while (1) {
+#endif
+
+#define CLK maincpu_clk
+#define RMW_FLAG maincpu_rmw_flag
+#define LAST_OPCODE_INFO last_opcode_info
+#define LAST_OPCODE_ADDR last_opcode_addr
+#define TRACEFLG debug.maincpu_traceflg
+
+#define CPU_INT_STATUS maincpu_int_status
+
+#define ALARM_CONTEXT maincpu_alarm_context
+
+#define CHECK_PENDING_ALARM() (CLK >= alarm_context_next_pending_clk(ALARM_CONTEXT))
+
+/* for the threaded opcode dispatch in 6510core.c: the checks and the
+   per-opcode work at the end of this loop */
+#ifdef PSP
+#define CPU_LOOP_CONTINUE() (!ExitPSP && !maincpu_clk_limit)
+#else
+#define CPU_LOOP_CONTINUE() (!maincpu_clk_limit)
+#endif
+
+#define CPU_LOOP_TAIL()                              \
+    do {                                             \
+        PROFILE_INC(PROFILE_CPU_INSTRUCTIONS);       \
+        maincpu_int_status->num_dma_per_opcode = 0;  \
+    } while (0)
+
+#define CHECK_PENDING_INTERRUPT() check_pending_interrupt(maincpu_int_status)
+
+#define TRAP(addr) maincpu_int_status->trap_func(addr);
+
+#define ROM_TRAP_HANDLER() traps_handler()
+
+#define JAM()                                                         \
+    do {                                                              \
+        unsigned int tmp;                                             \
+                                                                      \
+        EXPORT_REGISTERS();                                           \
+        tmp = machine_jam("   " CPU_STR ": JAM at $%04X   ", reg_pc); \
+        switch (tmp) {                                                \
+            case JAM_RESET:                                           \
+                DO_INTERRUPT(IK_RESET);                               \
+                break;                                                \
+            case JAM_HARD_RESET:                                      \
+                mem_powerup();                                        \
+                DO_INTERRUPT(IK_RESET);                               \
+                break;                                                \
+            case JAM_MONITOR:                                         \
+                monitor_startup(e_comp_space);                        \
+                IMPORT_REGISTERS();                                   \
+                break;                                                \
+            default:                                                  \
+                CLK++;                                                \
+        }                                                             \
+    } while (0)
+
+#define CALLER e_comp_space
+
+#define ROM_TRAP_ALLOWED() mem_rom_trap_allowed((uint16_t)reg_pc)
+
+#define GLOBAL_REGS maincpu_regs
+
+#include "6510core.c"
+
+        PROFILE_INC(PROFILE_CPU_INSTRUCTIONS);
+
+        maincpu_int_status->num_dma_per_opcode = 0;
+
+        if (maincpu_clk_limit && (maincpu_clk > maincpu_clk_limit)) {
+            log_error(LOG_DEFAULT, "cycle limit reached.");
+            exit(EXIT_FAILURE);
+        }
+#if 0
+        if (CLK > 246171754) {
+            debug.maincpu_traceflg = 1;
+        }
+#endif
+        continue;
+
+import_registers:
+        /* only reached from the top of the function; IMPORT_REGISTERS()
+           is defined by 6510core.c above */
+        IMPORT_REGISTERS();
+    }
+}
+
@@ -46,6 +46,7 @@
 #include "mos6510.h"
 #endif
 #include "h6809regs.h"
+#include "profile.h"
 #include "snapshot.h"
 #include "traps.h"
 #include "types.h"
@@ -87,25 +88,31 @@
 #ifdef FEATURE_CPUMEMHISTORY
 #ifndef C64DTV /* FIXME: fix DTV and remove this */
 
-/* map access functions to memmap hooks */
+/* map access functions to memmap hooks in the tracing instance of the
+   main loop; CPU_MEMHISTORY is a constant, so the plain instance keeps
+   the direct accesses */
 #ifndef STORE
-#define STORE(addr, value) \
-    memmap_mem_store(addr, value)
+#define STORE(addr, value)                                                                \
+    (CPU_MEMHISTORY ? memmap_mem_store(addr, value)                                       \
+                    : (*_mem_write_tab_ptr[(addr) >> 8])((uint16_t)(addr), (uint8_t)(value)))
 #endif
 
 #ifndef LOAD
-#define LOAD(addr) \
-    memmap_mem_read(addr)
+#define LOAD(addr)                           \
+    (CPU_MEMHISTORY ? memmap_mem_read(addr)  \
+                    : (*_mem_read_tab_ptr[(addr) >> 8])((uint16_t)(addr)))
 #endif
 
 #ifndef STORE_ZERO
-#define STORE_ZERO(addr, value) \
-    memmap_mem_store((addr) & 0xff, value)
+#define STORE_ZERO(addr, value)                                              \
+    (CPU_MEMHISTORY ? memmap_mem_store((addr) & 0xff, value)                 \
+                    : (*_mem_write_tab_ptr[0])((uint16_t)(addr), (uint8_t)(value)))
 #endif
 
 #ifndef LOAD_ZERO
-#define LOAD_ZERO(addr) \
-    memmap_mem_read((addr) & 0xff)
+#define LOAD_ZERO(addr)                                     \
+    (CPU_MEMHISTORY ? memmap_mem_read((addr) & 0xff)        \
+                    : (*_mem_read_tab_ptr[0])((uint16_t)(addr)))
 #endif
 
 #endif /* C64DTV */
@@ -402,131 +409,58 @@ void maincpu_resync_limits(void)
     }
 }
 
-void maincpu_mainloop(void)
-{
-#ifndef C64DTV
-    /* Notice that using a struct for these would make it a lot slower (at
-       least, on gcc 2.7.2.x).  */
-    uint8_t reg_a = 0;
-    uint8_t reg_x = 0;
-    uint8_t reg_y = 0;
-#else
-    int reg_a_read_idx = 0;
-    int reg_a_write_idx = 0;
-    int reg_x_idx = 2;
-    int reg_y_idx = 1;
-
-#define reg_a_write(c)                      \
-    do {                                    \
-        dtv_registers[reg_a_write_idx] = c; \
-        if (reg_a_write_idx >= 3) {         \
-            maincpu_resync_limits();        \
-        }                                   \
-    } while (0);
-#define reg_a_read dtv_registers[reg_a_read_idx]
-#define reg_x_write(c)                \
-    do {                              \
-        dtv_registers[reg_x_idx] = c; \
-        if (reg_x_idx >= 3) {         \
-            maincpu_resync_limits();  \
-        }                             \
-    } while (0);
-
-#define reg_x_read dtv_registers[reg_x_idx]
-#define reg_y_write(c)                \
-    do {                              \
-        dtv_registers[reg_y_idx] = c; \
-        if (reg_y_idx >= 3) {         \
-            maincpu_resync_limits();  \
-        }                             \
-    } while (0);
-#define reg_y_read dtv_registers[reg_y_idx]
-#endif
-    uint8_t reg_p = 0;
-    uint8_t reg_sp = 0;
-    uint8_t flag_n = 0;
-    uint8_t flag_z = 0;
-#ifndef NEED_REG_PC
-    unsigned int reg_pc;
-#endif
-    uint8_t *bank_base;
-    int bank_start = 0;
-    int bank_limit = 0;
-
-    o_bank_base = &bank_base;
-    o_bank_start = &bank_start;
-    o_bank_limit = &bank_limit;
-
-    machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
-
 #ifdef PSP
-    extern int ExitPSP;
-    while (!ExitPSP) {
-#else
-    while (1) {
+extern int ExitPSP;
 #endif
 
-#define CLK maincpu_clk
-#define RMW_FLAG maincpu_rmw_flag
-#define LAST_OPCODE_INFO last_opcode_info
-#define LAST_OPCODE_ADDR last_opcode_addr
-#define TRACEFLG debug.maincpu_traceflg
-
-#define CPU_INT_STATUS maincpu_int_status
-
-#define ALARM_CONTEXT maincpu_alarm_context
-
-#define CHECK_PENDING_ALARM() (clk >= next_alarm_clk(maincpu_int_status))
-
-#define CHECK_PENDING_INTERRUPT() check_pending_interrupt(maincpu_int_status)
-
-#define TRAP(addr) maincpu_int_status->trap_func(addr);
-
-#define ROM_TRAP_HANDLER() traps_handler()
-
-#define JAM()                                                         \
-    do {                                                              \
-        unsigned int tmp;                                             \
-                                                                      \
-        EXPORT_REGISTERS();                                           \
-        tmp = machine_jam("   " CPU_STR ": JAM at $%04X   ", reg_pc); \
-        switch (tmp) {                                                \
-            case JAM_RESET:                                           \
-                DO_INTERRUPT(IK_RESET);                               \
-                break;                                                \
-            case JAM_HARD_RESET:                                      \
-                mem_powerup();                                        \
-                DO_INTERRUPT(IK_RESET);                               \
-                break;                                                \
-            case JAM_MONITOR:                                         \
-                monitor_startup(e_comp_space);                        \
-                IMPORT_REGISTERS();                                   \
-                break;                                                \
-            default:                                                  \
-                CLK++;                                                \
-        }                                                             \
+#ifdef FEATURE_CPUMEMHISTORY
+/* The main loop is built twice, once plain and once recording cpu history
+   and the memory map for the monitor, so that the tracing costs nothing
+   while it is switched off.  An instance returns to maincpu_mainloop()
+   when the "CPUMemHistory" resource asks for the other one; this is
+   noticed at the next pending interrupt, and the resource raises a trap
+   so that there is one at the next instruction.  */
+#define CPU_CHECK_VARIANT()                                 \
+    do {                                                    \
+        if (monitor_cpuhistory_enabled != CPU_MEMHISTORY) { \
+            EXPORT_REGISTERS();                             \
+            return;                                         \
+        }                                                   \
     } while (0)
 
-#define CALLER e_comp_space
-
-#define ROM_TRAP_ALLOWED() mem_rom_trap_allowed((uint16_t)reg_pc)
-
-#define GLOBAL_REGS maincpu_regs
+#undef CPU_MEMHISTORY
+#define CPU_MEMHISTORY 1
+#define MAINCPU_LOOP maincpu_mainloop_history
+#include "maincpu-loop.c"
+#undef MAINCPU_LOOP
+#endif
 
-#include "6510core.c"
+#undef CPU_MEMHISTORY
+#define CPU_MEMHISTORY 0
+#define MAINCPU_LOOP maincpu_mainloop_plain
+#include "maincpu-loop.c"
+#undef MAINCPU_LOOP
 
-        maincpu_int_status->num_dma_per_opcode = 0;
+void maincpu_mainloop(void)
+{
+#ifdef FEATURE_CPUMEMHISTORY
+    int resume = 0;
 
-        if (maincpu_clk_limit && (maincpu_clk > maincpu_clk_limit)) {
-            log_error(LOG_DEFAULT, "cycle limit reached.");
-            exit(EXIT_FAILURE);
-        }
-#if 0
-        if (CLK > 246171754) {
-            debug.maincpu_traceflg = 1;
-        }
+#ifdef PSP
+    while (!ExitPSP) {
+#else
+    while (1) {
 #endif
+        if (monitor_cpuhistory_enabled) {
+            maincpu_mainloop_history(resume);
+        } else {
+            maincpu_mainloop_plain(resume);
+        }
+        resume = 1;
     }
+#else
+    maincpu_mainloop_plain(0);
+#endif
 }
 
 /* ------------------------------------------------------------------------- */
@@ -215,6 +215,9 @@ extern void monitor_cpuhistory_store(unsigned int addr, unsigned int op, unsigne
 extern void monitor_cpuhistory_fix_p2(unsigned int p2);
 extern void monitor_memmap_store(unsigned int addr, unsigned int type);
 
+/* nonzero while the "CPUMemHistory" resource has the main CPU trace */
+extern int monitor_cpuhistory_enabled;
+
 /* memmap defines */
 #define MEMMAP_I_O_R    (1 << 8)
 #define MEMMAP_I_O_W    (1 << 7)
@@ -66,10 +66,37 @@ struct checkpoint_list_s {
 };
 typedef struct checkpoint_list_s checkpoint_list_t;
 
+/* Lookup structure rebuilt from a checkpoint list whenever checkpoints are
+   added or removed.  The bitmap has a bit set for every address covered
+   by at least one checkpoint, so that the common case of an access that
+   hits nothing costs a single test.  The ranges are sorted by start
+   address; max_end is the highest end address of this and all previous
+   ranges, which allows a binary search for the first range that may
+   contain an address.  Ranges that wrap around $ffff are split in two. */
+struct checkpoint_range_s {
+    unsigned int start;
+    unsigned int end;
+    unsigned int max_end;
+    checkpoint_t *checkpt;
+};
+typedef struct checkpoint_range_s checkpoint_range_t;
+
+struct checkpoint_index_s {
+    uint8_t *bitmap;
+    checkpoint_range_t *ranges;
+    unsigned int count;
+};
+typedef struct checkpoint_index_s checkpoint_index_t;
+
+#define CHECKPOINT_BITMAP_SIZE (0x10000 / 8)
+
 static int breakpoint_count;
 static checkpoint_list_t *breakpoints[NUM_MEMSPACES];
 static checkpoint_list_t *watchpoints_load[NUM_MEMSPACES];
 static checkpoint_list_t *watchpoints_store[NUM_MEMSPACES];
+static checkpoint_index_t breakpoints_index[NUM_MEMSPACES];
+static checkpoint_index_t watchpoints_load_index[NUM_MEMSPACES];
+static checkpoint_index_t watchpoints_store_index[NUM_MEMSPACES];
 
 
 void mon_breakpoint_init(void)
@@ -140,8 +167,92 @@ static checkpoint_t *find_checkpoint(int brknum)
     return NULL;
 }
 
+static void add_checkpoint_range(checkpoint_index_t *index, checkpoint_t *cp,
+                                 unsigned int start, unsigned int end)
+{
+    checkpoint_range_t *range;
+    unsigned int addr;
+
+    range = &(index->ranges[index->count++]);
+    range->start = start;
+    range->end = end;
+    range->checkpt = cp;
+
+    for (addr = start; addr <= end; addr++) {
+        index->bitmap[addr >> 3] |= 1 << (addr & 7);
+    }
+}
+
+static int compare_checkpoint_ranges(const void *p1, const void *p2)
+{
+    const checkpoint_range_t *range1 = p1;
+    const checkpoint_range_t *range2 = p2;
+
+    if (range1->start != range2->start) {
+        return (range1->start < range2->start) ? -1 : 1;
+    }
+
+    return range1->checkpt->checknum - range2->checkpt->checknum;
+}
+
+static void build_checkpoint_index(checkpoint_index_t *index, checkpoint_list_t *head)
+{
+    checkpoint_list_t *ptr;
+    unsigned int i, count, start, end, max_end;
+
+    lib_free(index->ranges);
+    index->ranges = NULL;
+    index->count = 0;
+
+    if (head == NULL) {
+        lib_free(index->bitmap);
+        index->bitmap = NULL;
+        return;
+    }
+
+    if (index->bitmap == NULL) {
+        index->bitmap = lib_malloc(CHECKPOINT_BITMAP_SIZE);
+    }
+    memset(index->bitmap, 0, CHECKPOINT_BITMAP_SIZE);
+
+    count = 0;
+    for (ptr = head; ptr; ptr = ptr->next) {
+        count += 2;
+    }
+    index->ranges = lib_malloc(count * sizeof(checkpoint_range_t));
+
+    for (ptr = head; ptr; ptr = ptr->next) {
+        start = addr_location(ptr->checkpt->start_addr);
+        end = start;
+        if (mon_is_valid_addr(ptr->checkpt->end_addr)) {
+            end = addr_location(ptr->checkpt->end_addr);
+        }
+
+        if (end < start) {
+            add_checkpoint_range(index, ptr->checkpt, start, 0xffff);
+            start = 0;
+        }
+        add_checkpoint_range(index, ptr->checkpt, start, end);
+    }
+
+    qsort(index->ranges, index->count, sizeof(checkpoint_range_t),
+          compare_checkpoint_ranges);
+
+    max_end = 0;
+    for (i = 0; i < index->count; i++) {
+        if (index->ranges[i].end > max_end) {
+            max_end = index->ranges[i].end;
+        }
+        index->ranges[i].max_end = max_end;
+    }
+}
+
 static void update_checkpoint_state(MEMSPACE mem)
 {
+    build_checkpoint_index(&(breakpoints_index[mem]), breakpoints[mem]);
+    build_checkpoint_index(&(watchpoints_load_index[mem]), watchpoints_load[mem]);
+    build_checkpoint_index(&(watchpoints_store_index[mem]), watchpoints_store[mem]);
+
     if (watchpoints_load[mem] != NULL || watchpoints_store[mem] != NULL) {
         monitor_mask[mem] |= MI_WATCH;
         mon_interfaces[mem]->toggle_watchpoints_func(
@@ -389,11 +500,38 @@ static int compare_checkpoints(checkpoint_t *bp1, checkpoint_t *bp2)
     return 0;
 }
 
+/* Collect the numbers of the checkpoints in `index' covering `addr', in
+   order of their start address.  Returns the number of hits.  */
+static unsigned int find_checkpoint_hits(checkpoint_index_t *index, unsigned int addr, int *hits)
+{
+    unsigned int lo, hi, mid, i, count;
+
+    /* first range that may reach up to addr */
+    lo = 0;
+    hi = index->count;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (index->ranges[mid].max_end < addr) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    count = 0;
+    for (i = lo; i < index->count && index->ranges[i].start <= addr; i++) {
+        if (index->ranges[i].end >= addr) {
+            hits[count++] = index->ranges[i].checkpt->checknum;
+        }
+    }
+
+    return count;
+}
+
 bool mon_breakpoint_check_checkpoint(MEMSPACE mem, unsigned int addr, unsigned int lastpc, MEMORY_OP op)
 {
-    checkpoint_list_t *ptr;
     checkpoint_t *cp;
-    checkpoint_list_t *list;
+    checkpoint_index_t *index;
     monitor_cpu_type_t *monitor_cpu;
     bool must_stop = FALSE;
     MON_ADDR instpc;
@@ -402,35 +540,48 @@ bool mon_breakpoint_check_checkpoint(MEMSPACE mem, unsigned int addr, unsigned i
     const char *op_str;
     const char *action_str;
     int monbank = mon_interfaces[mem]->current_bank;
-
-    monitor_cpu = monitor_cpu_for_memspace[mem];
-    instpc = new_addr(mem, (monitor_cpu->mon_register_get_val)(mem, e_PC));
-    loadstorepc = new_addr(mem, lastpc);
+    int hits_buf[16];
+    int *hits;
+    unsigned int hit, hit_count;
 
     switch (op) {
         case e_load:
-            list = watchpoints_load[mem];
+            index = &(watchpoints_load_index[mem]);
             op_str = "load";
             is_loadstore = 1;
             break;
 
         case e_store:
-            list = watchpoints_store[mem];
+            index = &(watchpoints_store_index[mem]);
             op_str = "store";
             is_loadstore = 1;
             break;
 
         default: /* e_exec */
-            list = breakpoints[mem];
+            index = &(breakpoints_index[mem]);
             op_str = "exec";
             break;
     }
 
-    ptr = search_checkpoint_list(list, addr);
+    if (index->bitmap == NULL || addr > 0xffff
+        || !(index->bitmap[addr >> 3] & (1 << (addr & 7)))) {
+        return FALSE;
+    }
+
+    /* Take the hits by number, as commands and temporary checkpoints may
+       change the checkpoints (and the index) while they are handled.  */
+    hits = hits_buf;
+    if (index->count > sizeof(hits_buf) / sizeof(hits_buf[0])) {
+        hits = lib_malloc(index->count * sizeof(int));
+    }
+    hit_count = find_checkpoint_hits(index, addr, hits);
+
+    monitor_cpu = monitor_cpu_for_memspace[mem];
+    instpc = new_addr(mem, (monitor_cpu->mon_register_get_val)(mem, e_PC));
+    loadstorepc = new_addr(mem, lastpc);
 
-    while (ptr && mon_is_in_range(ptr->checkpt->start_addr, ptr->checkpt->end_addr, addr)) {
-        cp = ptr->checkpt;
-        ptr = ptr->next;
+    for (hit = 0; hit < hit_count; hit++) {
+        cp = find_checkpoint(hits[hit]);
         if (cp && cp->enabled == e_ON) {
             /* If condition test fails, skip this checkpoint */
             if (cp->condition) {
@@ -490,6 +641,10 @@ bool mon_breakpoint_check_checkpoint(MEMSPACE mem, unsigned int addr, unsigned i
         }
     }
 
+    if (hits != hits_buf) {
+        lib_free(hits);
+    }
+
     return must_stop;
 }
 
@@ -623,6 +778,7 @@ void mon_breakpoint_unset(MON_ADDR address)
     if (ptr) {
         /* there's a breakpoint, so remove it */
         remove_checkpoint_from_list( &breakpoints[mem], ptr->checkpt );
+        update_checkpoint_state(mem);
     }
 }
 
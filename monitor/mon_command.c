@@ -144,6 +144,13 @@ static const mon_cmds_t mon_cmd_array[] = {
       IDGS_MON_NEXT_DESCRIPTION,
       NULL, NULL },
 
+    { "profile", "prof",
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      "[reset]", 0,
+      { IDGS_UNUSED, IDGS_UNUSED, IDGS_UNUSED, IDGS_UNUSED },
+      IDGS_MON_PROFILE_DESCRIPTION,
+      NULL, NULL },
+
     { "registers", "r",
       USE_PARAM_ID, USE_DESCRIPTION_ID,
       "[<%s> = <%s> [, <%s> = <%s>]*]", 4,
@@ -361,8 +361,8 @@ static void yynoreturn yy_fatal_error (yyconst char* msg  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 296
-#define YY_END_OF_BUFFER 297
+#define YY_NUM_RULES 297
+#define YY_END_OF_BUFFER 298
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -370,168 +370,169 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_acclist[1430] =
+static yyconst flex_int16_t yy_acclist[1437] =
     {   0,
-      116,  286,  116,  286,  116,  116,  116,  116,   97,  116,
-       97,  116,  116,  116,  116,  286,  116,  286,  116,  241,
-      286,  116,  241,  286,  116,  286,  116,  286,  116,  286,
-      116,  286,  116,  119,  116,  119,  115,  116,  115,  116,
-      116,  116,  297,  295,  296,  116,  296,  117,  295,  296,
-       95,  295,  296,  295,  296,  295,  296,  295,  296,  295,
-      296,  293,  295,  296,  295,  296,  286,  288,  291,  295,
-      296,  283,  286,  288,  291,  295,  296,  288,  291,  295,
-      296,  288,  291,  295,  296,   86,  295,  296,  292,  295,
-      296,  291,  295,  296,  109,  291,  295,  296,  291,  295,
-
-      296,  108,  291,  295,  296,  291,  295,  296,  106,  295,
-      296,  295,  296,  295,  296,  107,  295,  296,  295,  296,
-      295,  296,  295,  296,  295,  296,  295,  296,    1,  295,
-      296,    3,  295,  296,   38,  295,  296,    4,  295,  296,
-        5,   85,  295,  296,   85,  295,  296,   21,   85,  295,
-      296,   26,   85,  295,  296,   85,  295,  296,   36,   85,
-      295,  296,   37,   85,  295,  296,   39,   85,  295,  296,
-       40,   85,  295,  296,   85,  295,  296,   85,  295,  296,
-       46,   85,  295,  296,   48,   85,  295,  296,   55,   85,
-      295,  296,   57,   85,  295,  296,   85,  295,  296,   62,
-
-       85,  295,  296,   69,   85,  295,  296,   53,   85,  295,
-      296,   85,  295,  296,   82,   85,  295,  296,   34,   85,
-      295,  296,   85,  295,  296,   75,   85,  295,  296,    2,
-      295,  296,   97,  295,  296,   97,  116,  296,   96,  295,
-      296,   97,  293,  295,  296,   97,  292,  295,  296,  120,
-      295,  296,  120,  293,  295,  296,  120,  292,  295,  296,
-      277,  295,  296,  273,  295,  296,  274,  295,  296,  280,
-      295,  296,  281,  295,  296,  295,  296,  283,  286,  288,
-      291,  295,  296,  288,  291,  295,  296,  278,  295,  296,
-      279,  295,  296,  291,  295,  296,16646,  263,  291,  295,
-
-      296,  264,  291,  295,  296,  265,  291,  295,  296,  266,
-      291,  295,  296,  291,  295,  296,  295,  296,  267,  295,
-      296,  295,  296,  268,  295,  296,  269,  295,  296,  270,
-      295,  296,  271,  295,  296,  272,  295,  296,  275,  295,
-      296,  276,  295,  296,  295,  296,  295,  296,  237,  295,
-      296,  238,  295,  296,  241,  286,  288,  291,  295,  296,
-      178,  295,  296,  292,  295,  296,  179,  295,  296,  183,
-      241,  291,  295,  296,  190,  241,  291,  295,  296,  191,
-      241,  291,  295,  296,  211,  241,  291,  295,  296,  195,
-      241,  291,  295,  296,  226,  241,  291,  295,  296,  241,
-
-      295,  296,  231,  241,  295,  296,  220,  241,  295,  296,
-      232,  241,  295,  296,  241,  295,  296,  241,  295,  296,
-      228,  241,  295,  296,  221,  241,  295,  296,  241,  295,
-      296,  213,  241,  295,  296,  229,  241,  295,  296,  227,
-      241,  295,  296,  184,  241,  295,  296,  185,  241,  295,
-      296,  239,  295,  296,  240,  295,  296,  295,  296,  121,
-      291,  295,  296,  128,  291,  295,  296,  129,  291,  295,
-      296,  149,  291,  295,  296,  133,  291,  295,  296,  164,
-      291,  295,  296,  169,  295,  296,  158,  295,  296,  170,
-      295,  296,  295,  296,  295,  296,  166,  295,  296,  159,
-
-      295,  296,  295,  296,  151,  295,  296,  167,  295,  296,
-      165,  295,  296,  122,  295,  296,  123,  295,  296,  295,
-      296,  119,  295,  296,  119,  295,  296,  119,  295,  296,
-      119,  295,  296,  119,  295,  296,  115,  295,  296,  104,
-      295,  296,  102,  295,  296,  103,  295,  296,  105,  295,
-      296,  116,  290,  284,  285,  287,   98,  100,  101,   99,
-      261,  286,  288,  291,  288,  291,  291,  283,  286,  288,
-      291,  283,  286,  288,  291,  111,  112,  110,   94,   87,
-      289,   85,   85,    6,   85,   85,   85,   85,   13,   85,
-       11,   85,   12,   85,   14,   85,   15,   85,   16,   85,
-
-       85,   18,   85,   85,   19,   85,   85,   85,   85,   85,
-       28,   85,   85,   33,   85,   85,   85,   85,   85,   85,
-       85,   41,   85,   43,   85,   85,   85,   47,   85,   85,
-       25,   85,   85,   49,   85,   85,   85,   85,   54,   85,
-       85,   56,   85,   85,   85,   85,   85,   85,   85,   85,
-       71,   85,   85,   85,   85,   70,   85,   85,   77,   85,
-       85,   79,   85,   80,   85,   85,   85,   97,   97,  116,
-      120,  283,  286,  288,  291, 8454,  260,  291,  250,  260,
-      291,  260,  251,  260,  291,  252,  260,  291,  253,  260,
-      254,  260,  257,  260,  260,  289,  176,  181,  241,  286,
-
-      288,  291,  241,  291,  241,  177,  175,  180,  241,  291,
-      214,  241,  291,  215,  241,  291,  189,  241,  291,  241,
-      291,  216,  241,  291,  212,  241,  188,  241,  217,  241,
-      218,  241,  219,  241,  230,  241,  241,  186,  241,  196,
-      197,  198,  199,  200,  201,  202,  187,  241,  241,  289,
-      241,  182,  291,  152,  291,  153,  291,  127,  291,  291,
-      154,  291,  150,  126,  155,  156,  157,  168,  124,  134,
-      135,  136,  137,  138,  139,  140,  125,  294,  119,  119,
-      119,  115,  261,  286,  288,  291,  288,  291,  291,  283,
-      286,  288,  291,  113,  114,   88,  118,   85,   85,   85,
-
-       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
-       23,   85,   27,   85,   85,   29,   85,   25,   85,   31,
-       85,   85,   85,   85,   35,   85,   85,   85,   85,   85,
-       85,   85,   85,   85,   85,   48,   85,   85,   85,   85,
-       85,   85,   85,   58,   85,   85,   60,   85,   61,   85,
-       85,   85,   68,   85,   85,   85,   74,   85,   73,   85,
-       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
-      260,  291,  260,  255,  260,  256,  260,  258,  260,  259,
-      260,  241,  286,  288,  291,  241,  291,  209,  241,  222,
-      291,  223,  291,  194,  241,  224,  291,  192,  241,  225,
-
-      233,  241,  234,  241,  235,  241,  236,  241,  193,  241,
-      203,  204,  205,  206,  207,  208,  210,  241,  147,  160,
-      291,  161,  291,  132,  162,  291,  130,  163,  172,  171,
-      174,  173,  131,  141,  142,  143,  144,  145,  146,  148,
-      286,  288,  291,  288,  291,  291,  283,  286,  288,  291,
-       92,   90,   85,   85,   85,   85,   10,   85,   85,   85,
-       85,   85,   85,   24,   85,   85,   85,   85,   22,   85,
-       85,   85,   85,   85,   85,   32,   85,   85,   34,   85,
-       85,   36,   85,   37,   85,   38,   85,   39,   85,   85,
-       85,   45,   85,   46,   85,   85,   85,   85,   85,   85,
-
-       51,   85,   85,   53,   85,   55,   85,   85,   85,   59,
-       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
-       69,   85,   85,   85,   85,   85,   75,   85,   76,   85,
-       85,   85,   85,   85,   85,   85,  260,  291,  260,  241,
-      286,  288,  291,  241,  291,  286,  288,  291,  288,  291,
-      291,  283,  286,  288,  291,   93,   91,   85,   85,   85,
-       85,   85,   11,   85,   85,   13,   85,   14,   85,   85,
-       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
-       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
-       52,   85,   85,   57,   85,   60,   85,   85,   85,   63,
-
-       85,   85,   85,   85,   85,   85,   85,   85,   85,   72,
-       85,   85,   85,   85,   85,   79,   85,   85,   80,   85,
-       82,   85,   85,  246,  241,  286,  288,  291,  241,  291,
-      286,  288,  291,  288,  291,  291,  283,  286,  288,  291,
-       89,   85,    7,   85,   85,   85,   85,   85,   85,   85,
-       85,   85,   85,   85,   27,   85,   30,   85,   29,   85,
-       85,   26,   85,   33,   85,   35,   85,   42,   85,   44,
-       85,   85,   85,   85,   85,   85,   85,   50,   85,   85,
-       61,   85,   85,   64,   85,   85,   85,   85,   65,   85,
-       68,   85,   85,   85,   71,   85,   85,   74,   85,   85,
-
-       85,   81,   85,   85,  242,  249,  247,  241,  286,  288,
-      291,  241,  291,  286,  288,  291,  288,  291,  291,  283,
-      286,  288,  291,   85,   85,   85,   85,   85,   85,   85,
-       85,   20,   85,   21,   85,   85,   85,   85,   31,   85,
-       85,   85,   85,   49,   85,   85,   85,   85,   85,   85,
-       66,   85,   85,   67,   85,   85,   85,   85,   85,   85,
-       85,   83,   85,  248,  241,  286,  288,  291,  241,  291,
-      282,  286,  288,  291,  282,  288,  291,  282,  291,  282,
-      283,  286,  288,  291,   85,    9,   85,   85,   85,   85,
-       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
-
-       85,   85,   85,   56,   85,   85,   85,   85,   85,   85,
-       85,   85,   78,   85,  245,  241,  282,  286,  288,  291,
-      241,  282,  291,  286,  288,  291,  288,  291,  291,  283,
-      286,  288,  291,    6,   85,    8,   85,   15,   85,   85,
-       85,   85,   85,   22,   85,   85,   85,   85,   85,   85,
-       85,   85,   52,   85,   54,   85,   62,   85,   85,   85,
-       85,   85,   85,   85,   77,   85,  244,  243,  241,  286,
-      288,  291,  241,  291,   12,   85,   85,   17,   85,   85,
-       24,   85,   85,   85,   85,   85,   50,   85,   51,   85,
-       85,   85,   85,   85,   72,   85,   85,   16,   85,   85,
-
-       85,   47,   85,   85,   85,   64,   85,   65,   85,   70,
-       85,   85,   73,   85,   19,   85,   28,   85,   85,   85,
-       85,   85,   84,   85,   85,   66,   85,   67,   85
+      117,  287,  117,  287,  117,  117,  117,  117,   98,  117,
+       98,  117,  117,  117,  117,  287,  117,  287,  117,  242,
+      287,  117,  242,  287,  117,  287,  117,  287,  117,  287,
+      117,  287,  117,  120,  117,  120,  116,  117,  116,  117,
+      117,  117,  298,  296,  297,  117,  297,  118,  296,  297,
+       96,  296,  297,  296,  297,  296,  297,  296,  297,  296,
+      297,  294,  296,  297,  296,  297,  287,  289,  292,  296,
+      297,  284,  287,  289,  292,  296,  297,  289,  292,  296,
+      297,  289,  292,  296,  297,   87,  296,  297,  293,  296,
+      297,  292,  296,  297,  110,  292,  296,  297,  292,  296,
+
+      297,  109,  292,  296,  297,  292,  296,  297,  107,  296,
+      297,  296,  297,  296,  297,  108,  296,  297,  296,  297,
+      296,  297,  296,  297,  296,  297,  296,  297,    1,  296,
+      297,    3,  296,  297,   38,  296,  297,    4,  296,  297,
+        5,   86,  296,  297,   86,  296,  297,   21,   86,  296,
+      297,   26,   86,  296,  297,   86,  296,  297,   36,   86,
+      296,  297,   37,   86,  296,  297,   39,   86,  296,  297,
+       40,   86,  296,  297,   86,  296,  297,   86,  296,  297,
+       46,   86,  296,  297,   48,   86,  296,  297,   55,   86,
+      296,  297,   57,   86,  296,  297,   86,  296,  297,   63,
+
+       86,  296,  297,   70,   86,  296,  297,   53,   86,  296,
+      297,   86,  296,  297,   83,   86,  296,  297,   34,   86,
+      296,  297,   86,  296,  297,   76,   86,  296,  297,    2,
+      296,  297,   98,  296,  297,   98,  117,  297,   97,  296,
+      297,   98,  294,  296,  297,   98,  293,  296,  297,  121,
+      296,  297,  121,  294,  296,  297,  121,  293,  296,  297,
+      278,  296,  297,  274,  296,  297,  275,  296,  297,  281,
+      296,  297,  282,  296,  297,  296,  297,  284,  287,  289,
+      292,  296,  297,  289,  292,  296,  297,  279,  296,  297,
+      280,  296,  297,  292,  296,  297,16647,  264,  292,  296,
+
+      297,  265,  292,  296,  297,  266,  292,  296,  297,  267,
+      292,  296,  297,  292,  296,  297,  296,  297,  268,  296,
+      297,  296,  297,  269,  296,  297,  270,  296,  297,  271,
+      296,  297,  272,  296,  297,  273,  296,  297,  276,  296,
+      297,  277,  296,  297,  296,  297,  296,  297,  238,  296,
+      297,  239,  296,  297,  242,  287,  289,  292,  296,  297,
+      179,  296,  297,  293,  296,  297,  180,  296,  297,  184,
+      242,  292,  296,  297,  191,  242,  292,  296,  297,  192,
+      242,  292,  296,  297,  212,  242,  292,  296,  297,  196,
+      242,  292,  296,  297,  227,  242,  292,  296,  297,  242,
+
+      296,  297,  232,  242,  296,  297,  221,  242,  296,  297,
+      233,  242,  296,  297,  242,  296,  297,  242,  296,  297,
+      229,  242,  296,  297,  222,  242,  296,  297,  242,  296,
+      297,  214,  242,  296,  297,  230,  242,  296,  297,  228,
+      242,  296,  297,  185,  242,  296,  297,  186,  242,  296,
+      297,  240,  296,  297,  241,  296,  297,  296,  297,  122,
+      292,  296,  297,  129,  292,  296,  297,  130,  292,  296,
+      297,  150,  292,  296,  297,  134,  292,  296,  297,  165,
+      292,  296,  297,  170,  296,  297,  159,  296,  297,  171,
+      296,  297,  296,  297,  296,  297,  167,  296,  297,  160,
+
+      296,  297,  296,  297,  152,  296,  297,  168,  296,  297,
+      166,  296,  297,  123,  296,  297,  124,  296,  297,  296,
+      297,  120,  296,  297,  120,  296,  297,  120,  296,  297,
+      120,  296,  297,  120,  296,  297,  116,  296,  297,  105,
+      296,  297,  103,  296,  297,  104,  296,  297,  106,  296,
+      297,  117,  291,  285,  286,  288,   99,  101,  102,  100,
+      262,  287,  289,  292,  289,  292,  292,  284,  287,  289,
+      292,  284,  287,  289,  292,  112,  113,  111,   95,   88,
+      290,   86,   86,    6,   86,   86,   86,   86,   13,   86,
+       11,   86,   12,   86,   14,   86,   15,   86,   16,   86,
+
+       86,   18,   86,   86,   19,   86,   86,   86,   86,   86,
+       28,   86,   86,   33,   86,   86,   86,   86,   86,   86,
+       86,   41,   86,   43,   86,   86,   86,   47,   86,   86,
+       25,   86,   86,   49,   86,   86,   86,   86,   54,   86,
+       86,   56,   86,   86,   86,   86,   86,   86,   86,   86,
+       72,   86,   86,   86,   86,   71,   86,   86,   78,   86,
+       86,   80,   86,   81,   86,   86,   86,   98,   98,  117,
+      121,  284,  287,  289,  292, 8455,  261,  292,  251,  261,
+      292,  261,  252,  261,  292,  253,  261,  292,  254,  261,
+      255,  261,  258,  261,  261,  290,  177,  182,  242,  287,
+
+      289,  292,  242,  292,  242,  178,  176,  181,  242,  292,
+      215,  242,  292,  216,  242,  292,  190,  242,  292,  242,
+      292,  217,  242,  292,  213,  242,  189,  242,  218,  242,
+      219,  242,  220,  242,  231,  242,  242,  187,  242,  197,
+      198,  199,  200,  201,  202,  203,  188,  242,  242,  290,
+      242,  183,  292,  153,  292,  154,  292,  128,  292,  292,
+      155,  292,  151,  127,  156,  157,  158,  169,  125,  135,
+      136,  137,  138,  139,  140,  141,  126,  295,  120,  120,
+      120,  116,  262,  287,  289,  292,  289,  292,  292,  284,
+      287,  289,  292,  114,  115,   89,  119,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       23,   86,   27,   86,   86,   29,   86,   25,   86,   31,
+       86,   86,   86,   86,   35,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   48,   86,   86,   86,   86,
+       86,   86,   86,   59,   86,   86,   61,   86,   62,   86,
+       86,   86,   69,   86,   86,   86,   75,   86,   74,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+      261,  292,  261,  256,  261,  257,  261,  259,  261,  260,
+      261,  242,  287,  289,  292,  242,  292,  210,  242,  223,
+      292,  224,  292,  195,  242,  225,  292,  193,  242,  226,
+
+      234,  242,  235,  242,  236,  242,  237,  242,  194,  242,
+      204,  205,  206,  207,  208,  209,  211,  242,  148,  161,
+      292,  162,  292,  133,  163,  292,  131,  164,  173,  172,
+      175,  174,  132,  142,  143,  144,  145,  146,  147,  149,
+      287,  289,  292,  289,  292,  292,  284,  287,  289,  292,
+       93,   91,   86,   86,   86,   86,   10,   86,   86,   86,
+       86,   86,   86,   24,   86,   86,   86,   86,   22,   86,
+       86,   86,   86,   86,   86,   32,   86,   86,   34,   86,
+       86,   36,   86,   37,   86,   38,   86,   39,   86,   86,
+       86,   45,   86,   46,   86,   86,   86,   86,   86,   86,
+
+       51,   86,   86,   53,   86,   55,   86,   86,   86,   60,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       70,   86,   86,   86,   86,   86,   76,   86,   77,   86,
+       86,   86,   86,   86,   86,   86,  261,  292,  261,  242,
+      287,  289,  292,  242,  292,  287,  289,  292,  289,  292,
+      292,  284,  287,  289,  292,   94,   92,   86,   86,   86,
+       86,   86,   11,   86,   86,   13,   86,   14,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       52,   86,   86,   57,   86,   61,   86,   86,   86,   64,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   73,
+       86,   86,   86,   86,   86,   80,   86,   86,   81,   86,
+       83,   86,   86,  247,  242,  287,  289,  292,  242,  292,
+      287,  289,  292,  289,  292,  292,  284,  287,  289,  292,
+       90,   86,    7,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   27,   86,   30,   86,   29,   86,
+       86,   26,   86,   33,   86,   35,   86,   42,   86,   44,
+       86,   86,   86,   86,   86,   86,   86,   50,   86,   86,
+       62,   86,   86,   65,   86,   86,   86,   86,   66,   86,
+       69,   86,   86,   86,   72,   86,   86,   75,   86,   86,
+
+       86,   82,   86,   86,  243,  250,  248,  242,  287,  289,
+      292,  242,  292,  287,  289,  292,  289,  292,  292,  284,
+      287,  289,  292,   86,   86,   86,   86,   86,   86,   86,
+       86,   20,   86,   21,   86,   86,   86,   86,   31,   86,
+       86,   86,   86,   49,   86,   86,   86,   86,   86,   86,
+       67,   86,   86,   68,   86,   86,   86,   86,   86,   86,
+       86,   84,   86,  249,  242,  287,  289,  292,  242,  292,
+      283,  287,  289,  292,  283,  289,  292,  283,  292,  283,
+      284,  287,  289,  292,   86,    9,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   56,   86,   86,   86,   86,   86,   86,
+       86,   86,   79,   86,  246,  242,  283,  287,  289,  292,
+      242,  283,  292,  287,  289,  292,  289,  292,  292,  284,
+      287,  289,  292,    6,   86,    8,   86,   15,   86,   86,
+       86,   86,   86,   22,   86,   86,   86,   86,   86,   86,
+       86,   86,   52,   86,   54,   86,   63,   86,   86,   86,
+       86,   86,   86,   86,   78,   86,  245,  244,  242,  287,
+      289,  292,  242,  292,   12,   86,   86,   17,   86,   86,
+       24,   86,   86,   86,   86,   86,   50,   86,   51,   86,
+       86,   86,   86,   86,   73,   86,   86,   16,   86,   86,
+
+       86,   47,   86,   86,   86,   65,   86,   66,   86,   71,
+       86,   86,   74,   86,   19,   86,   28,   86,   86,   86,
+       86,   86,   85,   86,   86,   67,   86,   68,   86,   86,
+       58,   86,   86,   86,   58,   86
     } ;
 
-static yyconst flex_int16_t yy_accept[830] =
+static yyconst flex_int16_t yy_accept[835] =
     {   0,
         1,    3,    5,    6,    7,    8,    9,   11,   13,   14,
        15,   17,   19,   22,   25,   27,   29,   31,   33,   35,
@@ -623,7 +624,8 @@ static yyconst flex_int16_t yy_accept[830] =
 
      1391, 1392, 1393, 1394, 1395, 1397, 1398, 1400, 1401, 1402,
      1404, 1405, 1406, 1408, 1410, 1412, 1413, 1415, 1417, 1419,
-     1420, 1421, 1422, 1423, 1425, 1426, 1428, 1430, 1430
+     1420, 1421, 1422, 1423, 1425, 1426, 1428, 1430, 1431, 1433,
+     1434, 1435, 1437, 1437
     } ;
 
 static yyconst YY_CHAR yy_ec[256] =
@@ -671,7 +673,7 @@ static yyconst YY_CHAR yy_meta[90] =
        14,   14,   14,   14,   14,   14,   14,    1,    1
     } ;
 
-static yyconst flex_uint16_t yy_base[861] =
+static yyconst flex_uint16_t yy_base[866] =
     {   0,
         0,    0,   88,   93,  123,    0,  211,  216,  224,  229,
       259,    0,  348,    0,  437,    0,  521,    0,  602,  691,
@@ -700,7 +702,7 @@ static yyconst flex_uint16_t yy_base[861] =
         0, 1057, 1062, 1101, 1051, 1370, 1179,    0, 1103, 1067,
      1286, 1187, 1227, 1236, 1235, 1236,    0,    0, 1247, 1254,
         0, 1273,    0, 1287,    0, 1285, 1372, 1277,    0, 1304,
-        0, 1328, 1338, 1344, 1340, 1346, 1402, 1330, 1335, 1371,
+        0, 1328, 3048, 1344, 1340, 1346, 1402, 1330, 1335, 1371,
      1384, 1396,    0, 1396,    0, 1381, 1401, 1424, 1384, 1402,
         0,  238,    0,  523, 1471, 3232, 1502, 1567, 1490,    0,
         0,    0, 1459, 1489,    0, 3232, 3232, 1619, 1353, 1396,
@@ -763,108 +765,110 @@ static yyconst flex_uint16_t yy_base[861] =
 
      2846, 2850, 2852, 2854,    0, 2854,    0, 2855, 2863,    0,
      2873, 2874,    0,    0,    0, 2875,    0,    0,    0, 2875,
-     2876, 2877, 2865,    0, 2866,    0,    0, 3232, 2946, 2961,
-     2976, 2991, 3006,  718, 3016, 3031, 3037, 3052, 3067, 3081,
-     3086, 3101, 3107, 3113, 3120, 3135, 3141, 3156, 3171, 3183,
-     3191, 3202,  997, 3209, 1002, 3217, 1005, 1045, 1061, 1094
+     2876, 2877, 2865,    0, 2866,    0,    0, 1044, 1043, 1046,
+     1059,    0, 3232, 2946, 2961, 2976, 2991, 3006,  718, 3016,
+     3031, 3037, 3052, 3067, 3081, 3086, 3101, 3107, 3113, 3120,
+     3135, 3141, 3156, 3171, 3183, 3191, 3202,  997, 3209, 1002,
+     3217, 1005, 1045, 1061, 1094
     } ;
 
-static yyconst flex_int16_t yy_def[861] =
+static yyconst flex_int16_t yy_def[866] =
     {   0,
-      828,    1,  829,  829,  828,    5,  830,  830,  831,  831,
-      828,   11,  828,   13,  828,   15,    1,   17,  832,  832,
-      833,  833,  829,  829,  828,  828,  828,  828,  828,  834,
-      828,  828,  828,  828,  835,  828,   36,   36,   38,  828,
-      828,   36,   42,   42,   42,   42,  828,  828,  828,  828,
-      828,  828,  828,  828,  836,  828,  828,  828,  828,  837,
-      837,  837,  837,  837,  837,  837,  837,  837,  837,  837,
-      837,  837,  837,  837,  837,  837,  837,  837,  837,  837,
-      837,  837,  837,  828,  838,  838,  828,  838,  838,  839,
-      839,  839,  828,  828,  828,  828,  828,  835,   36,   38,
-
-      828,  828,  840,  840,  104,  104,  104,  104,  840,  109,
-      109,  109,  109,  109,  109,  109,  828,  828,  828,  828,
-      828,  828,  841,  828,  828,  828,  841,  127,  127,  127,
-      127,  127,  841,  841,  134,  134,  134,  134,  134,  841,
-      134,  134,  134,  134,  134,  134,  828,  828,  828,   42,
-       42,   42,   42,   42,   42,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  842,  843,
-      843,  843,  843,  843,  844,  828,  828,  828,  828,  828,
-      834,  828,  828,  828,  828,  828,  828,  828,  845,  828,
-      190,  190,  190,  190,  828,  828,  828,  828,  828,  828,
-
-      828,  828,  828,  828,  828,  828,  846,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      848,  848,  849,  190,  828,  828,  850,  850,  850,  278,
-      278,  279,  279,  279,  279,  828,  828,  841,  288,  134,
-      828,  828,  828,  288,  288,  288,  288,  288,  288,  134,
-
-      134,  134,  134,  134,  134,  134,  134,  828,  828,  828,
-      828,  828,  828,  828,  828,  134,  134,  134,  828,  192,
-      192,  192,  192,  192,  192,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  842,  843,  843,  843,  844,  845,  828,
-      350,  350,  350,  828,  828,  828,  828,  828,  828,  828,
-      828,  846,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  851,  852,  852,  425,  425,  425,  425,  288,
-      430,  134,  352,  352,  134,  352,  134,  828,  134,  134,
-      134,  134,  134,  828,  828,  828,  828,  828,  828,  134,
-      828,  352,  352,  828,  352,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      470,  470,  470,  828,  828,  828,  828,  828,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  853,  854,  828,  472,  828,  430,
-      550,  828,  552,  552,  552,  828,  828,  828,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  855,  856,  828,  828,  857,  550,  619,
-      828,  621,  621,  621,  828,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  828,  858,  828,  828,  828,  828,  619,  678,  828,
-      680,  680,  680,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  828,  859,  828,  678,
-      720,  828,  722,  722,  722,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  860,  828,  720,  755,  722,  723,  724,  722,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  828,  828,  755,  755,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,  847,  847,  847,  847,  847,    0,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828
+      833,    1,  834,  834,  833,    5,  835,  835,  836,  836,
+      833,   11,  833,   13,  833,   15,    1,   17,  837,  837,
+      838,  838,  834,  834,  833,  833,  833,  833,  833,  839,
+      833,  833,  833,  833,  840,  833,   36,   36,   38,  833,
+      833,   36,   42,   42,   42,   42,  833,  833,  833,  833,
+      833,  833,  833,  833,  841,  833,  833,  833,  833,  842,
+      842,  842,  842,  842,  842,  842,  842,  842,  842,  842,
+      842,  842,  842,  842,  842,  842,  842,  842,  842,  842,
+      842,  842,  842,  833,  843,  843,  833,  843,  843,  844,
+      844,  844,  833,  833,  833,  833,  833,  840,   36,   38,
+
+      833,  833,  845,  845,  104,  104,  104,  104,  845,  109,
+      109,  109,  109,  109,  109,  109,  833,  833,  833,  833,
+      833,  833,  846,  833,  833,  833,  846,  127,  127,  127,
+      127,  127,  846,  846,  134,  134,  134,  134,  134,  846,
+      134,  134,  134,  134,  134,  134,  833,  833,  833,   42,
+       42,   42,   42,   42,   42,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  847,  848,
+      848,  848,  848,  848,  849,  833,  833,  833,  833,  833,
+      839,  833,  833,  833,  833,  833,  833,  833,  850,  833,
+      190,  190,  190,  190,  833,  833,  833,  833,  833,  833,
+
+      833,  833,  833,  833,  833,  833,  851,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      853,  853,  854,  190,  833,  833,  855,  855,  855,  278,
+      278,  279,  279,  279,  279,  833,  833,  846,  288,  134,
+      833,  833,  833,  288,  288,  288,  288,  288,  288,  134,
+
+      134,  134,  134,  134,  134,  134,  134,  833,  833,  833,
+      833,  833,  833,  833,  833,  134,  134,  134,  833,  192,
+      192,  192,  192,  192,  192,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  847,  848,  848,  848,  849,  850,  833,
+      350,  350,  350,  833,  833,  833,  833,  833,  833,  833,
+      833,  851,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  856,  857,  857,  425,  425,  425,  425,  288,
+      430,  134,  352,  352,  134,  352,  134,  833,  134,  134,
+      134,  134,  134,  833,  833,  833,  833,  833,  833,  134,
+      833,  352,  352,  833,  352,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      470,  470,  470,  833,  833,  833,  833,  833,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  858,  859,  833,  472,  833,  430,
+      550,  833,  552,  552,  552,  833,  833,  833,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  860,  861,  833,  833,  862,  550,  619,
+      833,  621,  621,  621,  833,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  833,  863,  833,  833,  833,  833,  619,  678,  833,
+      680,  680,  680,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  833,  864,  833,  678,
+      720,  833,  722,  722,  722,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  865,  833,  720,  755,  722,  723,  724,  722,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  833,  833,  755,  755,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      852,  852,  852,  852,  852,  852,  852,  208,  208,  208,
+      208,  208,    0,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833
     } ;
 
 static yyconst flex_uint16_t yy_nxt[3322] =
@@ -928,8 +932,8 @@ static yyconst flex_uint16_t yy_nxt[3322] =
       159,   26,   26,  160,  161,  162,  163,   26,  164,  165,
       166,  167,  168,   26,   26,   26,   26,  191,  191,  191,
       191,  191,  191,  191,  191,  205,   26,  195,   99,  353,
-      353,  206,  233,  353,  353,  100,  100,  696,  169,  828,
-      828,  828,  676,  354,  828,   42,   42,   42,   42,  201,
+      353,  206,  233,  353,  353,  100,  100,  696,  169,  833,
+      833,  833,  676,  354,  833,   42,   42,   42,   42,  201,
       239,   26,   26,  205,  675,   26,  255,  202,   26,  206,
       233,   26,   26,   26,  184,  184,  184,  184,  184,  184,
       184,  184,  184,  184,   42,   42,   42,   42,  201,  239,
@@ -985,214 +989,214 @@ static yyconst flex_uint16_t yy_nxt[3322] =
       192,  192,  213,  252,  298,  289,  206,  299,  289,  253,
       343,  290,  214,  215,  254,  353,  353,  359,  300,  216,
       217,  218,  360,  318,  219,  355,  364,  718,  718,  286,
-      363,  213,  828,  298,  289,  365,  299,  289,  197,  368,
+      363,  213,  833,  298,  289,  365,  299,  289,  197,  368,
       214,  215,  369,  754,  754,  359,  300,  216,  217,  218,
       360,  370,  219,  258,  364,  259,  306,  307,  260,  363,
       261,  262,  366,  365,  263,  371,  290,  368,  372,  373,
 
-      383,  369,  264,  367,  376,  265,  786,  786,  196,  828,
-      370,  828,  258,  828,  259,  306,  307,  260,  828,  261,
-      262,  366,  263,  371,  290,  828,  828,  372,  373,  383,
-      264,  367,  376,  265,  275,  276,  275,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  374,  375,  382,  192,
+      383,  369,  264,  367,  376,  265,  786,  786,  196,  833,
+      370,  829,  258,  830,  259,  306,  307,  260,  831,  261,
+      262,  366,  263,  371,  290,  832,  833,  372,  373,  383,
+      264,  367,  376,  265,  275,  276,  275,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  374,  375,  382,  192,
       192,  192,  192,  192,  192,  192,  192,  192,  192,  276,
       444,  445,  446,  447,  448,  449,  277,  277,  277,  277,
-      277,  278,  828,  828,  374,  375,  382,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  308,  828,  309,  310,
+      277,  278,  833,  833,  374,  375,  382,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  308,  833,  309,  310,
       311,  312,  313,  314,  315,  277,  277,  277,  277,  277,
 
-      278,  828,  828,  828,  302,  334,  828,  335,  336,  337,
-      338,  339,  340,  341,  828,  828,  192,  192,  192,  192,
-      192,  192,  192,  192,  192,  192,  828,  828,  828,  380,
+      278,  833,  833,  833,  302,  334,  833,  335,  336,  337,
+      338,  339,  340,  341,  833,  833,  192,  192,  192,  192,
+      192,  192,  192,  192,  192,  192,  833,  833,  833,  380,
       381,  386,  302,  277,  277,  280,  277,  277,  277,  183,
       183,  183,  183,  183,  183,  183,  183,  184,  184,  184,
       184,  184,  184,  184,  184,  184,  184,  380,  381,  386,
-      828,  828,  277,  277,  280,  277,  277,  277,  828,  828,
-      828,  351,  351,  351,  351,  351,  351,  351,  351,  387,
-      388,  389,  390,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  288,  190,  190,  190,  190,  190,
+      833,  833,  277,  277,  280,  277,  277,  277,  833,  833,
+      833,  351,  351,  351,  351,  351,  351,  351,  351,  387,
+      388,  389,  390,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  288,  190,  190,  190,  190,  190,
 
       190,  190,  191,  191,  391,  392,  393,  387,  388,  389,
       390,  289,  289,  289,  289,  289,  289,  352,  352,  352,
-      352,  352,  352,  352,  352,  352,  352,  384,  394,  828,
-      395,  398,  391,  392,  385,  393,  828,  828,  828,  828,
+      352,  352,  352,  352,  352,  352,  352,  384,  394,  833,
+      395,  398,  391,  392,  385,  393,  833,  833,  833,  833,
       289,  289,  289,  289,  289,  289,  289,  192,  192,  192,
       192,  192,  192,  192,  192,  192,  384,  394,  395,  398,
       399,  400,  385,  289,  289,  294,  289,  289,  295,  431,
-      352,  352,  352,  352,  352,  352,  352,  352,  352,  401,
-      402,  403,  404,  828,  409,  410,  828,  828,  399,  828,
-      400,  828,  289,  289,  294,  289,  289,  295,  350,  350,
+      352,  352,  352,  352,  352,  352,  352,  352,  352,  833,
+      402,  403,  404,  833,  409,  410,  833,  833,  399,  833,
+      400,  833,  289,  289,  294,  289,  289,  295,  350,  350,
 
-      350,  350,  350,  350,  350,  350,  351,  351,  401,  402,
+      350,  350,  350,  350,  350,  350,  351,  351,  833,  402,
       403,  404,  409,  410,  377,  352,  352,  352,  352,  352,
-      352,  828,  378,  396,  379,  828,  828,  411,  412,  417,
-      397,  413,  414,  415,  418,  828,  421,  405,  422,  828,
+      352,  833,  378,  396,  379,  833,  833,  411,  412,  417,
+      397,  413,  414,  415,  418,  833,  421,  405,  422,  833,
       290,  406,  377,  416,  352,  352,  352,  352,  352,  352,
       378,  396,  379,  407,  408,  411,  412,  417,  397,  413,
       419,  414,  415,  418,  421,  474,  405,  422,  290,  475,
-      406,  416,  275,  276,  275,  828,  420,  828,  828,  828,
-      828,  407,  408,  828,  828,  828,  828,  828,  290,  419,
-      828,  828,  828,  423,  474,  828,  828,  276,  475,  426,
+      406,  416,  275,  276,  275,  833,  420,  833,  833,  833,
+      833,  407,  408,  833,  833,  833,  833,  833,  290,  419,
+      833,  833,  833,  423,  474,  833,  833,  276,  475,  426,
 
-      828,  828,  828,  427,  420,  423,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  290,  828,  352,  352,
+      833,  833,  833,  427,  420,  423,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  290,  833,  352,  352,
       352,  352,  352,  352,  352,  352,  352,  352,  426,  428,
       439,  427,  290,  429,  440,  424,  424,  424,  424,  424,
-      424,  828,  431,  352,  352,  352,  352,  352,  352,  352,
-      352,  352,  828,  828,  290,  828,  828,  828,  428,  439,
-      290,  429,  440,  828,  424,  424,  424,  424,  424,  424,
+      424,  833,  431,  352,  352,  352,  352,  352,  352,  352,
+      352,  352,  833,  833,  290,  833,  833,  833,  428,  439,
+      290,  429,  440,  833,  424,  424,  424,  424,  424,  424,
       423,  432,  431,  352,  433,  352,  352,  352,  352,  352,
       352,  352,  290,  352,  352,  352,  352,  352,  352,  352,
-      352,  352,  352,  828,  828,  828,  828,  828,  290,  432,
+      352,  352,  352,  833,  833,  833,  833,  833,  290,  432,
 
       424,  424,  424,  424,  424,  424,  431,  352,  434,  352,
       352,  352,  352,  352,  352,  352,  431,  352,  352,  352,
-      352,  352,  352,  352,  352,  352,  290,  828,  828,  424,
+      352,  352,  352,  352,  352,  352,  290,  833,  833,  424,
       424,  424,  424,  424,  424,  430,  350,  350,  350,  350,
       350,  350,  350,  351,  351,  463,  464,  465,  466,  467,
       468,  290,  431,  431,  431,  431,  431,  431,  431,  352,
       352,  352,  352,  352,  352,  352,  352,  352,  431,  352,
       436,  352,  352,  352,  352,  352,  352,  352,  438,  290,
       451,  431,  431,  431,  431,  431,  431,  290,  454,  290,
-      441,  828,  435,  437,  442,  443,  290,  450,  456,  458,
+      441,  833,  435,  437,  442,  443,  290,  450,  456,  458,
 
-      476,  460,  828,  459,  290,  461,  462,  469,  451,  828,
-      828,  828,  828,  828,  828,  290,  454,  290,  477,  441,
-      435,  437,  442,  443,  290,  450,  456,  828,  458,  476,
+      476,  460,  833,  459,  290,  461,  462,  469,  451,  833,
+      833,  833,  833,  833,  833,  290,  454,  290,  477,  441,
+      435,  437,  442,  443,  290,  450,  456,  833,  458,  476,
       460,  459,  290,  461,  462,  469,  470,  470,  470,  470,
-      470,  470,  470,  470,  471,  471,  477,  828,  478,  480,
-      828,  481,  482,  472,  472,  472,  472,  472,  472,  471,
+      470,  470,  470,  470,  471,  471,  477,  833,  478,  480,
+      833,  481,  482,  472,  472,  472,  472,  472,  472,  471,
       471,  471,  471,  471,  471,  471,  471,  472,  472,  472,
       472,  472,  472,  472,  472,  472,  472,  478,  480,  481,
       482,  483,  472,  472,  472,  472,  472,  472,  484,  486,
-      485,  828,  487,  488,  489,  490,  828,  491,  493,  828,
+      485,  833,  487,  488,  489,  490,  833,  491,  493,  833,
 
-      492,  494,  495,  496,  497,  498,  828,  499,  500,  483,
+      492,  494,  495,  496,  497,  498,  833,  499,  500,  483,
       501,  502,  503,  504,  505,  506,  507,  484,  486,  485,
       487,  488,  489,  508,  490,  491,  509,  493,  492,  510,
       494,  495,  496,  497,  498,  499,  511,  500,  501,  502,
-      503,  504,  505,  506,  507,  512,  515,  517,  518,  828,
+      503,  504,  505,  506,  507,  512,  515,  517,  518,  833,
       519,  520,  508,  516,  509,  513,  521,  522,  510,  523,
-      828,  514,  524,  525,  511,  828,  531,  532,  828,  535,
-      536,  828,  537,  533,  512,  515,  517,  518,  519,  520,
+      833,  514,  524,  525,  511,  833,  531,  532,  833,  535,
+      536,  833,  537,  533,  512,  515,  517,  518,  519,  520,
       538,  539,  516,  513,  521,  522,  541,  534,  523,  514,
       524,  526,  525,  527,  531,  540,  532,  535,  528,  536,
 
-      537,  529,  533,  542,  828,  530,  543,  544,  538,  828,
-      539,  828,  828,  828,  541,  534,  828,  828,  828,  557,
-      526,  290,  527,  828,  540,  547,  528,  828,  828,  529,
-      828,  828,  542,  530,  290,  543,  544,  547,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  557,  290,
+      537,  529,  533,  542,  833,  530,  543,  544,  538,  833,
+      539,  833,  833,  833,  541,  534,  833,  833,  833,  557,
+      526,  290,  527,  833,  540,  547,  528,  833,  833,  529,
+      833,  833,  542,  530,  290,  543,  544,  547,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  557,  290,
       472,  472,  472,  472,  472,  472,  472,  472,  472,  472,
       290,  290,  290,  290,  290,  290,  290,  548,  548,  548,
       548,  548,  548,  551,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  828,  290,  556,  558,  559,  290,  290,
-      563,  290,  290,  290,  290,  828,  548,  548,  548,  548,
+      472,  472,  472,  833,  290,  556,  558,  559,  290,  290,
+      563,  290,  290,  290,  290,  833,  548,  548,  548,  548,
 
       548,  548,  550,  470,  470,  470,  470,  470,  470,  470,
       471,  471,  290,  556,  558,  559,  560,  564,  563,  551,
       551,  551,  551,  551,  551,  553,  553,  553,  553,  553,
       553,  553,  553,  554,  554,  554,  554,  554,  554,  554,
-      554,  554,  554,  828,  828,  560,  564,  828,  551,  551,
+      554,  554,  554,  833,  833,  560,  564,  833,  551,  551,
       551,  551,  551,  551,  552,  552,  552,  552,  552,  552,
-      552,  552,  553,  553,  565,  566,  567,  568,  828,  569,
-      570,  554,  554,  554,  554,  554,  554,  828,  561,  571,
-      572,  573,  828,  574,  579,  562,  575,  576,  828,  580,
+      552,  552,  553,  553,  565,  566,  567,  568,  833,  569,
+      570,  554,  554,  554,  554,  554,  554,  833,  561,  571,
+      572,  573,  833,  574,  579,  562,  575,  576,  833,  580,
       577,  584,  565,  566,  581,  567,  568,  569,  582,  570,
 
       554,  554,  554,  554,  554,  554,  561,  578,  571,  572,
       573,  574,  579,  562,  585,  575,  576,  580,  586,  577,
       584,  587,  581,  588,  589,  590,  582,  591,  592,  593,
-      594,  595,  596,  828,  597,  578,  598,  599,  828,  601,
-      603,  600,  604,  585,  606,  828,  607,  586,  608,  587,
+      594,  595,  596,  833,  597,  578,  598,  599,  833,  601,
+      603,  600,  604,  585,  606,  833,  607,  586,  608,  587,
       609,  588,  589,  610,  590,  591,  592,  593,  594,  595,
-      611,  596,  597,  612,  598,  613,  599,  601,  828,  603,
-      600,  604,  828,  606,  607,  828,  828,  608,  828,  609,
-      828,  610,  828,  828,  625,  626,  627,  828,  611,  628,
-      629,  630,  612,  828,  613,  617,  617,  617,  617,  617,
+      611,  596,  597,  612,  598,  613,  599,  601,  833,  603,
+      600,  604,  833,  606,  607,  833,  833,  608,  833,  609,
+      833,  610,  833,  833,  625,  626,  627,  833,  611,  628,
+      629,  630,  612,  833,  613,  617,  617,  617,  617,  617,
 
       617,  617,  617,  619,  552,  552,  552,  552,  552,  552,
       552,  553,  553,  625,  626,  627,  632,  628,  629,  630,
       620,  620,  620,  620,  620,  620,  620,  554,  554,  554,
       554,  554,  554,  554,  554,  554,  622,  622,  622,  622,
-      622,  622,  622,  622,  632,  828,  828,  828,  828,  620,
+      622,  622,  622,  622,  632,  833,  833,  833,  833,  620,
       620,  620,  620,  620,  620,  621,  621,  621,  621,  621,
       621,  621,  621,  622,  622,  634,  635,  636,  637,  638,
       639,  640,  623,  623,  623,  623,  623,  623,  623,  623,
       623,  623,  623,  623,  623,  623,  623,  623,  641,  642,
-      643,  828,  644,  634,  635,  636,  637,  645,  638,  639,
+      643,  833,  644,  634,  635,  636,  637,  645,  638,  639,
 
-      640,  623,  623,  623,  623,  623,  623,  646,  828,  647,
-      649,  650,  828,  651,  652,  648,  641,  642,  653,  643,
-      644,  654,  655,  828,  656,  657,  645,  658,  828,  659,
+      640,  623,  623,  623,  623,  623,  623,  646,  833,  647,
+      649,  650,  833,  651,  652,  648,  641,  642,  653,  643,
+      644,  654,  655,  833,  656,  657,  645,  658,  833,  659,
       660,  661,  662,  663,  665,  666,  646,  647,  649,  664,
       650,  651,  652,  648,  667,  668,  684,  653,  669,  670,
-      654,  655,  656,  657,  671,  828,  658,  659,  660,  661,
-      662,  663,  665,  666,  685,  686,  687,  664,  690,  828,
-      691,  828,  667,  828,  668,  684,  669,  670,  828,  828,
-      828,  828,  671,  678,  621,  621,  621,  621,  621,  621,
+      654,  655,  656,  657,  671,  833,  658,  659,  660,  661,
+      662,  663,  665,  666,  685,  686,  687,  664,  690,  833,
+      691,  833,  667,  833,  668,  684,  669,  670,  833,  833,
+      833,  833,  671,  678,  621,  621,  621,  621,  621,  621,
       621,  622,  622,  685,  686,  687,  692,  690,  691,  693,
 
       679,  679,  679,  679,  679,  679,  679,  623,  623,  623,
       623,  623,  623,  623,  623,  623,  681,  681,  681,  681,
-      681,  681,  681,  681,  828,  692,  828,  828,  693,  679,
+      681,  681,  681,  681,  833,  692,  833,  833,  693,  679,
       679,  679,  679,  679,  679,  680,  680,  680,  680,  680,
-      680,  680,  680,  681,  681,  688,  694,  828,  695,  700,
+      680,  680,  680,  681,  681,  688,  694,  833,  695,  700,
       689,  697,  682,  682,  682,  682,  682,  682,  682,  682,
       682,  682,  682,  682,  682,  682,  682,  682,  698,  699,
-      828,  701,  702,  688,  704,  694,  695,  700,  689,  703,
+      833,  701,  702,  688,  704,  694,  695,  700,  689,  703,
       697,  682,  682,  682,  682,  682,  682,  705,  706,  707,
-      708,  709,  710,  711,  828,  712,  713,  698,  699,  701,
+      708,  709,  710,  711,  833,  712,  713,  698,  699,  701,
 
-      702,  714,  715,  704,  716,  828,  828,  703,  723,  723,
+      702,  714,  715,  704,  716,  833,  833,  703,  723,  723,
       723,  723,  723,  723,  723,  723,  705,  706,  707,  708,
-      709,  710,  711,  712,  828,  713,  828,  828,  828,  714,
-      715,  828,  828,  716,  720,  680,  680,  680,  680,  680,
-      680,  680,  681,  681,  828,  828,  828,  828,  726,  727,
+      709,  710,  711,  712,  833,  713,  833,  833,  833,  714,
+      715,  833,  833,  716,  720,  680,  680,  680,  680,  680,
+      680,  680,  681,  681,  833,  833,  833,  833,  726,  727,
       729,  721,  721,  721,  721,  721,  721,  721,  682,  682,
       682,  682,  682,  682,  682,  682,  682,  724,  724,  724,
       724,  724,  724,  724,  724,  724,  724,  726,  727,  729,
       721,  721,  721,  721,  721,  721,  722,  722,  722,  722,
-      722,  722,  722,  722,  723,  723,  728,  730,  828,  731,
+      722,  722,  722,  722,  723,  723,  728,  730,  833,  731,
 
-      732,  733,  737,  724,  724,  724,  724,  724,  724,  828,
-      734,  735,  736,  738,  740,  742,  828,  743,  744,  745,
+      732,  733,  737,  724,  724,  724,  724,  724,  724,  833,
+      734,  735,  736,  738,  740,  742,  833,  743,  744,  745,
       746,  741,  747,  749,  728,  748,  730,  731,  750,  732,
       733,  737,  724,  724,  724,  724,  724,  724,  734,  735,
       736,  738,  751,  740,  742,  743,  744,  745,  752,  746,
-      741,  747,  749,  748,  828,  828,  828,  750,  756,  724,
-      724,  724,  724,  724,  724,  724,  724,  724,  828,  828,
-      828,  751,  828,  828,  828,  828,  752,  755,  722,  722,
-      722,  722,  722,  722,  722,  723,  723,  828,  828,  828,
+      741,  747,  749,  748,  833,  833,  833,  750,  756,  724,
+      724,  724,  724,  724,  724,  724,  724,  724,  833,  833,
+      833,  751,  833,  833,  833,  833,  752,  755,  722,  722,
+      722,  722,  722,  722,  722,  723,  723,  833,  833,  833,
       761,  762,  763,  764,  756,  756,  756,  756,  756,  756,
 
       758,  758,  758,  758,  758,  758,  758,  758,  759,  759,
       759,  759,  759,  759,  759,  759,  759,  759,  761,  762,
-      828,  763,  764,  756,  756,  756,  756,  756,  756,  757,
+      833,  763,  764,  756,  756,  756,  756,  756,  756,  757,
       757,  757,  757,  757,  757,  757,  757,  758,  758,  765,
-      828,  766,  767,  828,  768,  769,  759,  759,  759,  759,
-      759,  759,  770,  771,  828,  772,  773,  774,  775,  776,
-      777,  828,  778,  781,  828,  782,  783,  784,  765,  766,
-      785,  767,  768,  769,  828,  759,  759,  759,  759,  759,
+      833,  766,  767,  833,  768,  769,  759,  759,  759,  759,
+      759,  759,  770,  771,  833,  772,  773,  774,  775,  776,
+      777,  833,  778,  781,  833,  782,  783,  784,  765,  766,
+      785,  767,  768,  769,  833,  759,  759,  759,  759,  759,
       759,  770,  771,  772,  773,  774,  775,  776,  779,  777,
       778,  790,  781,  782,  783,  791,  784,  792,  793,  785,
 
       780,  789,  759,  759,  759,  759,  759,  759,  759,  759,
-      759,  794,  795,  828,  796,  797,  798,  779,  828,  828,
-      790,  828,  828,  791,  799,  801,  792,  793,  780,  788,
+      759,  794,  795,  833,  796,  797,  798,  779,  833,  833,
+      790,  833,  833,  791,  799,  801,  792,  793,  780,  788,
       757,  757,  757,  757,  757,  757,  757,  758,  758,  794,
       800,  795,  796,  797,  798,  802,  789,  789,  789,  789,
-      789,  789,  807,  799,  801,  803,  804,  805,  806,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  800,  808,
-      809,  828,  810,  811,  802,  789,  789,  789,  789,  789,
+      789,  789,  807,  799,  801,  803,  804,  805,  806,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  800,  808,
+      809,  833,  810,  811,  802,  789,  789,  789,  789,  789,
       789,  807,  812,  803,  804,  805,  806,  789,  759,  759,
       759,  759,  759,  759,  759,  759,  759,  808,  813,  809,
 
       810,  811,  814,  815,  816,  817,  818,  819,  820,  821,
-      822,  812,  823,  824,  825,  828,  826,  827,  828,  828,
-      828,  828,  828,  828,  828,  828,  813,  828,  828,  828,
-      814,  815,  816,  817,  818,  819,  828,  820,  821,  822,
-      828,  823,  824,  825,  826,  827,   26,   26,   26,   26,
+      822,  812,  823,  824,  825,  833,  826,  827,  833,  833,
+      833,  833,  833,  833,  833,  833,  813,  833,  833,  833,
+      814,  815,  816,  817,  818,  819,  833,  820,  821,  822,
+      833,  823,  824,  825,  826,  827,   26,   26,   26,   26,
        26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
        26,   85,   85,   85,   85,   85,   85,   85,   85,   85,
        85,   85,   85,   85,   85,   85,   90,   90,   90,   90,
@@ -1201,40 +1205,40 @@ static yyconst flex_uint16_t yy_nxt[3322] =
 
       170,  170,  170,  170,  170,  170,  175,  175,  175,  175,
       175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
-      175,  189,  828,  828,  828,  828,  189,  189,  189,  189,
-      189,  207,  207,  828,  207,  207,  207,  207,  207,  207,
-      207,  207,  207,  207,  207,  207,  208,  828,  828,  208,
-      208,  208,  271,  271,  828,  271,  828,  271,  271,  271,
-      271,  271,  271,  271,  271,  271,  271,  273,  273,  828,
+      175,  189,  833,  833,  833,  833,  189,  189,  189,  189,
+      189,  207,  207,  833,  207,  207,  207,  207,  207,  207,
+      207,  207,  207,  207,  207,  207,  208,  833,  833,  208,
+      208,  208,  271,  271,  833,  271,  833,  271,  271,  271,
+      271,  271,  271,  271,  271,  271,  271,  273,  273,  833,
       273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
-      273,  273,  279,  279,  279,  828,  828,  828,  828,  828,
-      279,  279,  828,  279,  279,  290,  828,  828,  290,  290,
+      273,  273,  279,  279,  279,  833,  833,  833,  833,  401,
+      279,  279,  833,  279,  279,  290,  833,  833,  290,  290,
 
-      290,  344,  344,  828,  344,  344,  344,  344,  344,  344,
-      344,  344,  344,  344,  344,  344,  345,  828,  828,  345,
-      345,  345,  348,  828,  828,  348,  348,  348,  349,  349,
-      349,  349,  349,  349,  349,  207,  207,  828,  207,  207,
+      290,  344,  344,  833,  344,  344,  344,  344,  344,  344,
+      344,  344,  344,  344,  344,  344,  345,  833,  401,  345,
+      345,  345,  348,  828,  833,  348,  348,  348,  349,  349,
+      349,  349,  349,  349,  349,  207,  207,  833,  207,  207,
       207,  207,  207,  207,  207,  207,  207,  207,  207,  207,
-      208,  828,  828,  208,  208,  208,  271,  271,  828,  271,
-      828,  271,  271,  271,  271,  271,  271,  271,  271,  271,
-      271,  273,  273,  828,  273,  273,  273,  273,  273,  273,
-      273,  273,  273,  273,  273,  273,  425,  828,  828,  828,
-      828,  828,  425,  828,  828,  425,  425,  546,  828,  828,
-
-      828,  828,  828,  546,  546,  549,  828,  828,  828,  828,
-      828,  549,  828,  828,  549,  549,  616,  828,  828,  828,
-      828,  616,  616,  674,  828,  828,  828,  828,  828,  674,
-      674,   25,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828
+      208,  833,  833,  208,  208,  208,  271,  271,  833,  271,
+      833,  271,  271,  271,  271,  271,  271,  271,  271,  271,
+      271,  273,  273,  833,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  425,  833,  833,  833,
+      833,  833,  425,  833,  833,  425,  425,  546,  833,  833,
+
+      833,  833,  833,  546,  546,  549,  833,  833,  833,  833,
+      833,  549,  833,  833,  549,  549,  616,  833,  833,  833,
+      833,  616,  616,  674,  833,  833,  833,  833,  833,  674,
+      674,   25,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833
     } ;
 
 static yyconst flex_int16_t yy_chk[3322] =
@@ -1318,8 +1322,8 @@ static yyconst flex_int16_t yy_chk[3322] =
 
        20,   20,   20,   20,   20,   20,   20,  106,   20,  106,
       108,  107,  473,  473,  110,   20,   20,   20,   20,   20,
-       20,   20,   20,   20,   60,   71,   20,  834,   71,   63,
-      834,   71,   60,   63,  535,   71,   63,  111,  111,  108,
+       20,   20,   20,   20,   60,   71,   20,  839,   71,   63,
+      839,   71,   60,   63,  535,   71,   63,  111,  111,  108,
        60,   60,  115,  128,  532,   63,  128,  510,  136,  139,
        20,   20,  423,   60,   71,   20,   71,  363,   63,   71,
        60,  362,   63,   71,   63,  111,  111,  151,   60,   60,
@@ -1349,20 +1353,20 @@ static yyconst flex_int16_t yy_chk[3322] =
        36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
       145,  157,  157,  160,  160,   74,  126,   36,   36,   36,
 
-       36,   36,   36,  760,  760,   74,  205,  125,  167,  853,
-      853,   74,  168,  146,  855,  855,   74,  857,  857,  157,
+       36,   36,   36,  760,  760,   74,  205,  125,  167,  858,
+      858,   74,  168,  146,  860,  860,   74,  862,  862,  157,
       157,  124,  160,  160,   74,  146,   36,   36,   36,   36,
        36,   36,   61,   74,  130,  130,  167,  130,  130,   74,
       168,  146,   61,   61,   74,  194,  194,  203,  130,   61,
-       61,   61,  204,  146,   61,  194,  211,  858,  858,  119,
+       61,   61,  204,  146,   61,  194,  211,  863,  863,  119,
       209,   61,  100,  130,  130,  212,  130,  130,   44,  215,
-       61,   61,  216,  859,  859,  203,  130,   61,   61,   61,
+       61,   61,  216,  864,  864,  203,  130,   61,   61,   61,
       204,  217,   61,   77,  211,   77,  138,  138,   77,  209,
        77,   77,  213,  212,   77,  220,  138,  215,  222,  223,
 
-      230,  216,   77,  213,  225,   77,  860,  860,   39,   25,
-      217,    0,   77,    0,   77,  138,  138,   77,    0,   77,
-       77,  213,   77,  220,  138,    0,    0,  222,  223,  230,
+      230,  216,   77,  213,  225,   77,  865,  865,   39,   25,
+      217,  828,   77,  829,   77,  138,  138,   77,  830,   77,
+       77,  213,   77,  220,  138,  831,    0,  222,  223,  230,
        77,  213,  225,   77,  103,  103,  103,  133,  133,  133,
       133,  133,  133,  133,  133,  133,  224,  224,  229,  103,
       103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
@@ -1389,11 +1393,11 @@ static yyconst flex_int16_t yy_chk[3322] =
       123,  123,  123,  123,  123,  123,  127,  127,  127,  127,
       127,  127,  127,  127,  127,  127,  231,  244,  246,  248,
       250,  252,  231,  127,  127,  127,  127,  127,  127,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  253,
+      289,  289,  289,  289,  289,  289,  289,  289,  289,    0,
       254,  255,  256,    0,  258,  259,    0,    0,  250,    0,
       252,    0,  127,  127,  127,  127,  127,  127,  190,  190,
 
-      190,  190,  190,  190,  190,  190,  190,  190,  253,  254,
+      190,  190,  190,  190,  190,  190,  190,  190,    0,  254,
       255,  256,  258,  259,  226,  190,  190,  190,  190,  190,
       190,    0,  226,  247,  226,    0,    0,  260,  261,  266,
       247,  261,  262,  264,  267,    0,  269,  257,  270,    0,
@@ -1562,49 +1566,49 @@ static yyconst flex_int16_t yy_chk[3322] =
       816,  798,  820,  821,  822,    0,  823,  825,    0,    0,
         0,    0,    0,    0,    0,    0,  801,    0,    0,    0,
       802,  803,  804,  806,  808,  809,    0,  811,  812,  816,
-        0,  820,  821,  822,  823,  825,  829,  829,  829,  829,
-      829,  829,  829,  829,  829,  829,  829,  829,  829,  829,
-      829,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  831,  831,  831,  831,
-      831,  831,  831,  831,  831,  831,  831,  831,  831,  831,
-      831,  832,  832,  832,  832,  832,  832,  832,  832,  832,
-
-      832,  832,  832,  832,  832,  832,  833,  833,  833,  833,
+        0,  820,  821,  822,  823,  825,  834,  834,  834,  834,
+      834,  834,  834,  834,  834,  834,  834,  834,  834,  834,
+      834,  835,  835,  835,  835,  835,  835,  835,  835,  835,
+      835,  835,  835,  835,  835,  835,  836,  836,  836,  836,
+      836,  836,  836,  836,  836,  836,  836,  836,  836,  836,
+      836,  837,  837,  837,  837,  837,  837,  837,  837,  837,
+
+      837,  837,  837,  837,  837,  837,  838,  838,  838,  838,
+      838,  838,  838,  838,  838,  838,  838,  838,  838,  838,
+      838,  840,    0,    0,    0,    0,  840,  840,  840,  840,
+      840,  841,  841,    0,  841,  841,  841,  841,  841,  841,
+      841,  841,  841,  841,  841,  841,  842,    0,    0,  842,
+      842,  842,  843,  843,    0,  843,    0,  843,  843,  843,
+      843,  843,  843,  843,  843,  843,  843,  844,  844,    0,
+      844,  844,  844,  844,  844,  844,  844,  844,  844,  844,
+      844,  844,  845,  845,  845,    0,    0,    0,    0,  253,
+      845,  845,    0,  845,  845,  846,    0,    0,  846,  846,
+
+      846,  847,  847,    0,  847,  847,  847,  847,  847,  847,
+      847,  847,  847,  847,  847,  847,  848,    0,  253,  848,
+      848,  848,  849,  253,    0,  849,  849,  849,  850,  850,
+      850,  850,  850,  850,  850,  851,  851,    0,  851,  851,
+      851,  851,  851,  851,  851,  851,  851,  851,  851,  851,
+      852,    0,    0,  852,  852,  852,  853,  853,    0,  853,
+        0,  853,  853,  853,  853,  853,  853,  853,  853,  853,
+      853,  854,  854,    0,  854,  854,  854,  854,  854,  854,
+      854,  854,  854,  854,  854,  854,  855,    0,    0,    0,
+        0,    0,  855,    0,    0,  855,  855,  856,    0,    0,
+
+        0,    0,    0,  856,  856,  857,    0,    0,    0,    0,
+        0,  857,    0,    0,  857,  857,  859,    0,    0,    0,
+        0,  859,  859,  861,    0,    0,    0,    0,    0,  861,
+      861,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
       833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
-      833,  835,    0,    0,    0,    0,  835,  835,  835,  835,
-      835,  836,  836,    0,  836,  836,  836,  836,  836,  836,
-      836,  836,  836,  836,  836,  836,  837,    0,    0,  837,
-      837,  837,  838,  838,    0,  838,    0,  838,  838,  838,
-      838,  838,  838,  838,  838,  838,  838,  839,  839,    0,
-      839,  839,  839,  839,  839,  839,  839,  839,  839,  839,
-      839,  839,  840,  840,  840,    0,    0,    0,    0,    0,
-      840,  840,    0,  840,  840,  841,    0,    0,  841,  841,
-
-      841,  842,  842,    0,  842,  842,  842,  842,  842,  842,
-      842,  842,  842,  842,  842,  842,  843,    0,    0,  843,
-      843,  843,  844,    0,    0,  844,  844,  844,  845,  845,
-      845,  845,  845,  845,  845,  846,  846,    0,  846,  846,
-      846,  846,  846,  846,  846,  846,  846,  846,  846,  846,
-      847,    0,    0,  847,  847,  847,  848,  848,    0,  848,
-        0,  848,  848,  848,  848,  848,  848,  848,  848,  848,
-      848,  849,  849,    0,  849,  849,  849,  849,  849,  849,
-      849,  849,  849,  849,  849,  849,  850,    0,    0,    0,
-        0,    0,  850,    0,    0,  850,  850,  851,    0,    0,
-
-        0,    0,    0,  851,  851,  852,    0,    0,    0,    0,
-        0,  852,    0,    0,  852,  852,  854,    0,    0,    0,
-        0,  854,  854,  856,    0,    0,    0,    0,    0,  856,
-      856,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828,  828,  828,  828,  828,  828,  828,  828,  828,  828,
-      828
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,  833,  833,  833,  833,  833,  833,  833,
+      833
     } ;
 
 extern int yy_flex_debug;
@@ -1768,7 +1772,7 @@ send:
 
 #define YY_NO_INPUT 1
 
-#line 1772 "mon_lex.c"
+#line 1776 "mon_lex.c"
 
 #define INITIAL 0
 #define FNAME 1
@@ -2019,7 +2023,7 @@ YY_DECL
    }
 
 
-#line 2023 "mon_lex.c"
+#line 2027 "mon_lex.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2051,7 +2055,7 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 829 )
+				if ( yy_current_state >= 834 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
@@ -2394,202 +2398,207 @@ YY_RULE_SETUP
 case 58:
 YY_RULE_SETUP
 #line 217 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_PWD; }
+{ BEGIN(INITIAL);       return CMD_PROFILE; }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 218 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_QUIT; }
+{ BEGIN(INITIAL);       return CMD_PWD; }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 219 "mon_lex.l"
-{ BEGIN(RADIX);         return CMD_RADIX; }
+{ BEGIN(INITIAL);       return CMD_QUIT; }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 220 "mon_lex.l"
-{ BEGIN(FNAME);         return CMD_RECORD; }
+{ BEGIN(RADIX);         return CMD_RADIX; }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 221 "mon_lex.l"
-{ BEGIN(REG_ASGN);      return CMD_REGISTERS; }
+{ BEGIN(FNAME);         return CMD_RECORD; }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 222 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_MON_RESET; }
+{ BEGIN(REG_ASGN);      return CMD_REGISTERS; }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 223 "mon_lex.l"
-{ BEGIN(INITIAL);    return CMD_RESOURCE_GET; }
+{ BEGIN(INITIAL);       return CMD_MON_RESET; }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 224 "mon_lex.l"
-{ BEGIN(INITIAL);    return CMD_RESOURCE_SET; }
+{ BEGIN(INITIAL);    return CMD_RESOURCE_GET; }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 225 "mon_lex.l"
-{ BEGIN(FNAME); return CMD_LOAD_RESOURCES; }
+{ BEGIN(INITIAL);    return CMD_RESOURCE_SET; }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 226 "mon_lex.l"
-{ BEGIN(FNAME); return CMD_SAVE_RESOURCES; }
+{ BEGIN(FNAME); return CMD_LOAD_RESOURCES; }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 227 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_RETURN; }
+{ BEGIN(FNAME); return CMD_SAVE_RESOURCES; }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 228 "mon_lex.l"
-{ BEGIN(FNAME);         return CMD_SAVE; }
+{ BEGIN(INITIAL);       return CMD_RETURN; }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 229 "mon_lex.l"
-{ BEGIN(FNAME);         return CMD_SAVE_LABELS; }
+{ BEGIN(FNAME);         return CMD_SAVE; }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 230 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_SCREEN; }
+{ BEGIN(FNAME);         return CMD_SAVE_LABELS; }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 231 "mon_lex.l"
-{ BEGIN(FNAME);        return CMD_SCREENSHOT; }
+{ BEGIN(INITIAL);       return CMD_SCREEN; }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 232 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_SHOW_LABELS; }
+{ BEGIN(FNAME);        return CMD_SCREENSHOT; }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 233 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_SIDEFX; }
+{ BEGIN(INITIAL);       return CMD_SHOW_LABELS; }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 234 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_STEP; }
+{ BEGIN(INITIAL);       return CMD_SIDEFX; }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 235 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_MON_STOP; }
+{ BEGIN(INITIAL);       return CMD_STEP; }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 236 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_STOPWATCH; }
+{ BEGIN(INITIAL);       return CMD_MON_STOP; }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 237 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_TAPECTRL; }
+{ BEGIN(INITIAL);       return CMD_STOPWATCH; }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 238 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_TRACE; }
+{ BEGIN(INITIAL);       return CMD_TAPECTRL; }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 239 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_UNTIL; }
+{ BEGIN(INITIAL);       return CMD_TRACE; }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 240 "mon_lex.l"
-{ BEGIN(FNAME);         return CMD_UNDUMP; }
+{ BEGIN(INITIAL);       return CMD_UNTIL; }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 241 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_WATCH; }
+{ BEGIN(FNAME);         return CMD_UNDUMP; }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 242 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_YYDEBUG; }
+{ BEGIN(INITIAL);       return CMD_WATCH; }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 243 "mon_lex.l"
-{ BEGIN(INITIAL);       return CMD_MAINCPU_TRACE; }
+{ BEGIN(INITIAL);       return CMD_YYDEBUG; }
 	YY_BREAK
-
-/* this is not a real command, but could be a label name for a label assignment */
 case 85:
 YY_RULE_SETUP
-#line 246 "mon_lex.l"
-{ BEGIN(LABEL_ASGN); yylval.str = lib_stralloc(yytext); return CMD_LABEL_ASGN; }
+#line 244 "mon_lex.l"
+{ BEGIN(INITIAL);       return CMD_MAINCPU_TRACE; }
 	YY_BREAK
+
+/* this is not a real command, but could be a label name for a label assignment */
 case 86:
 YY_RULE_SETUP
-#line 248 "mon_lex.l"
-{ new_cmd = 1; return CMD_SEP; }
+#line 247 "mon_lex.l"
+{ BEGIN(LABEL_ASGN); yylval.str = lib_stralloc(yytext); return CMD_LABEL_ASGN; }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
-#line 250 "mon_lex.l"
-{ yylval.i = e_ON; return TOGGLE; }
+#line 249 "mon_lex.l"
+{ new_cmd = 1; return CMD_SEP; }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 251 "mon_lex.l"
-{ yylval.i = e_OFF; return TOGGLE; }
+{ yylval.i = e_ON; return TOGGLE; }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 252 "mon_lex.l"
-{ yylval.i = e_TOGGLE; return TOGGLE; }
+{ yylval.i = e_OFF; return TOGGLE; }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
-#line 254 "mon_lex.l"
-{ yylval.i = e_load; return MEM_OP; }
+#line 253 "mon_lex.l"
+{ yylval.i = e_TOGGLE; return TOGGLE; }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 255 "mon_lex.l"
-{ yylval.i = e_store; return MEM_OP; }
+{ yylval.i = e_load; return MEM_OP; }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 256 "mon_lex.l"
-{ yylval.i = e_exec; return MEM_OP; }
+{ yylval.i = e_store; return MEM_OP; }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
-#line 258 "mon_lex.l"
-{ return RESET; }
+#line 257 "mon_lex.l"
+{ yylval.i = e_exec; return MEM_OP; }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
-#line 260 "mon_lex.l"
-{ BEGIN (COND_MODE); return IF; }
+#line 259 "mon_lex.l"
+{ return RESET; }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
-#line 262 "mon_lex.l"
+#line 261 "mon_lex.l"
+{ BEGIN (COND_MODE); return IF; }
+	YY_BREAK
+case 96:
+YY_RULE_SETUP
+#line 263 "mon_lex.l"
 { if (!quote) {
                      quote = 1;
                      BEGIN (STR);
                   }
                 }
 	YY_BREAK
-case 96:
+case 97:
 YY_RULE_SETUP
-#line 268 "mon_lex.l"
+#line 269 "mon_lex.l"
 { if (quote) {
                      if ((yyleng > 1) && (yytext[yyleng - 2] == '\\')) {
                          yymore(); /* skip escaped quote */
@@ -2610,9 +2619,9 @@ YY_RULE_SETUP
                   }
                 }
 	YY_BREAK
-case 97:
+case 98:
 YY_RULE_SETUP
-#line 288 "mon_lex.l"
+#line 289 "mon_lex.l"
 { if (yytext[yyleng - 1] == '\\') {
                      yymore(); /* skip escaped quote */
                   } else {
@@ -2623,24 +2632,24 @@ YY_RULE_SETUP
                 }
 	YY_BREAK
 /* prefixes for numbers */
-case 98:
-YY_RULE_SETUP
-#line 298 "mon_lex.l"
-{ yylval.i = e_hexadecimal; return INPUT_SPEC; }
-	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 299 "mon_lex.l"
-{ yylval.i = e_decimal; return INPUT_SPEC; }
+{ yylval.i = e_hexadecimal; return INPUT_SPEC; }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 300 "mon_lex.l"
-{ yylval.i = e_binary; return INPUT_SPEC; }
+{ yylval.i = e_decimal; return INPUT_SPEC; }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 301 "mon_lex.l"
+{ yylval.i = e_binary; return INPUT_SPEC; }
+	YY_BREAK
+case 102:
+YY_RULE_SETUP
+#line 302 "mon_lex.l"
 { yylval.i = e_octal; return INPUT_SPEC; }
 	YY_BREAK
 /* \.TA		{ yylval.i = e_text_ascii; return INPUT_SPEC; } */
@@ -2649,24 +2658,24 @@ YY_RULE_SETUP
 /* \.S		{ yylval.i = e_sprite; return INPUT_SPEC; } */
 /* \.C		{ yylval.i = e_character; return INPUT_SPEC; } */
 /* used by the "radix" command */
-case 102:
-YY_RULE_SETUP
-#line 309 "mon_lex.l"
-{ yylval.i = e_decimal; return RADIX_TYPE; }
-	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 310 "mon_lex.l"
-{ yylval.i = e_hexadecimal; return RADIX_TYPE; }
+{ yylval.i = e_decimal; return RADIX_TYPE; }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 311 "mon_lex.l"
-{ yylval.i = e_binary; return RADIX_TYPE; }
+{ yylval.i = e_hexadecimal; return RADIX_TYPE; }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 312 "mon_lex.l"
+{ yylval.i = e_binary; return RADIX_TYPE; }
+	YY_BREAK
+case 106:
+YY_RULE_SETUP
+#line 313 "mon_lex.l"
 { yylval.i = e_octal; return RADIX_TYPE; }
 	YY_BREAK
 /* <RADIX>C		{ yylval.i = e_character; return RADIX_TYPE; } */
@@ -2674,22 +2683,22 @@ YY_RULE_SETUP
 /* <RADIX>TA		{ yylval.i = e_text_ascii; return RADIX_TYPE; } */
 /* <RADIX>TP		{ yylval.i = e_text_petscii; return RADIX_TYPE; } */
 /* used (currently) by the "memory" command */
-case 106:
+case 107:
 YY_RULE_SETUP
-#line 319 "mon_lex.l"
+#line 320 "mon_lex.l"
 { yylval.i = e_hexadecimal; return RADIX_TYPE; }
 	YY_BREAK
-case 107:
+case 108:
 YY_RULE_SETUP
-#line 320 "mon_lex.l"
+#line 321 "mon_lex.l"
 { yylval.i = e_octal; return RADIX_TYPE; }
 	YY_BREAK
 /* 'b' and 'd' are ambiguous (could be either radix or hex value),
     work around this by only accepting uppercase 'B' and 'D' as the
     (fortunately, rarely used) radix argument to the memory command */
-case 108:
+case 109:
 YY_RULE_SETUP
-#line 324 "mon_lex.l"
+#line 325 "mon_lex.l"
 { if (yytext[0] == 'D') {
                         yylval.i = e_decimal; return RADIX_TYPE;
                       } else {
@@ -2697,9 +2706,9 @@ YY_RULE_SETUP
                       }
                     }
 	YY_BREAK
-case 109:
+case 110:
 YY_RULE_SETUP
-#line 330 "mon_lex.l"
+#line 331 "mon_lex.l"
 { if (yytext[0] == 'B') {
                         yylval.i = e_binary; return RADIX_TYPE;
                       } else {
@@ -2707,45 +2716,45 @@ YY_RULE_SETUP
                       }
                     }
 	YY_BREAK
-case 110:
-YY_RULE_SETUP
-#line 337 "mon_lex.l"
-{ return MEM_COMP; }
-	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 338 "mon_lex.l"
-{ return MEM_DISK8; }
+{ return MEM_COMP; }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 339 "mon_lex.l"
-{ return MEM_DISK9; }
+{ return MEM_DISK8; }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 340 "mon_lex.l"
-{ return MEM_DISK10; }
+{ return MEM_DISK9; }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 341 "mon_lex.l"
-{ return MEM_DISK11; }
+{ return MEM_DISK10; }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
-#line 343 "mon_lex.l"
-{ yylval.str = lib_stralloc(yytext); return CPUTYPE; }
+#line 342 "mon_lex.l"
+{ return MEM_DISK11; }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
-#line 345 "mon_lex.l"
-
+#line 344 "mon_lex.l"
+{ yylval.str = lib_stralloc(yytext); return CPUTYPE; }
 	YY_BREAK
 case 117:
-/* rule 117 can match eol */
 YY_RULE_SETUP
 #line 346 "mon_lex.l"
+
+	YY_BREAK
+case 118:
+/* rule 118 can match eol */
+YY_RULE_SETUP
+#line 347 "mon_lex.l"
 { dont_match_reg_a = 0;
                  new_cmd = 1;
                  opt_asm = 0;
@@ -2754,923 +2763,923 @@ YY_RULE_SETUP
                  return TRAIL;
                }
 	YY_BREAK
-case 118:
+case 119:
 YY_RULE_SETUP
-#line 354 "mon_lex.l"
+#line 355 "mon_lex.l"
 { yytext[yyleng-1] = '\0';
                 yylval.str = lib_stralloc(yytext+1);
                 BEGIN (INITIAL); return FILENAME; }
 	YY_BREAK
-case 119:
+case 120:
 YY_RULE_SETUP
-#line 358 "mon_lex.l"
+#line 359 "mon_lex.l"
 { yylval.str = lib_stralloc(yytext); return BANKNAME; }
 	YY_BREAK
-case 120:
+case 121:
 YY_RULE_SETUP
-#line 360 "mon_lex.l"
+#line 361 "mon_lex.l"
 { yylval.str = lib_stralloc(yytext); return R_O_L; }
 	YY_BREAK
 /* see monitor.c and montypes.h for the commented list */
 
-case 121:
-YY_RULE_SETUP
-#line 364 "mon_lex.l"
-{ yylval.i = e_A; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
-	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 365 "mon_lex.l"
-{ yylval.i = e_X; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09 */
+{ yylval.i = e_A; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 366 "mon_lex.l"
-{ yylval.i = e_Y; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09 */
+{ yylval.i = e_X; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09 */
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 367 "mon_lex.l"
-{ yylval.i = e_PC; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
+{ yylval.i = e_Y; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09 */
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 368 "mon_lex.l"
-{ yylval.i = e_SP; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
+{ yylval.i = e_PC; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 369 "mon_lex.l"
-{ yylval.i = e_FLAGS; return MON_REGISTER; }	/* 65xx/c64dtv/658xx */
+{ yylval.i = e_SP; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 370 "mon_lex.l"
-{ yylval.i = e_FLAGS; return MON_REGISTER; }	/* 6x09 */
+{ yylval.i = e_FLAGS; return MON_REGISTER; }	/* 65xx/c64dtv/658xx */
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
-#line 372 "mon_lex.l"
-{ yylval.i = e_B; return MON_REGISTER; }		/* 658xx/6x09/z80 */
+#line 371 "mon_lex.l"
+{ yylval.i = e_FLAGS; return MON_REGISTER; }	/* 6x09 */
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 373 "mon_lex.l"
-{ yylval.i = e_C; return MON_REGISTER; }		/* 658xx/z80 */
+{ yylval.i = e_B; return MON_REGISTER; }		/* 658xx/6x09/z80 */
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 374 "mon_lex.l"
-{ yylval.i = e_DPR; return MON_REGISTER; }	/* 658xx */
+{ yylval.i = e_C; return MON_REGISTER; }		/* 658xx/z80 */
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 375 "mon_lex.l"
-{ yylval.i = e_PBR; return MON_REGISTER; }	/* 658xx */
+{ yylval.i = e_DPR; return MON_REGISTER; }	/* 658xx */
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 376 "mon_lex.l"
-{ yylval.i = e_DBR; return MON_REGISTER; }	/* 658xx */
+{ yylval.i = e_PBR; return MON_REGISTER; }	/* 658xx */
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 377 "mon_lex.l"
-{ yylval.i = e_E; return MON_REGISTER; }		/* 658xx/6309/z80 */
+{ yylval.i = e_DBR; return MON_REGISTER; }	/* 658xx */
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
-#line 379 "mon_lex.l"
-{ yylval.i = e_R3; return MON_REGISTER; }		/* c64dtv */
+#line 378 "mon_lex.l"
+{ yylval.i = e_E; return MON_REGISTER; }		/* 658xx/6309/z80 */
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 380 "mon_lex.l"
-{ yylval.i = e_R4; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R3; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 381 "mon_lex.l"
-{ yylval.i = e_R5; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R4; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 382 "mon_lex.l"
-{ yylval.i = e_R6; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R5; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 383 "mon_lex.l"
-{ yylval.i = e_R7; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R6; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 384 "mon_lex.l"
-{ yylval.i = e_R8; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R7; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 385 "mon_lex.l"
-{ yylval.i = e_R9; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R8; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 386 "mon_lex.l"
-{ yylval.i = e_R10; return MON_REGISTER; }	/* c64dtv */
+{ yylval.i = e_R9; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 387 "mon_lex.l"
-{ yylval.i = e_R11; return MON_REGISTER; }	/* c64dtv */
+{ yylval.i = e_R10; return MON_REGISTER; }	/* c64dtv */
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 388 "mon_lex.l"
-{ yylval.i = e_R12; return MON_REGISTER; }	/* c64dtv */
+{ yylval.i = e_R11; return MON_REGISTER; }	/* c64dtv */
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 389 "mon_lex.l"
-{ yylval.i = e_R13; return MON_REGISTER; }	/* c64dtv */
+{ yylval.i = e_R12; return MON_REGISTER; }	/* c64dtv */
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 390 "mon_lex.l"
-{ yylval.i = e_R14; return MON_REGISTER; }	/* c64dtv */
+{ yylval.i = e_R13; return MON_REGISTER; }	/* c64dtv */
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
 #line 391 "mon_lex.l"
-{ yylval.i = e_R15; return MON_REGISTER; }	/* c64dtv */
+{ yylval.i = e_R14; return MON_REGISTER; }	/* c64dtv */
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
 #line 392 "mon_lex.l"
-{ yylval.i = e_ACM; return MON_REGISTER; }	/* c64dtv */
+{ yylval.i = e_R15; return MON_REGISTER; }	/* c64dtv */
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 393 "mon_lex.l"
-{ yylval.i = e_YXM; return MON_REGISTER; }	/* c64dtv */
+{ yylval.i = e_ACM; return MON_REGISTER; }	/* c64dtv */
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
-#line 395 "mon_lex.l"
-{ yylval.i = e_D; return MON_REGISTER; }		/* 6x09/z80 */
+#line 394 "mon_lex.l"
+{ yylval.i = e_YXM; return MON_REGISTER; }	/* c64dtv */
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 396 "mon_lex.l"
-{ yylval.i = e_DP; return MON_REGISTER; }		/* 6x09 */
+{ yylval.i = e_D; return MON_REGISTER; }		/* 6x09/z80 */
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 397 "mon_lex.l"
-{ yylval.i = e_U; return MON_REGISTER; }		/* 6x09 */
+{ yylval.i = e_DP; return MON_REGISTER; }		/* 6x09 */
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
-#line 399 "mon_lex.l"
-{ yylval.i = e_AF; return MON_REGISTER; }		/* z80 */
+#line 398 "mon_lex.l"
+{ yylval.i = e_U; return MON_REGISTER; }		/* 6x09 */
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 400 "mon_lex.l"
-{ yylval.i = e_BC; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_AF; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 401 "mon_lex.l"
-{ yylval.i = e_DE; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_BC; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 402 "mon_lex.l"
-{ yylval.i = e_HL; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_DE; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 403 "mon_lex.l"
-{ yylval.i = e_IX; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_HL; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 404 "mon_lex.l"
-{ yylval.i = e_IY; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_IX; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 405 "mon_lex.l"
-{ yylval.i = e_I; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_IY; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 406 "mon_lex.l"
-{ yylval.i = e_R; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_I; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 407 "mon_lex.l"
-{ yylval.i = e_AF2; return MON_REGISTER; }	/* z80 */
+{ yylval.i = e_R; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 408 "mon_lex.l"
-{ yylval.i = e_BC2; return MON_REGISTER; }	/* z80 */
+{ yylval.i = e_AF2; return MON_REGISTER; }	/* z80 */
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 409 "mon_lex.l"
-{ yylval.i = e_DE2; return MON_REGISTER; }	/* z80 */
+{ yylval.i = e_BC2; return MON_REGISTER; }	/* z80 */
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 410 "mon_lex.l"
-{ yylval.i = e_HL2; return MON_REGISTER; }	/* z80 */
+{ yylval.i = e_DE2; return MON_REGISTER; }	/* z80 */
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
-#line 412 "mon_lex.l"
-{ yylval.i = e_F; return MON_REGISTER; }		/* 6309 */
+#line 411 "mon_lex.l"
+{ yylval.i = e_HL2; return MON_REGISTER; }	/* z80 */
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 413 "mon_lex.l"
-{ yylval.i = e_W; return MON_REGISTER; }		/* 6309 */
+{ yylval.i = e_F; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 414 "mon_lex.l"
-{ yylval.i = e_Q; return MON_REGISTER; }		/* 6309 */
+{ yylval.i = e_W; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 415 "mon_lex.l"
-{ yylval.i = e_V; return MON_REGISTER; }		/* 6309 */
+{ yylval.i = e_Q; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 416 "mon_lex.l"
-{ yylval.i = e_MD; return MON_REGISTER; }		/* 6309 */
+{ yylval.i = e_V; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
-#line 418 "mon_lex.l"
-{ yylval.i = e_H; return MON_REGISTER; }		/* z80 */
+#line 417 "mon_lex.l"
+{ yylval.i = e_MD; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 419 "mon_lex.l"
-{ yylval.i = e_L; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_H; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 420 "mon_lex.l"
-{ yylval.i = e_IXL; return MON_REGISTER; }	/* z80 */
+{ yylval.i = e_L; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 421 "mon_lex.l"
-{ yylval.i = e_IXH; return MON_REGISTER; }	/* z80 */
+{ yylval.i = e_IXL; return MON_REGISTER; }	/* z80 */
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 422 "mon_lex.l"
-{ yylval.i = e_IYL; return MON_REGISTER; }	/* z80 */
+{ yylval.i = e_IXH; return MON_REGISTER; }	/* z80 */
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 423 "mon_lex.l"
-{ yylval.i = e_IYH; return MON_REGISTER; }	/* z80 */
+{ yylval.i = e_IYL; return MON_REGISTER; }	/* z80 */
 	YY_BREAK
-
-
 case 175:
 YY_RULE_SETUP
-#line 427 "mon_lex.l"
-{ yylval.i = e_EQU; return COMPARE_OP; }
+#line 424 "mon_lex.l"
+{ yylval.i = e_IYH; return MON_REGISTER; }	/* z80 */
 	YY_BREAK
+
+
 case 176:
 YY_RULE_SETUP
 #line 428 "mon_lex.l"
-{ yylval.i = e_NEQ; return COMPARE_OP; }
+{ yylval.i = e_EQU; return COMPARE_OP; }
 	YY_BREAK
 case 177:
 YY_RULE_SETUP
 #line 429 "mon_lex.l"
-{ yylval.i = e_LTE; return COMPARE_OP; }
+{ yylval.i = e_NEQ; return COMPARE_OP; }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
 #line 430 "mon_lex.l"
-{ yylval.i = e_LT;  return COMPARE_OP; }
+{ yylval.i = e_LTE; return COMPARE_OP; }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
 #line 431 "mon_lex.l"
-{ yylval.i = e_GT;  return COMPARE_OP; }
+{ yylval.i = e_LT;  return COMPARE_OP; }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
 #line 432 "mon_lex.l"
-{ yylval.i = e_GTE; return COMPARE_OP; }
+{ yylval.i = e_GT;  return COMPARE_OP; }
 	YY_BREAK
 case 181:
 YY_RULE_SETUP
 #line 433 "mon_lex.l"
-{ yylval.i = e_AND; return COMPARE_OP; }
+{ yylval.i = e_GTE; return COMPARE_OP; }
 	YY_BREAK
 case 182:
 YY_RULE_SETUP
 #line 434 "mon_lex.l"
-{ yylval.i = e_OR;  return COMPARE_OP; }
+{ yylval.i = e_AND; return COMPARE_OP; }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
-#line 436 "mon_lex.l"
-{ yylval.i = e_A; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
+#line 435 "mon_lex.l"
+{ yylval.i = e_OR;  return COMPARE_OP; }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 437 "mon_lex.l"
-{ yylval.i = e_X; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09 */
+{ yylval.i = e_A; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
 	YY_BREAK
 case 185:
 YY_RULE_SETUP
 #line 438 "mon_lex.l"
-{ yylval.i = e_Y; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09 */
+{ yylval.i = e_X; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09 */
 	YY_BREAK
 case 186:
 YY_RULE_SETUP
 #line 439 "mon_lex.l"
-{ yylval.i = e_PC; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
+{ yylval.i = e_Y; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09 */
 	YY_BREAK
 case 187:
 YY_RULE_SETUP
 #line 440 "mon_lex.l"
-{ yylval.i = e_SP; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
+{ yylval.i = e_PC; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
 	YY_BREAK
 case 188:
 YY_RULE_SETUP
 #line 441 "mon_lex.l"
-{ yylval.i = e_FLAGS; return MON_REGISTER; }	/* 65xx/c64dtv/658xx */
+{ yylval.i = e_SP; return MON_REGISTER; }		/* 65xx/c64dtv/658xx/6x09/z80 */
 	YY_BREAK
 case 189:
 YY_RULE_SETUP
 #line 442 "mon_lex.l"
-{ yylval.i = e_FLAGS; return MON_REGISTER; }	/* 6x09 */
+{ yylval.i = e_FLAGS; return MON_REGISTER; }	/* 65xx/c64dtv/658xx */
 	YY_BREAK
 case 190:
 YY_RULE_SETUP
-#line 444 "mon_lex.l"
-{ yylval.i = e_B; return MON_REGISTER; }		/* 658xx/6x09/z80 */
+#line 443 "mon_lex.l"
+{ yylval.i = e_FLAGS; return MON_REGISTER; }	/* 6x09 */
 	YY_BREAK
 case 191:
 YY_RULE_SETUP
 #line 445 "mon_lex.l"
-{ yylval.i = e_C; return MON_REGISTER; }		/* 658xx/z80 */
+{ yylval.i = e_B; return MON_REGISTER; }		/* 658xx/6x09/z80 */
 	YY_BREAK
 case 192:
 YY_RULE_SETUP
 #line 446 "mon_lex.l"
-{ yylval.i = e_DPR; return MON_REGISTER; }		/* 658xx */
+{ yylval.i = e_C; return MON_REGISTER; }		/* 658xx/z80 */
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
 #line 447 "mon_lex.l"
-{ yylval.i = e_PBR; return MON_REGISTER; }		/* 658xx */
+{ yylval.i = e_DPR; return MON_REGISTER; }		/* 658xx */
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
 #line 448 "mon_lex.l"
-{ yylval.i = e_DBR; return MON_REGISTER; }		/* 658xx */
+{ yylval.i = e_PBR; return MON_REGISTER; }		/* 658xx */
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
 #line 449 "mon_lex.l"
-{ yylval.i = e_E; return MON_REGISTER; }		/* 658xx/6309/z80 */
+{ yylval.i = e_DBR; return MON_REGISTER; }		/* 658xx */
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
-#line 451 "mon_lex.l"
-{ yylval.i = e_R3; return MON_REGISTER; }		/* c64dtv */
+#line 450 "mon_lex.l"
+{ yylval.i = e_E; return MON_REGISTER; }		/* 658xx/6309/z80 */
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
 #line 452 "mon_lex.l"
-{ yylval.i = e_R4; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R3; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
 #line 453 "mon_lex.l"
-{ yylval.i = e_R5; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R4; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
 #line 454 "mon_lex.l"
-{ yylval.i = e_R6; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R5; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 200:
 YY_RULE_SETUP
 #line 455 "mon_lex.l"
-{ yylval.i = e_R7; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R6; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 201:
 YY_RULE_SETUP
 #line 456 "mon_lex.l"
-{ yylval.i = e_R8; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R7; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
 #line 457 "mon_lex.l"
-{ yylval.i = e_R9; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R8; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
 #line 458 "mon_lex.l"
-{ yylval.i = e_R10; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R9; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
 #line 459 "mon_lex.l"
-{ yylval.i = e_R11; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R10; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 205:
 YY_RULE_SETUP
 #line 460 "mon_lex.l"
-{ yylval.i = e_R12; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R11; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 206:
 YY_RULE_SETUP
 #line 461 "mon_lex.l"
-{ yylval.i = e_R13; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R12; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
 #line 462 "mon_lex.l"
-{ yylval.i = e_R14; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R13; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 208:
 YY_RULE_SETUP
 #line 463 "mon_lex.l"
-{ yylval.i = e_R15; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R14; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
 #line 464 "mon_lex.l"
-{ yylval.i = e_ACM; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_R15; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
 #line 465 "mon_lex.l"
-{ yylval.i = e_YXM; return MON_REGISTER; }		/* c64dtv */
+{ yylval.i = e_ACM; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
-#line 467 "mon_lex.l"
-{ yylval.i = e_D; return MON_REGISTER; }		/* 6x09/z80 */
+#line 466 "mon_lex.l"
+{ yylval.i = e_YXM; return MON_REGISTER; }		/* c64dtv */
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
 #line 468 "mon_lex.l"
-{ yylval.i = e_DP; return MON_REGISTER; }		/* 6x09 */
+{ yylval.i = e_D; return MON_REGISTER; }		/* 6x09/z80 */
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
 #line 469 "mon_lex.l"
-{ yylval.i = e_U; return MON_REGISTER; }		/* 6x09 */
+{ yylval.i = e_DP; return MON_REGISTER; }		/* 6x09 */
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
-#line 471 "mon_lex.l"
-{ yylval.i = e_AF; return MON_REGISTER; }		/* z80 */
+#line 470 "mon_lex.l"
+{ yylval.i = e_U; return MON_REGISTER; }		/* 6x09 */
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
 #line 472 "mon_lex.l"
-{ yylval.i = e_BC; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_AF; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
 #line 473 "mon_lex.l"
-{ yylval.i = e_DE; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_BC; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
 #line 474 "mon_lex.l"
-{ yylval.i = e_HL; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_DE; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 218:
 YY_RULE_SETUP
 #line 475 "mon_lex.l"
-{ yylval.i = e_IX; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_HL; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 219:
 YY_RULE_SETUP
 #line 476 "mon_lex.l"
-{ yylval.i = e_IY; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_IX; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 220:
 YY_RULE_SETUP
 #line 477 "mon_lex.l"
-{ yylval.i = e_I; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_IY; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 221:
 YY_RULE_SETUP
 #line 478 "mon_lex.l"
-{ yylval.i = e_R; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_I; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 222:
 YY_RULE_SETUP
 #line 479 "mon_lex.l"
-{ yylval.i = e_AF2; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_R; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
 #line 480 "mon_lex.l"
-{ yylval.i = e_BC2; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_AF2; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 224:
 YY_RULE_SETUP
 #line 481 "mon_lex.l"
-{ yylval.i = e_DE2; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_BC2; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 225:
 YY_RULE_SETUP
 #line 482 "mon_lex.l"
-{ yylval.i = e_HL2; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_DE2; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
-#line 484 "mon_lex.l"
-{ yylval.i = e_F; return MON_REGISTER; }		/* 6309 */
+#line 483 "mon_lex.l"
+{ yylval.i = e_HL2; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
 #line 485 "mon_lex.l"
-{ yylval.i = e_W; return MON_REGISTER; }		/* 6309 */
+{ yylval.i = e_F; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 228:
 YY_RULE_SETUP
 #line 486 "mon_lex.l"
-{ yylval.i = e_Q; return MON_REGISTER; }		/* 6309 */
+{ yylval.i = e_W; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 229:
 YY_RULE_SETUP
 #line 487 "mon_lex.l"
-{ yylval.i = e_V; return MON_REGISTER; }		/* 6309 */
+{ yylval.i = e_Q; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 230:
 YY_RULE_SETUP
 #line 488 "mon_lex.l"
-{ yylval.i = e_MD; return MON_REGISTER; }		/* 6309 */
+{ yylval.i = e_V; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 231:
 YY_RULE_SETUP
-#line 490 "mon_lex.l"
-{ yylval.i = e_H; return MON_REGISTER; }		/* z80 */
+#line 489 "mon_lex.l"
+{ yylval.i = e_MD; return MON_REGISTER; }		/* 6309 */
 	YY_BREAK
 case 232:
 YY_RULE_SETUP
 #line 491 "mon_lex.l"
-{ yylval.i = e_L; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_H; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 233:
 YY_RULE_SETUP
 #line 492 "mon_lex.l"
-{ yylval.i = e_IXH; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_L; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 234:
 YY_RULE_SETUP
 #line 493 "mon_lex.l"
-{ yylval.i = e_IXL; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_IXH; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 235:
 YY_RULE_SETUP
 #line 494 "mon_lex.l"
-{ yylval.i = e_IYH; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_IXL; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 236:
 YY_RULE_SETUP
 #line 495 "mon_lex.l"
-{ yylval.i = e_IYL; return MON_REGISTER; }		/* z80 */
+{ yylval.i = e_IYH; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 237:
 YY_RULE_SETUP
-#line 497 "mon_lex.l"
-{ return L_PAREN; }
+#line 496 "mon_lex.l"
+{ yylval.i = e_IYL; return MON_REGISTER; }		/* z80 */
 	YY_BREAK
 case 238:
 YY_RULE_SETUP
 #line 498 "mon_lex.l"
-{ return R_PAREN; }
+{ return L_PAREN; }
 	YY_BREAK
 case 239:
 YY_RULE_SETUP
 #line 499 "mon_lex.l"
-{ return L_BRACKET; }
+{ return R_PAREN; }
 	YY_BREAK
 case 240:
 YY_RULE_SETUP
 #line 500 "mon_lex.l"
-{ return R_BRACKET; }
+{ return L_BRACKET; }
 	YY_BREAK
 case 241:
 YY_RULE_SETUP
-#line 502 "mon_lex.l"
-{yylval.str= lib_stralloc(yytext); return BANKNAME; }
+#line 501 "mon_lex.l"
+{ return R_BRACKET; }
 	YY_BREAK
-
 case 242:
 YY_RULE_SETUP
-#line 505 "mon_lex.l"
-{
-    yylval.str = lib_stralloc(yytext); return OPCODE; }
+#line 503 "mon_lex.l"
+{yylval.str= lib_stralloc(yytext); return BANKNAME; }
 	YY_BREAK
+
 case 243:
 YY_RULE_SETUP
-#line 507 "mon_lex.l"
+#line 506 "mon_lex.l"
 {
     yylval.str = lib_stralloc(yytext); return OPCODE; }
 	YY_BREAK
 case 244:
 YY_RULE_SETUP
-#line 509 "mon_lex.l"
+#line 508 "mon_lex.l"
 {
     yylval.str = lib_stralloc(yytext); return OPCODE; }
 	YY_BREAK
 case 245:
 YY_RULE_SETUP
-#line 511 "mon_lex.l"
+#line 510 "mon_lex.l"
 {
     yylval.str = lib_stralloc(yytext); return OPCODE; }
 	YY_BREAK
 case 246:
 YY_RULE_SETUP
-#line 513 "mon_lex.l"
+#line 512 "mon_lex.l"
 {
     yylval.str = lib_stralloc(yytext); return OPCODE; }
 	YY_BREAK
 case 247:
 YY_RULE_SETUP
-#line 515 "mon_lex.l"
+#line 514 "mon_lex.l"
 {
     yylval.str = lib_stralloc(yytext); return OPCODE; }
 	YY_BREAK
 case 248:
 YY_RULE_SETUP
-#line 517 "mon_lex.l"
+#line 516 "mon_lex.l"
 {
     yylval.str = lib_stralloc(yytext); return OPCODE; }
 	YY_BREAK
 case 249:
 YY_RULE_SETUP
-#line 519 "mon_lex.l"
+#line 518 "mon_lex.l"
 {
     yylval.str = lib_stralloc(yytext); return OPCODE; }
 	YY_BREAK
 case 250:
 YY_RULE_SETUP
-#line 521 "mon_lex.l"
-{ return REG_AF; }
+#line 520 "mon_lex.l"
+{
+    yylval.str = lib_stralloc(yytext); return OPCODE; }
 	YY_BREAK
 case 251:
 YY_RULE_SETUP
 #line 522 "mon_lex.l"
-{ return REG_BC; }
+{ return REG_AF; }
 	YY_BREAK
 case 252:
 YY_RULE_SETUP
 #line 523 "mon_lex.l"
-{ return REG_DE; }
+{ return REG_BC; }
 	YY_BREAK
 case 253:
 YY_RULE_SETUP
 #line 524 "mon_lex.l"
-{ return REG_HL; }
+{ return REG_DE; }
 	YY_BREAK
 case 254:
 YY_RULE_SETUP
 #line 525 "mon_lex.l"
-{ return REG_IX; }
+{ return REG_HL; }
 	YY_BREAK
 case 255:
 YY_RULE_SETUP
 #line 526 "mon_lex.l"
-{ return REG_IXH; }
+{ return REG_IX; }
 	YY_BREAK
 case 256:
 YY_RULE_SETUP
 #line 527 "mon_lex.l"
-{ return REG_IXL; }
+{ return REG_IXH; }
 	YY_BREAK
 case 257:
 YY_RULE_SETUP
 #line 528 "mon_lex.l"
-{ return REG_IY; }
+{ return REG_IXL; }
 	YY_BREAK
 case 258:
 YY_RULE_SETUP
 #line 529 "mon_lex.l"
-{ return REG_IYH; }
+{ return REG_IY; }
 	YY_BREAK
 case 259:
 YY_RULE_SETUP
 #line 530 "mon_lex.l"
-{ return REG_IYL; }
+{ return REG_IYH; }
 	YY_BREAK
 case 260:
 YY_RULE_SETUP
 #line 531 "mon_lex.l"
-{ yylval.str = lib_stralloc(yytext); return OPCODE; }
+{ return REG_IYL; }
 	YY_BREAK
 case 261:
 YY_RULE_SETUP
 #line 532 "mon_lex.l"
-{ yylval.str = lib_stralloc(yytext); return LABEL; }
+{ yylval.str = lib_stralloc(yytext); return OPCODE; }
 	YY_BREAK
 case 262:
-/* rule 262 can match eol */
 YY_RULE_SETUP
-#line 534 "mon_lex.l"
-{ if (!dont_match_reg_a) return REG_A;
-                                        yylval.i = 0x0a; return H_NUMBER; }
+#line 533 "mon_lex.l"
+{ yylval.str = lib_stralloc(yytext); return LABEL; }
 	YY_BREAK
 case 263:
+/* rule 263 can match eol */
 YY_RULE_SETUP
-#line 536 "mon_lex.l"
-{ return REG_B; }
+#line 535 "mon_lex.l"
+{ if (!dont_match_reg_a) return REG_A;
+                                        yylval.i = 0x0a; return H_NUMBER; }
 	YY_BREAK
 case 264:
 YY_RULE_SETUP
 #line 537 "mon_lex.l"
-{ return REG_C; }
+{ return REG_B; }
 	YY_BREAK
 case 265:
 YY_RULE_SETUP
 #line 538 "mon_lex.l"
-{ return REG_D; }
+{ return REG_C; }
 	YY_BREAK
 case 266:
 YY_RULE_SETUP
 #line 539 "mon_lex.l"
-{ return REG_E; }
+{ return REG_D; }
 	YY_BREAK
 case 267:
 YY_RULE_SETUP
 #line 540 "mon_lex.l"
-{ return REG_H; }
+{ return REG_E; }
 	YY_BREAK
 case 268:
 YY_RULE_SETUP
 #line 541 "mon_lex.l"
-{ return REG_L; }
+{ return REG_H; }
 	YY_BREAK
 case 269:
 YY_RULE_SETUP
 #line 542 "mon_lex.l"
-{ return REG_S; }
+{ return REG_L; }
 	YY_BREAK
 case 270:
 YY_RULE_SETUP
 #line 543 "mon_lex.l"
-{ return REG_U; }
+{ return REG_S; }
 	YY_BREAK
 case 271:
 YY_RULE_SETUP
 #line 544 "mon_lex.l"
-{ return REG_X; }
+{ return REG_U; }
 	YY_BREAK
 case 272:
 YY_RULE_SETUP
 #line 545 "mon_lex.l"
-{ return REG_Y; }
+{ return REG_X; }
 	YY_BREAK
 case 273:
 YY_RULE_SETUP
-#line 547 "mon_lex.l"
-{ dont_match_reg_a = 1; return L_PAREN; }
+#line 546 "mon_lex.l"
+{ return REG_Y; }
 	YY_BREAK
 case 274:
 YY_RULE_SETUP
 #line 548 "mon_lex.l"
-{ dont_match_reg_a = 0; return R_PAREN; }
+{ dont_match_reg_a = 1; return L_PAREN; }
 	YY_BREAK
 case 275:
 YY_RULE_SETUP
 #line 549 "mon_lex.l"
-{ dont_match_reg_a = 1; return L_BRACKET; }
+{ dont_match_reg_a = 0; return R_PAREN; }
 	YY_BREAK
 case 276:
 YY_RULE_SETUP
 #line 550 "mon_lex.l"
-{ dont_match_reg_a = 0; return R_BRACKET; }
+{ dont_match_reg_a = 1; return L_BRACKET; }
 	YY_BREAK
 case 277:
 YY_RULE_SETUP
 #line 551 "mon_lex.l"
-{ dont_match_reg_a = 1; return ARG_IMMEDIATE; }
+{ dont_match_reg_a = 0; return R_BRACKET; }
 	YY_BREAK
 case 278:
 YY_RULE_SETUP
 #line 552 "mon_lex.l"
-{ dont_match_reg_a = 0; return INST_SEP; }
+{ dont_match_reg_a = 1; return ARG_IMMEDIATE; }
 	YY_BREAK
 case 279:
 YY_RULE_SETUP
 #line 553 "mon_lex.l"
-{ dont_match_reg_a = 1; return LESS_THAN; }
+{ dont_match_reg_a = 0; return INST_SEP; }
 	YY_BREAK
 case 280:
 YY_RULE_SETUP
 #line 554 "mon_lex.l"
-{ return PLUS; }
+{ dont_match_reg_a = 1; return LESS_THAN; }
 	YY_BREAK
 case 281:
 YY_RULE_SETUP
 #line 555 "mon_lex.l"
-{ return MINUS; }
+{ return PLUS; }
 	YY_BREAK
-
 case 282:
 YY_RULE_SETUP
-#line 558 "mon_lex.l"
-{ yylval.str = lib_stralloc(yytext); return H_RANGE_GUESS; }
+#line 556 "mon_lex.l"
+{ return MINUS; }
 	YY_BREAK
+
 case 283:
 YY_RULE_SETUP
 #line 559 "mon_lex.l"
-{ yylval.str = lib_stralloc(yytext); return B_NUMBER_GUESS; }
+{ yylval.str = lib_stralloc(yytext); return H_RANGE_GUESS; }
 	YY_BREAK
 case 284:
 YY_RULE_SETUP
 #line 560 "mon_lex.l"
-{ yylval.i = strtol(yytext+1, NULL, 2); return B_NUMBER; }
+{ yylval.str = lib_stralloc(yytext); return B_NUMBER_GUESS; }
 	YY_BREAK
 case 285:
 YY_RULE_SETUP
 #line 561 "mon_lex.l"
-{ yylval.i = strtol(yytext+1, NULL, 8); return O_NUMBER; }
+{ yylval.i = strtol(yytext+1, NULL, 2); return B_NUMBER; }
 	YY_BREAK
 case 286:
 YY_RULE_SETUP
 #line 562 "mon_lex.l"
-{ yylval.str = lib_stralloc(yytext); return O_NUMBER_GUESS; }
+{ yylval.i = strtol(yytext+1, NULL, 8); return O_NUMBER; }
 	YY_BREAK
 case 287:
 YY_RULE_SETUP
 #line 563 "mon_lex.l"
-{ yylval.i = strtol(yytext+1, NULL, 10); return D_NUMBER; }
+{ yylval.str = lib_stralloc(yytext); return O_NUMBER_GUESS; }
 	YY_BREAK
 case 288:
 YY_RULE_SETUP
 #line 564 "mon_lex.l"
-{ yylval.str = lib_stralloc(yytext); return D_NUMBER_GUESS; }
+{ yylval.i = strtol(yytext+1, NULL, 10); return D_NUMBER; }
 	YY_BREAK
 case 289:
 YY_RULE_SETUP
 #line 565 "mon_lex.l"
-{ yylval.i = 0x00; return MASK; }
+{ yylval.str = lib_stralloc(yytext); return D_NUMBER_GUESS; }
 	YY_BREAK
 case 290:
 YY_RULE_SETUP
 #line 566 "mon_lex.l"
-{ yylval.i = strtol(yytext+1, NULL, 16); return H_NUMBER; }
+{ yylval.i = 0x00; return MASK; }
 	YY_BREAK
 case 291:
 YY_RULE_SETUP
 #line 567 "mon_lex.l"
-{ yylval.i = strtol(yytext, NULL, 16); return H_NUMBER; }
+{ yylval.i = strtol(yytext+1, NULL, 16); return H_NUMBER; }
 	YY_BREAK
-
 case 292:
 YY_RULE_SETUP
-#line 570 "mon_lex.l"
-{ return EQUALS; }
+#line 568 "mon_lex.l"
+{ yylval.i = strtol(yytext, NULL, 16); return H_NUMBER; }
 	YY_BREAK
+
 case 293:
 YY_RULE_SETUP
 #line 571 "mon_lex.l"
+{ return EQUALS; }
+	YY_BREAK
+case 294:
+YY_RULE_SETUP
+#line 572 "mon_lex.l"
 { return COMMA; }
 	YY_BREAK
 /* After a label assignment there may be a ; comment to EOL */
-case 294:
+case 295:
 YY_RULE_SETUP
-#line 574 "mon_lex.l"
+#line 575 "mon_lex.l"
 { return LABEL_ASGN_COMMENT; }
 	YY_BREAK
-case 295:
-/* rule 295 can match eol */
+case 296:
+/* rule 296 can match eol */
 YY_RULE_SETUP
-#line 576 "mon_lex.l"
+#line 577 "mon_lex.l"
 { return yytext[0]; }
 	YY_BREAK
-case 296:
+case 297:
 YY_RULE_SETUP
-#line 578 "mon_lex.l"
+#line 579 "mon_lex.l"
 ECHO;
 	YY_BREAK
-#line 3674 "mon_lex.c"
+#line 3683 "mon_lex.c"
 			case YY_STATE_EOF(INITIAL):
 			case YY_STATE_EOF(FNAME):
 			case YY_STATE_EOF(CMD):
@@ -3943,7 +3952,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 829 )
+			if ( yy_current_state >= 834 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
@@ -3966,11 +3975,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 829 )
+		if ( yy_current_state >= 834 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
-	yy_is_jam = (yy_current_state == 828);
+	yy_is_jam = (yy_current_state == 833);
 	if ( ! yy_is_jam )
 		*(yy_state_ptr)++ = yy_current_state;
 
@@ -4619,7 +4628,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 578 "mon_lex.l"
+#line 579 "mon_lex.l"
 
 
 
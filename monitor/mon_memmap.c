@@ -48,6 +48,7 @@
 /* Globals */
 
 uint8_t memmap_state = 0;
+int monitor_cpuhistory_enabled = 0;
 
 #ifdef FEATURE_CPUMEMHISTORY
 
@@ -122,6 +123,10 @@ void mon_cpuhistory(int count)
     unsigned opc_size;
     int i, pos;
 
+    if (!monitor_cpuhistory_enabled) {
+        mon_out("CPU history is not being recorded, use `resourceset CPUMemHistory 1' to enable it.\n");
+    }
+
     if ((count < 1) || (count > CPUHISTORY_SIZE)) {
         count = CPUHISTORY_SIZE;
     }
@@ -177,6 +182,10 @@ void mon_memmap_show(int mask, MON_ADDR start_addr, MON_ADDR end_addr)
     MEMMAP_ELEM b;
     const char *line_fmt = NULL;
 
+    if (!monitor_cpuhistory_enabled) {
+        mon_out("Memory map is not being recorded, use `resourceset CPUMemHistory 1' to enable it.\n");
+    }
+
     if (start_addr == BAD_ADDR) {
         start_addr = 0;
     }
@@ -144,6 +144,7 @@ extern char *alloca();
 #include "mon_register.h"
 #include "mon_util.h"
 #include "montypes.h"
+#include "profile.h"
 #include "resources.h"
 #include "types.h"
 #include "uimon.h"
@@ -196,7 +197,7 @@ extern int cur_len, last_len;
 #define YYDEBUG 1
 
 
-#line 200 "mon_parse.c" /* yacc.c:339  */
+#line 201 "mon_parse.c" /* yacc.c:339  */
 
 # ifndef YY_NULLPTR
 #  if defined __cplusplus && 201103L <= __cplusplus
@@ -342,56 +343,57 @@ extern int yydebug;
     CMD_AUTOSTART = 366,
     CMD_AUTOLOAD = 367,
     CMD_MAINCPU_TRACE = 368,
-    CMD_LABEL_ASGN = 369,
-    L_PAREN = 370,
-    R_PAREN = 371,
-    ARG_IMMEDIATE = 372,
-    REG_A = 373,
-    REG_X = 374,
-    REG_Y = 375,
-    COMMA = 376,
-    INST_SEP = 377,
-    L_BRACKET = 378,
-    R_BRACKET = 379,
-    LESS_THAN = 380,
-    REG_U = 381,
-    REG_S = 382,
-    REG_PC = 383,
-    REG_PCR = 384,
-    REG_B = 385,
-    REG_C = 386,
-    REG_D = 387,
-    REG_E = 388,
-    REG_H = 389,
-    REG_L = 390,
-    REG_AF = 391,
-    REG_BC = 392,
-    REG_DE = 393,
-    REG_HL = 394,
-    REG_IX = 395,
-    REG_IY = 396,
-    REG_SP = 397,
-    REG_IXH = 398,
-    REG_IXL = 399,
-    REG_IYH = 400,
-    REG_IYL = 401,
-    PLUS = 402,
-    MINUS = 403,
-    STRING = 404,
-    FILENAME = 405,
-    R_O_L = 406,
-    OPCODE = 407,
-    LABEL = 408,
-    BANKNAME = 409,
-    CPUTYPE = 410,
-    MON_REGISTER = 411,
-    COMPARE_OP = 412,
-    RADIX_TYPE = 413,
-    INPUT_SPEC = 414,
-    CMD_CHECKPT_ON = 415,
-    CMD_CHECKPT_OFF = 416,
-    TOGGLE = 417,
-    MASK = 418
+    CMD_PROFILE = 369,
+    CMD_LABEL_ASGN = 370,
+    L_PAREN = 371,
+    R_PAREN = 372,
+    ARG_IMMEDIATE = 373,
+    REG_A = 374,
+    REG_X = 375,
+    REG_Y = 376,
+    COMMA = 377,
+    INST_SEP = 378,
+    L_BRACKET = 379,
+    R_BRACKET = 380,
+    LESS_THAN = 381,
+    REG_U = 382,
+    REG_S = 383,
+    REG_PC = 384,
+    REG_PCR = 385,
+    REG_B = 386,
+    REG_C = 387,
+    REG_D = 388,
+    REG_E = 389,
+    REG_H = 390,
+    REG_L = 391,
+    REG_AF = 392,
+    REG_BC = 393,
+    REG_DE = 394,
+    REG_HL = 395,
+    REG_IX = 396,
+    REG_IY = 397,
+    REG_SP = 398,
+    REG_IXH = 399,
+    REG_IXL = 400,
+    REG_IYH = 401,
+    REG_IYL = 402,
+    PLUS = 403,
+    MINUS = 404,
+    STRING = 405,
+    FILENAME = 406,
+    R_O_L = 407,
+    OPCODE = 408,
+    LABEL = 409,
+    BANKNAME = 410,
+    CPUTYPE = 411,
+    MON_REGISTER = 412,
+    COMPARE_OP = 413,
+    RADIX_TYPE = 414,
+    INPUT_SPEC = 415,
+    CMD_CHECKPT_ON = 416,
+    CMD_CHECKPT_OFF = 417,
+    TOGGLE = 418,
+    MASK = 419
   };
 #endif
 /* Tokens.  */
@@ -506,63 +508,64 @@ extern int yydebug;
 #define CMD_AUTOSTART 366
 #define CMD_AUTOLOAD 367
 #define CMD_MAINCPU_TRACE 368
-#define CMD_LABEL_ASGN 369
-#define L_PAREN 370
-#define R_PAREN 371
-#define ARG_IMMEDIATE 372
-#define REG_A 373
-#define REG_X 374
-#define REG_Y 375
-#define COMMA 376
-#define INST_SEP 377
-#define L_BRACKET 378
-#define R_BRACKET 379
-#define LESS_THAN 380
-#define REG_U 381
-#define REG_S 382
-#define REG_PC 383
-#define REG_PCR 384
-#define REG_B 385
-#define REG_C 386
-#define REG_D 387
-#define REG_E 388
-#define REG_H 389
-#define REG_L 390
-#define REG_AF 391
-#define REG_BC 392
-#define REG_DE 393
-#define REG_HL 394
-#define REG_IX 395
-#define REG_IY 396
-#define REG_SP 397
-#define REG_IXH 398
-#define REG_IXL 399
-#define REG_IYH 400
-#define REG_IYL 401
-#define PLUS 402
-#define MINUS 403
-#define STRING 404
-#define FILENAME 405
-#define R_O_L 406
-#define OPCODE 407
-#define LABEL 408
-#define BANKNAME 409
-#define CPUTYPE 410
-#define MON_REGISTER 411
-#define COMPARE_OP 412
-#define RADIX_TYPE 413
-#define INPUT_SPEC 414
-#define CMD_CHECKPT_ON 415
-#define CMD_CHECKPT_OFF 416
-#define TOGGLE 417
-#define MASK 418
+#define CMD_PROFILE 369
+#define CMD_LABEL_ASGN 370
+#define L_PAREN 371
+#define R_PAREN 372
+#define ARG_IMMEDIATE 373
+#define REG_A 374
+#define REG_X 375
+#define REG_Y 376
+#define COMMA 377
+#define INST_SEP 378
+#define L_BRACKET 379
+#define R_BRACKET 380
+#define LESS_THAN 381
+#define REG_U 382
+#define REG_S 383
+#define REG_PC 384
+#define REG_PCR 385
+#define REG_B 386
+#define REG_C 387
+#define REG_D 388
+#define REG_E 389
+#define REG_H 390
+#define REG_L 391
+#define REG_AF 392
+#define REG_BC 393
+#define REG_DE 394
+#define REG_HL 395
+#define REG_IX 396
+#define REG_IY 397
+#define REG_SP 398
+#define REG_IXH 399
+#define REG_IXL 400
+#define REG_IYH 401
+#define REG_IYL 402
+#define PLUS 403
+#define MINUS 404
+#define STRING 405
+#define FILENAME 406
+#define R_O_L 407
+#define OPCODE 408
+#define LABEL 409
+#define BANKNAME 410
+#define CPUTYPE 411
+#define MON_REGISTER 412
+#define COMPARE_OP 413
+#define RADIX_TYPE 414
+#define INPUT_SPEC 415
+#define CMD_CHECKPT_ON 416
+#define CMD_CHECKPT_OFF 417
+#define TOGGLE 418
+#define MASK 419
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 
 union YYSTYPE
 {
-#line 135 "mon_parse.y" /* yacc.c:355  */
+#line 136 "mon_parse.y" /* yacc.c:355  */
 
     MON_ADDR a;
     MON_ADDR range[2];
@@ -575,7 +578,7 @@ union YYSTYPE
     char *str;
     asm_mode_addr_info_t mode;
 
-#line 579 "mon_parse.c" /* yacc.c:355  */
+#line 582 "mon_parse.c" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -592,7 +595,7 @@ int yyparse (void);
 
 /* Copy the second part of user declarations.  */
 
-#line 596 "mon_parse.c" /* yacc.c:358  */
+#line 599 "mon_parse.c" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -832,23 +835,23 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  312
+#define YYFINAL  315
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1713
+#define YYLAST   1806
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  172
+#define YYNTOKENS  173
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  55
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  314
+#define YYNRULES  316
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  628
+#define YYNSTATES  632
 
 /* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
    by yylex, with out-of-bounds checking.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   418
+#define YYMAXUTOK   419
 
 #define YYTRANSLATE(YYX)                                                \
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -861,9 +864,9 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     168,   169,   166,   164,     2,   165,     2,   167,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   171,     2,
-       2,     2,     2,     2,   170,     2,     2,     2,     2,     2,
+     169,   170,   167,   165,     2,   166,     2,   168,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   172,     2,
+       2,     2,     2,     2,   171,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -898,45 +901,45 @@ static const yytype_uint8 yytranslate[] =
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,   161,   162,   163
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164
 };
 
 #if YYDEBUG
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   199,   199,   200,   201,   204,   205,   208,   209,   210,
-     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
-     223,   224,   225,   228,   230,   232,   234,   236,   238,   240,
-     242,   244,   246,   248,   250,   252,   254,   256,   258,   260,
-     262,   264,   266,   268,   270,   272,   274,   276,   279,   281,
-     283,   286,   291,   296,   298,   300,   302,   304,   306,   308,
-     310,   312,   314,   318,   325,   324,   327,   329,   331,   335,
-     337,   339,   341,   343,   345,   347,   349,   351,   353,   355,
-     357,   359,   361,   363,   365,   367,   369,   371,   373,   377,
-     386,   389,   393,   396,   405,   408,   417,   422,   424,   426,
-     428,   430,   432,   434,   436,   438,   440,   442,   446,   448,
-     453,   455,   473,   475,   477,   479,   481,   485,   487,   489,
-     491,   493,   495,   497,   499,   501,   503,   505,   507,   509,
-     511,   513,   515,   517,   519,   521,   523,   525,   527,   529,
-     533,   535,   537,   539,   541,   543,   545,   547,   549,   551,
-     553,   555,   557,   559,   561,   563,   565,   567,   569,   573,
-     575,   577,   581,   583,   587,   591,   594,   595,   598,   599,
-     602,   603,   606,   607,   610,   611,   614,   620,   628,   629,
-     632,   636,   637,   640,   641,   644,   645,   647,   651,   652,
-     655,   660,   665,   675,   676,   679,   680,   681,   682,   683,
-     686,   688,   690,   691,   692,   693,   694,   695,   696,   699,
-     700,   702,   707,   709,   711,   713,   717,   723,   729,   737,
-     738,   741,   742,   745,   746,   749,   750,   751,   754,   755,
-     758,   759,   760,   761,   764,   765,   766,   769,   770,   771,
-     772,   773,   776,   777,   778,   781,   791,   792,   795,   802,
-     813,   824,   832,   851,   857,   865,   873,   875,   877,   878,
-     879,   880,   881,   882,   883,   885,   887,   889,   891,   892,
-     893,   894,   895,   896,   897,   898,   899,   900,   901,   902,
-     903,   904,   905,   906,   907,   908,   909,   911,   912,   927,
-     931,   935,   939,   943,   947,   951,   955,   959,   971,   986,
-     990,   994,   998,  1002,  1006,  1010,  1014,  1018,  1030,  1035,
-    1043,  1044,  1045,  1046,  1050
+       0,   200,   200,   201,   202,   205,   206,   209,   210,   211,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+     224,   225,   226,   229,   231,   233,   235,   237,   239,   241,
+     243,   245,   247,   249,   251,   253,   255,   257,   259,   261,
+     263,   265,   267,   269,   271,   273,   275,   277,   280,   282,
+     284,   287,   292,   297,   299,   301,   303,   305,   307,   309,
+     311,   313,   315,   319,   326,   325,   328,   330,   332,   336,
+     338,   340,   342,   344,   346,   348,   350,   352,   354,   356,
+     358,   360,   362,   364,   366,   368,   370,   372,   374,   378,
+     387,   390,   394,   397,   406,   409,   418,   423,   425,   427,
+     429,   431,   433,   435,   437,   439,   441,   443,   447,   449,
+     454,   456,   474,   476,   478,   480,   482,   486,   488,   490,
+     492,   494,   496,   498,   500,   502,   504,   506,   508,   510,
+     512,   514,   516,   518,   520,   522,   524,   526,   528,   530,
+     532,   534,   538,   540,   542,   544,   546,   548,   550,   552,
+     554,   556,   558,   560,   562,   564,   566,   568,   570,   572,
+     574,   578,   580,   582,   586,   588,   592,   596,   599,   600,
+     603,   604,   607,   608,   611,   612,   615,   616,   619,   625,
+     633,   634,   637,   641,   642,   645,   646,   649,   650,   652,
+     656,   657,   660,   665,   670,   680,   681,   684,   685,   686,
+     687,   688,   691,   693,   695,   696,   697,   698,   699,   700,
+     701,   704,   705,   707,   712,   714,   716,   718,   722,   728,
+     734,   742,   743,   746,   747,   750,   751,   754,   755,   756,
+     759,   760,   763,   764,   765,   766,   769,   770,   771,   774,
+     775,   776,   777,   778,   781,   782,   783,   786,   796,   797,
+     800,   807,   818,   829,   837,   856,   862,   870,   878,   880,
+     882,   883,   884,   885,   886,   887,   888,   890,   892,   894,
+     896,   897,   898,   899,   900,   901,   902,   903,   904,   905,
+     906,   907,   908,   909,   910,   911,   912,   913,   914,   916,
+     917,   932,   936,   940,   944,   948,   952,   956,   960,   964,
+     976,   991,   995,   999,  1003,  1007,  1011,  1015,  1019,  1023,
+    1035,  1040,  1048,  1049,  1050,  1051,  1055
 };
 #endif
 
@@ -970,13 +973,13 @@ static const char *const yytname[] =
   "CMD_TAPECTRL", "CMD_CARTFREEZE", "CMD_CPUHISTORY", "CMD_MEMMAPZAP",
   "CMD_MEMMAPSHOW", "CMD_MEMMAPSAVE", "CMD_COMMENT", "CMD_LIST",
   "CMD_STOPWATCH", "RESET", "CMD_EXPORT", "CMD_AUTOSTART", "CMD_AUTOLOAD",
-  "CMD_MAINCPU_TRACE", "CMD_LABEL_ASGN", "L_PAREN", "R_PAREN",
-  "ARG_IMMEDIATE", "REG_A", "REG_X", "REG_Y", "COMMA", "INST_SEP",
-  "L_BRACKET", "R_BRACKET", "LESS_THAN", "REG_U", "REG_S", "REG_PC",
-  "REG_PCR", "REG_B", "REG_C", "REG_D", "REG_E", "REG_H", "REG_L",
-  "REG_AF", "REG_BC", "REG_DE", "REG_HL", "REG_IX", "REG_IY", "REG_SP",
-  "REG_IXH", "REG_IXL", "REG_IYH", "REG_IYL", "PLUS", "MINUS", "STRING",
-  "FILENAME", "R_O_L", "OPCODE", "LABEL", "BANKNAME", "CPUTYPE",
+  "CMD_MAINCPU_TRACE", "CMD_PROFILE", "CMD_LABEL_ASGN", "L_PAREN",
+  "R_PAREN", "ARG_IMMEDIATE", "REG_A", "REG_X", "REG_Y", "COMMA",
+  "INST_SEP", "L_BRACKET", "R_BRACKET", "LESS_THAN", "REG_U", "REG_S",
+  "REG_PC", "REG_PCR", "REG_B", "REG_C", "REG_D", "REG_E", "REG_H",
+  "REG_L", "REG_AF", "REG_BC", "REG_DE", "REG_HL", "REG_IX", "REG_IY",
+  "REG_SP", "REG_IXH", "REG_IXL", "REG_IYH", "REG_IYL", "PLUS", "MINUS",
+  "STRING", "FILENAME", "R_O_L", "OPCODE", "LABEL", "BANKNAME", "CPUTYPE",
   "MON_REGISTER", "COMPARE_OP", "RADIX_TYPE", "INPUT_SPEC",
   "CMD_CHECKPT_ON", "CMD_CHECKPT_OFF", "TOGGLE", "MASK", "'+'", "'-'",
   "'*'", "'/'", "'('", "')'", "'@'", "':'", "$accept", "top_level",
@@ -1016,17 +1019,17 @@ static const yytype_uint16 yytoknum[] =
      385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
      395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
      405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,    43,    45,    42,    47,    40,    41,
-      64,    58
+     415,   416,   417,   418,   419,    43,    45,    42,    47,    40,
+      41,    64,    58
 };
 # endif
 
-#define YYPACT_NINF -398
+#define YYPACT_NINF -462
 
 #define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-398)))
+  (!!((Yystate) == (-462)))
 
-#define YYTABLE_NINF -195
+#define YYTABLE_NINF -197
 
 #define yytable_value_is_error(Yytable_value) \
   0
@@ -1035,69 +1038,70 @@ static const yytype_uint16 yytoknum[] =
      STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    1117,   890,  -398,  -398,   103,   365,   890,   890,    89,    89,
-      49,    49,    49,   574,  1473,  1473,  1473,  1115,   409,    60,
-     983,  1231,  1231,  1115,  1473,    49,    49,   365,   742,   574,
-     574,  1491,  1369,    89,    89,   890,   696,   169,  1231,  -132,
-     365,  -132,   515,   189,   189,  1491,   426,  1511,  1511,    49,
-     365,    49,  1369,  1369,  1369,  1369,  1491,   365,  -132,    49,
-      49,   365,  1369,   137,   365,   365,    49,   365,  -126,  -122,
-     -78,    49,    49,    49,   890,    89,   -70,   365,    89,   365,
-      89,    49,  -126,   503,   324,   365,    49,    49,   -73,    70,
-    1536,   742,   742,   121,  1254,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,   107,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,   890,  -398,   -21,   241,  -398,  -398,  -398,
-    -398,  -398,  -398,   365,  -398,  -398,   927,   927,  -398,  -398,
-     890,  -398,   890,  -398,  -398,   669,   691,   669,  -398,  -398,
-    -398,  -398,  -398,    89,  -398,  -398,  -398,   -70,   -70,   -70,
-    -398,  -398,  -398,   -70,   -70,  -398,   365,   -70,  -398,   122,
-     233,  -398,    95,   365,  -398,   -70,  -398,   365,  -398,   340,
-    -398,  -398,   138,  1473,  -398,  1473,  -398,   365,   -70,   365,
-     365,  -398,   472,  -398,   365,   152,   109,   171,  -398,   365,
-    -398,   890,  -398,   890,   241,   365,  -398,  -398,   365,  -398,
-    1473,   365,  -398,   365,   365,  -398,    65,   365,   -70,   365,
-     -70,   -70,   365,   -70,  -398,   365,  -398,   365,   365,  -398,
-     365,  -398,   365,  -398,   365,  -398,   365,  -398,   365,  1097,
-    -398,   365,   669,   669,  -398,  -398,   365,   365,  -398,  -398,
-    -398,    89,  -398,  -398,   365,   365,    31,   365,   365,   890,
-     241,  -398,   890,   890,  -398,  -398,   890,  -398,  -398,   890,
-     -70,   365,   476,  -398,   365,   255,   365,  -398,  -398,  1592,
-    1592,   365,  1491,   830,  1546,    61,   264,  1566,  1546,    66,
-    -398,    74,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,    76,  -398,  -398,   365,
-    -398,   365,  -398,  -398,  -398,    12,  -398,   890,   890,   890,
-     890,  -398,  -398,   162,   946,   241,   241,  -398,   277,  1392,
-    1415,  1455,  -398,   890,   144,  1491,  1253,  1097,  1491,  -398,
-    1546,  1546,   230,  -398,  -398,  -398,  1473,  -398,  -398,   186,
-     186,  -398,  1491,  -398,  -398,  -398,   716,   365,    54,  -398,
-      62,  -398,   241,   241,  -398,  -398,  -398,   186,  -398,  -398,
-    -398,  -398,    72,  -398,    49,  -398,    49,    71,  -398,    79,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  1513,
-    -398,  -398,  -398,   277,  1435,  -398,  -398,  -398,   890,  -398,
-    -398,   365,  -398,  -398,   241,  -398,   241,   241,   241,   857,
-     890,  -398,  -398,  -398,  -398,  1546,  -398,  1546,  -398,   468,
-      99,   113,   117,   120,   128,   143,    -1,  -398,   442,  -398,
-    -398,  -398,  -398,   332,    91,  -398,   133,   362,   140,   141,
-      -5,  -398,   442,   442,  1580,  -398,  -398,  -398,  -398,    -9,
-      -9,  -398,  -398,   365,  1491,   365,  -398,  -398,   365,  -398,
-     365,  -398,   365,   241,  -398,  -398,    53,  -398,  -398,  -398,
-    -398,  -398,  1513,   365,  -398,  -398,   365,   716,   365,   365,
-     365,   716,   119,  -398,    80,  -398,  -398,  -398,   365,   149,
-     157,   365,  -398,  -398,   365,   365,   365,   365,   365,   365,
-    -398,  1097,   365,  -398,   365,   241,  -398,  -398,  -398,  -398,
-    -398,  -398,   365,   241,   365,   365,   365,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,   153,  -107,  -398,   442,  -398,   134,
-     442,   422,   -98,   442,   442,   534,   173,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,   155,  -398,  -398,
-    -398,     7,   127,   285,  -398,  -398,    62,    62,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,   238,   190,   193,  -398,  -398,   194,
-     442,   195,  -398,   -69,   198,   212,   213,   216,   222,  -398,
-    -398,  1491,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,   192,  -398,   221,  -398,  -398,   224,  -398,  -398,
-    -398,  -398,  -398,  -398,   231,  -398,  -398,  -398
+    1213,   708,  -462,  -462,     4,   440,   708,   708,   247,   247,
+      12,    12,    12,   144,  1585,  1585,  1585,  1366,   165,    46,
+    1178,   928,   928,  1366,  1585,    12,    12,   440,   591,   144,
+     144,  1199,  1340,   247,   247,   708,   569,   219,   928,  -133,
+     440,  -133,   259,   401,   401,  1199,   101,   752,   752,    12,
+     440,    12,  1340,  1340,  1340,  1340,  1199,   440,  -133,    12,
+      12,   440,  1340,    50,   440,   440,    12,   440,   -86,   -72,
+     -66,    12,    12,    12,   708,   247,   -19,   440,   247,   440,
+     247,    12,   -86,   506,   337,   440,    12,    12,   -31,   363,
+     128,  1626,   591,   591,   161,  1385,  -462,  -462,  -462,  -462,
+    -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,
+     142,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,
+    -462,  -462,  -462,  -462,   708,  -462,    36,    79,  -462,  -462,
+    -462,  -462,  -462,  -462,   440,  -462,  -462,   689,   689,  -462,
+    -462,   708,  -462,   708,  -462,  -462,   292,   529,   292,  -462,
+    -462,  -462,  -462,  -462,   247,  -462,  -462,  -462,   -19,   -19,
+     -19,  -462,  -462,  -462,   -19,   -19,  -462,   440,   -19,  -462,
+     175,   239,  -462,    64,   440,  -462,   -19,  -462,   440,  -462,
+     433,  -462,  -462,   172,  1585,  -462,  1585,  -462,   440,   -19,
+     440,   440,  -462,   537,  -462,   440,   183,    15,    74,  -462,
+     440,  -462,   708,  -462,   708,    79,   440,  -462,  -462,   440,
+    -462,  1585,   440,  -462,   440,   440,  -462,   194,   440,   -19,
+     440,   -19,   -19,   440,   -19,  -462,   440,  -462,   440,   440,
+    -462,   440,  -462,   440,  -462,   440,  -462,   440,  -462,   440,
+     488,  -462,   440,   292,   292,  -462,  -462,   440,   440,  -462,
+    -462,  -462,   247,  -462,  -462,   440,   440,    49,   440,   440,
+     708,    79,  -462,   708,   708,  -462,  -462,   708,  -462,  -462,
+     708,   -19,   440,   561,  -462,   440,   492,   440,  -462,  -462,
+    1138,  1138,   440,   440,  -462,  1199,  1636,  1123,    82,   302,
+    1661,  1123,    97,  -462,   106,  -462,  -462,  -462,  -462,  -462,
+    -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,   108,
+    -462,  -462,   440,  -462,   440,  -462,  -462,  -462,    10,  -462,
+     708,   708,   708,   708,  -462,  -462,    35,  1003,    79,    79,
+    -462,   283,  1505,  1525,  1567,  -462,   708,   104,  1199,   957,
+     488,  1199,  -462,  1123,  1123,   327,  -462,  -462,  -462,  1585,
+    -462,  -462,   195,   195,  -462,  1199,  -462,  -462,  -462,   560,
+     440,    59,  -462,    80,  -462,    79,    79,  -462,  -462,  -462,
+     195,  -462,  -462,  -462,  -462,    68,  -462,    12,  -462,    12,
+      78,  -462,    83,  -462,  -462,  -462,  -462,  -462,  -462,  -462,
+    -462,  -462,  1605,  -462,  -462,  -462,   283,  1547,  -462,  -462,
+    -462,   708,  -462,  -462,   440,  -462,  -462,    79,  -462,    79,
+      79,    79,   729,   708,  -462,  -462,  -462,  -462,  1123,  -462,
+    1123,  -462,  -462,   481,   121,   126,   139,   156,   166,   168,
+     -55,  -462,   261,  -462,  -462,  -462,  -462,   353,   140,  -462,
+     167,   393,   169,   177,     0,  -462,   261,   261,  1677,  -462,
+    -462,  -462,  -462,  -118,  -118,  -462,  -462,   440,  1199,   440,
+    -462,  -462,   440,  -462,   440,  -462,   440,    79,  -462,  -462,
+     904,  -462,  -462,  -462,  -462,  -462,  1605,   440,  -462,  -462,
+     440,   560,   440,   440,   440,   560,   145,  -462,    60,  -462,
+    -462,  -462,   440,   178,   184,   440,  -462,  -462,   440,   440,
+     440,   440,   440,   440,  -462,   488,   440,  -462,   440,    79,
+    -462,  -462,  -462,  -462,  -462,  -462,   440,    79,   440,   440,
+     440,  -462,  -462,  -462,  -462,  -462,  -462,  -462,   193,  -105,
+    -462,   261,  -462,   170,   261,   447,   -44,   261,   261,   349,
+     199,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,
+    -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,
+    -462,   159,  -462,  -462,  -462,    34,   151,   123,  -462,  -462,
+      80,    80,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,
+    -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,   312,   208,
+     209,  -462,  -462,   204,   261,   211,  -462,   -37,   217,   225,
+     229,   232,   244,  -462,  -462,  1199,  -462,  -462,  -462,  -462,
+    -462,  -462,  -462,  -462,  -462,  -462,   246,  -462,   241,  -462,
+    -462,   251,  -462,  -462,  -462,  -462,  -462,  -462,   256,  -462,
+    -462,  -462
 };
 
   /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1111,85 +1115,86 @@ static const yytype_uint16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   167,     0,
-       0,     0,     0,     0,     0,     0,   194,     0,     0,     0,
-       0,     0,   167,     0,     0,     0,     0,     0,     0,     0,
-     268,     0,     0,     0,     2,     5,    10,    47,    11,    13,
-      12,    14,    15,    16,    17,    18,    19,    20,    21,     0,
-     237,   238,   239,   240,   236,   235,   234,   195,   196,   197,
-     198,   199,   176,     0,   229,     0,     0,   208,   241,   228,
-       9,     8,     7,     0,   109,    35,     0,     0,   193,    42,
-       0,    44,     0,   169,   168,     0,     0,     0,   182,   230,
-     233,   232,   231,     0,   181,   186,   192,   194,   194,   194,
-     190,   200,   201,   194,   194,    28,     0,   194,    48,     0,
-       0,   179,     0,     0,   111,   194,    75,     0,   183,   194,
-     173,    90,   174,     0,    96,     0,    29,     0,   194,     0,
-       0,   115,     9,   104,     0,     0,     0,     0,    68,     0,
-      40,     0,    38,     0,     0,     0,   165,   119,     0,    94,
-       0,     0,   114,     0,     0,    23,     0,     0,   194,     0,
-     194,   194,     0,   194,    59,     0,    61,     0,     0,   160,
-       0,    77,     0,    79,     0,    81,     0,    83,     0,     0,
-     163,     0,     0,     0,    46,    92,     0,     0,    31,   164,
-     124,     0,   126,   166,     0,     0,     0,     0,     0,     0,
-       0,   133,     0,     0,   136,    33,     0,    84,    85,     0,
-     194,     0,     9,   151,     0,   170,     0,   139,   113,     0,
-       0,     0,     0,     0,     0,   269,     0,     0,     0,   270,
-     271,   272,   273,   274,   277,   280,   281,   282,   283,   284,
-     285,   286,   275,   278,   276,   279,   249,   245,    98,     0,
-     100,     0,     1,     6,     3,     0,   177,     0,     0,     0,
-       0,   121,   108,   194,     0,     0,     0,   171,   194,   143,
-       0,     0,   101,     0,     0,     0,     0,     0,     0,    27,
-       0,     0,     0,    50,    49,   110,     0,    74,   172,   210,
-     210,    30,     0,    36,    37,   103,     0,     0,     0,    66,
-       0,    67,     0,     0,   118,   112,   120,   210,   117,   122,
-      25,    24,     0,    52,     0,    54,     0,     0,    56,     0,
-      58,    60,   159,   161,    76,    78,    80,    82,   222,     0,
-     220,   221,   123,   194,     0,    91,    32,   127,     0,   125,
-     129,     0,   131,   132,     0,   154,     0,     0,     0,     0,
-       0,   137,   152,   138,   155,     0,   157,     0,   116,     0,
-       0,     0,     0,     0,     0,     0,     0,   248,     0,   310,
-     311,   314,   313,     0,   293,   312,     0,     0,     0,     0,
-       0,   287,     0,     0,     0,    97,    99,   207,   206,   202,
-     203,   204,   205,     0,     0,     0,    43,    45,     0,   144,
-       0,   148,     0,     0,   227,   226,     0,   224,   225,   185,
-     187,   191,     0,     0,   180,   178,     0,     0,     0,     0,
-       0,     0,     0,   216,     0,   215,   217,   107,     0,   247,
-     246,     0,    41,    39,     0,     0,     0,     0,     0,     0,
-     162,     0,     0,   146,     0,     0,   130,   153,   134,   135,
-      34,    86,     0,     0,     0,     0,     0,    62,   258,   259,
-     260,   261,   262,   263,   254,     0,   295,     0,   291,   289,
-       0,     0,     0,     0,     0,     0,   308,   294,   296,   250,
-     251,   252,   297,   253,   288,   149,   188,   150,   140,   142,
-     147,   102,    72,   223,    71,    69,    73,   209,    89,    95,
-      70,     0,     0,     0,   105,   106,     0,   244,    65,    93,
-      26,    51,    53,    55,    57,   219,   141,   145,   128,    87,
-      88,   156,   158,    63,     0,     0,     0,   292,   290,     0,
-       0,     0,   303,     0,     0,     0,     0,     0,     0,   214,
-     213,     0,   212,   211,   242,   243,   264,   257,   265,   266,
-     267,   255,     0,   305,     0,   301,   299,     0,   304,   306,
-     307,   298,   309,   218,     0,   302,   300,   256
+       0,     0,     0,     0,     0,     0,     0,     0,   169,     0,
+       0,     0,     0,     0,     0,     0,   196,     0,     0,     0,
+       0,     0,   169,     0,     0,     0,     0,     0,     0,     0,
+       0,   270,     0,     0,     0,     2,     5,    10,    47,    11,
+      13,    12,    14,    15,    16,    17,    18,    19,    20,    21,
+       0,   239,   240,   241,   242,   238,   237,   236,   197,   198,
+     199,   200,   201,   178,     0,   231,     0,     0,   210,   243,
+     230,     9,     8,     7,     0,   109,    35,     0,     0,   195,
+      42,     0,    44,     0,   171,   170,     0,     0,     0,   184,
+     232,   235,   234,   233,     0,   183,   188,   194,   196,   196,
+     196,   192,   202,   203,   196,   196,    28,     0,   196,    48,
+       0,     0,   181,     0,     0,   111,   196,    75,     0,   185,
+     196,   175,    90,   176,     0,    96,     0,    29,     0,   196,
+       0,     0,   115,     9,   104,     0,     0,     0,     0,    68,
+       0,    40,     0,    38,     0,     0,     0,   167,   119,     0,
+      94,     0,     0,   114,     0,     0,    23,     0,     0,   196,
+       0,   196,   196,     0,   196,    59,     0,    61,     0,     0,
+     162,     0,    77,     0,    79,     0,    81,     0,    83,     0,
+       0,   165,     0,     0,     0,    46,    92,     0,     0,    31,
+     166,   124,     0,   126,   168,     0,     0,     0,     0,     0,
+       0,     0,   133,     0,     0,   136,    33,     0,    84,    85,
+       0,   196,     0,     9,   153,     0,   172,     0,   139,   113,
+       0,     0,     0,     0,   141,     0,     0,     0,   271,     0,
+       0,     0,   272,   273,   274,   275,   276,   279,   282,   283,
+     284,   285,   286,   287,   288,   277,   280,   278,   281,   251,
+     247,    98,     0,   100,     0,     1,     6,     3,     0,   179,
+       0,     0,     0,     0,   121,   108,   196,     0,     0,     0,
+     173,   196,   145,     0,     0,   101,     0,     0,     0,     0,
+       0,     0,    27,     0,     0,     0,    50,    49,   110,     0,
+      74,   174,   212,   212,    30,     0,    36,    37,   103,     0,
+       0,     0,    66,     0,    67,     0,     0,   118,   112,   120,
+     212,   117,   122,    25,    24,     0,    52,     0,    54,     0,
+       0,    56,     0,    58,    60,   161,   163,    76,    78,    80,
+      82,   224,     0,   222,   223,   123,   196,     0,    91,    32,
+     127,     0,   125,   129,     0,   131,   132,     0,   156,     0,
+       0,     0,     0,     0,   137,   154,   138,   157,     0,   159,
+       0,   116,   140,     0,     0,     0,     0,     0,     0,     0,
+       0,   250,     0,   312,   313,   316,   315,     0,   295,   314,
+       0,     0,     0,     0,     0,   289,     0,     0,     0,    97,
+      99,   209,   208,   204,   205,   206,   207,     0,     0,     0,
+      43,    45,     0,   146,     0,   150,     0,     0,   229,   228,
+       0,   226,   227,   187,   189,   193,     0,     0,   182,   180,
+       0,     0,     0,     0,     0,     0,     0,   218,     0,   217,
+     219,   107,     0,   249,   248,     0,    41,    39,     0,     0,
+       0,     0,     0,     0,   164,     0,     0,   148,     0,     0,
+     130,   155,   134,   135,    34,    86,     0,     0,     0,     0,
+       0,    62,   260,   261,   262,   263,   264,   265,   256,     0,
+     297,     0,   293,   291,     0,     0,     0,     0,     0,     0,
+     310,   296,   298,   252,   253,   254,   299,   255,   290,   151,
+     190,   152,   142,   144,   149,   102,    72,   225,    71,    69,
+      73,   211,    89,    95,    70,     0,     0,     0,   105,   106,
+       0,   246,    65,    93,    26,    51,    53,    55,    57,   221,
+     143,   147,   128,    87,    88,   158,   160,    63,     0,     0,
+       0,   294,   292,     0,     0,     0,   305,     0,     0,     0,
+       0,     0,     0,   216,   215,     0,   214,   213,   244,   245,
+     266,   259,   267,   268,   269,   257,     0,   307,     0,   303,
+     301,     0,   306,   308,   309,   300,   311,   220,     0,   304,
+     302,   258
 };
 
   /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -398,  -398,  -398,   572,   220,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,    83,
-     268,   102,  -110,  -398,   -15,    -7,  -398,    10,   374,    15,
-       0,  -307,    29,    64,   -14,  -206,  -398,   234,  -288,  -397,
-    -398,    28,  -133,  -398,   -91,  -398,  -398,  -398,   130,  -398,
-    -355,  -398,  -398,   485,   -62
+    -462,  -462,  -462,   589,   277,  -462,  -462,  -462,  -462,  -462,
+    -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,  -462,   111,
+     298,    87,    43,  -462,    -1,    -6,  -462,    52,   366,    38,
+      40,  -317,    29,   956,   -14,  -280,  -462,    70,  -345,  -461,
+    -462,    61,  -106,  -462,   -70,  -462,  -462,  -462,    88,  -462,
+    -356,  -462,  -462,   441,   -45
 };
 
   /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    93,    94,   134,    95,    96,    97,    98,    99,   360,
-     100,   101,   102,   103,   104,   105,   106,   107,   108,   208,
-     254,   145,   274,   182,   183,   124,   170,   171,   153,   177,
-     178,   453,   179,   454,   125,   160,   161,   275,   478,   484,
-     485,   389,   390,   466,   467,   127,   154,   128,   162,   489,
-     109,   491,   307,   434,   435
+      -1,    94,    95,   135,    96,    97,    98,    99,   100,   363,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   209,
+     255,   146,   275,   183,   184,   125,   171,   172,   154,   178,
+     179,   457,   180,   458,   126,   161,   162,   276,   482,   488,
+     489,   392,   393,   470,   471,   128,   155,   129,   163,   493,
+     110,   495,   310,   438,   439
 };
 
   /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1197,354 +1202,372 @@ static const yytype_int16 yydefgoto[] =
      number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     159,   159,   159,   167,   172,   490,   159,   185,   599,   167,
-     159,   169,   585,   447,   157,   163,   164,   167,   159,   206,
-     586,   458,   205,   210,   188,   253,   592,   255,   216,   218,
-     220,   167,   223,   225,   227,   328,   330,   331,   159,   159,
-     159,   159,   167,   158,   158,   158,   166,   199,   159,   593,
-     143,   138,   187,   158,   130,   616,   110,   111,   112,   113,
-     197,   130,   479,   114,   115,   116,   130,   232,   234,   236,
-     238,   256,   140,   142,   221,   131,   132,   246,   617,   494,
-     557,   130,   131,   132,   561,   239,   502,   131,   132,   281,
-     130,   282,  -194,  -194,  -194,  -194,   130,   201,   203,  -194,
-    -194,  -194,   131,   132,   130,  -194,  -194,  -194,  -194,  -194,
-     357,   131,   132,   146,   147,   524,   535,   131,   132,   536,
-     525,   312,   211,   600,   213,   131,   132,   189,   190,   314,
-     471,   129,   393,   394,   471,   316,   129,   129,   130,   262,
-     263,   241,   266,   341,   269,   217,   219,   110,   111,   112,
-     113,   228,   348,   230,   114,   115,   116,   319,   320,   131,
-     132,   242,   243,  -189,   563,   129,   603,   356,   251,   159,
-     130,   159,   130,   257,   258,   259,   317,   318,   319,   320,
-     401,   448,   428,   270,  -189,  -189,   138,   442,   279,   280,
-     143,   131,   132,   131,   132,   443,   159,   444,   349,   144,
-     350,   477,   464,   488,   129,   117,   118,   119,   120,   121,
-     138,   604,   605,   129,    90,   518,   465,   333,   173,  -194,
-     306,   334,   335,   336,   498,   367,   495,   337,   338,   519,
-     138,   340,   499,   520,   130,   126,   521,   563,   529,   346,
-     136,   137,   130,   335,   522,  -194,   117,   118,   119,   120,
-     121,   316,   352,   129,   530,   131,   132,  -194,  -194,   523,
-     358,   533,   534,   131,   132,   133,   129,   129,   167,   204,
-     129,   566,   129,   562,   584,   129,   129,   129,  -189,   567,
-     372,   588,   374,   138,   376,   377,   602,   379,   110,   111,
-     112,   113,   247,   464,   598,   114,   115,   116,   601,  -189,
-    -189,   117,   118,   119,   120,   121,   611,   465,   260,   612,
-     167,   419,   563,   624,   313,   398,   159,   167,   613,   615,
-     206,   167,   618,   -64,   167,   130,   317,   318,   319,   320,
-     460,   129,   159,   129,   410,   169,   619,   620,   167,   144,
-     621,  -184,   622,   415,   417,   625,   131,   132,   626,   483,
-     271,   627,   475,   455,   342,  -184,   606,   315,   607,   158,
-     462,   476,  -184,  -184,   469,   472,   130,   473,   575,   391,
-     323,   324,   129,   129,   325,   553,   326,   608,   609,   610,
-     159,   480,   544,   429,   430,     0,   122,   131,   132,   129,
-     431,   432,   129,   129,   504,   159,   129,     0,   138,   129,
-     481,     0,   194,   195,   196,   317,   318,   319,   320,     0,
-     130,     0,   433,   426,   427,     0,     0,   440,   441,   317,
-     318,   319,   320,   158,   512,   117,   118,   119,   120,   121,
-       0,   131,   132,   276,     0,   362,     0,   363,     0,     0,
-     167,   122,   117,   118,   119,   120,   121,   129,   129,   129,
-     129,   429,   430,   501,     0,   482,     0,     0,   431,   432,
-       0,   138,     0,   129,   468,   309,   311,   391,     0,   130,
-     483,   474,     0,  -182,   483,     0,   496,  -171,   497,     0,
-     527,   429,   430,   546,     0,     0,   486,     0,   431,   432,
-     131,   132,   516,   404,  -182,  -182,   406,   407,  -171,  -171,
-     408,     0,     0,   409,   272,     0,   110,   111,   112,   113,
-     531,     0,     0,   114,   115,   116,   130,     0,     0,   117,
-     118,   119,   120,   121,     0,   131,   132,     0,   129,     0,
-       0,   117,   118,   119,   120,   121,   501,   131,   132,     0,
-     129,   429,   430,     0,     0,   514,     0,   515,   431,   432,
-       0,   449,   450,   451,   452,     0,   483,     0,     0,     0,
-       0,   429,   430,     0,     0,   122,     0,   463,   431,   432,
-     590,     0,     0,     0,   543,   148,     0,   135,   149,   222,
-     139,   141,     0,     0,   150,   151,   152,   167,     0,   165,
-     168,   174,   176,   181,   184,   186,   468,     0,     0,   191,
-     193,     0,     0,     0,   198,   200,   202,   486,     0,   207,
-     209,   486,   212,     0,   215,     0,     0,     0,     0,   224,
-     226,     0,   229,     0,   231,   233,   235,   237,     0,   240,
-     623,   391,   505,   244,   245,   248,   249,   250,     0,   252,
-       0,     0,     0,     0,   513,     0,     0,   261,     0,   264,
-     265,   267,   268,   429,   430,   273,   277,   278,     0,   122,
-     431,   432,   596,   308,   310,     0,     0,     0,     0,   214,
-     327,   123,   110,   111,   112,   113,     0,     0,     0,   114,
-     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
-       0,     0,   329,   486,   110,   111,   112,   113,   321,     0,
-       0,   114,   115,   116,     0,   322,     0,   117,   118,   119,
-     120,   121,   117,   118,   119,   120,   121,     0,     0,   110,
-     111,   112,   113,     0,     0,   332,   114,   115,   116,     0,
-       0,     0,   117,   118,   119,   120,   121,     0,   339,     0,
-       0,     0,   343,   192,   344,   345,   149,     0,     0,   347,
-       0,     0,   150,   151,   152,     0,     0,     0,     0,   351,
-       0,   353,   354,     0,   131,   132,   355,     0,     0,   359,
-       0,   361,     0,     0,     0,     0,   364,   365,     0,     0,
-     366,     0,     0,   368,     0,   369,   370,     0,   371,   373,
-       0,   375,     0,     0,   378,     0,     0,   380,     0,   381,
-     382,     0,   383,     0,   384,     0,   385,     0,   386,     0,
-     387,     0,     0,   392,     0,     0,     0,     0,   395,   396,
-       0,     0,     0,   397,     0,   122,   399,   400,     0,   402,
-     403,   481,   405,   110,   111,   112,   113,   123,     0,     0,
-     114,   115,   116,   411,     0,     0,   412,   122,   413,     0,
-       0,   414,   416,   418,     0,     0,     0,     0,   130,   123,
-     110,   111,   112,   113,     0,     0,   155,   114,   115,   116,
-       0,     0,   122,   117,   118,   119,   120,   121,     0,   131,
-     132,   445,     0,   446,     0,     0,   482,     0,     0,     0,
-       0,     0,     0,   110,   111,   112,   113,   456,   457,     0,
-     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
-     121,     0,     0,   526,     0,     0,     0,     0,   528,     0,
-       0,     0,   532,     0,     0,     0,     0,   537,   538,   487,
-     110,   111,   112,   113,   492,   493,     0,   114,   115,   116,
-       0,     0,     0,   117,   118,   119,   120,   121,     0,   110,
-     111,   112,   113,     0,     0,     0,   114,   115,   116,     0,
-       0,   500,   117,   118,   119,   120,   121,   420,   421,   422,
-     423,   424,   425,   506,     0,     0,   507,     0,   508,   509,
-     510,   511,     0,     0,   130,     0,   110,   111,   112,   113,
-       0,   517,   155,   114,   115,   116,     0,     0,     0,   117,
-     118,   119,   120,   121,     0,   131,   132,     0,     0,     0,
-     156,     0,   587,     0,     0,   589,   591,     0,   594,   595,
-     597,   317,   318,   319,   320,   545,     0,   547,     0,     0,
-     548,     0,   549,     0,   550,   551,     0,     0,   552,     0,
-       0,     0,     0,     0,   554,   555,   122,     0,   556,     0,
-     558,   559,   560,     0,     0,     0,   564,     0,   123,     0,
-     565,     0,     0,   568,     0,     0,   569,   570,   571,   572,
-     573,   574,     0,     0,   576,   614,   577,   578,     0,     0,
-       0,     0,     0,   122,   579,   580,   581,   582,   583,     0,
-       0,   317,   318,   319,   320,   123,     0,     0,     0,   156,
-     110,   111,   112,   113,     0,     0,     0,   114,   115,   116,
-     317,   318,   319,   320,     0,     0,   130,     0,   110,   111,
-     112,   113,     0,     0,     1,   114,   115,   116,     0,     0,
-       2,   117,   118,   119,   120,   121,   156,   131,   132,     3,
-       0,   175,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,    15,    16,    17,    18,     0,     0,    19,
-      20,    21,    22,    23,     0,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    81,    82,    83,    84,     0,    85,    86,    87,
-      88,    89,   130,     0,  -175,  -175,  -175,  -175,     0,     0,
-    -175,  -175,  -175,  -175,     0,   180,   388,  -175,  -175,  -175,
-    -175,  -175,     0,   131,   132,     0,   110,   111,   112,   113,
-       0,     1,   470,   114,   115,   116,     0,     2,   156,    90,
-       0,     0,     0,     0,     0,     0,     0,    91,    92,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,     0,     0,    19,    20,    21,    22,
-      23,     0,    24,    25,    26,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
-      82,    83,    84,     0,    85,    86,    87,    88,    89,     0,
-     130,     0,   110,   111,   112,   113,     0,     0,   155,   114,
-     115,   116,     0,     0,  -175,   117,   118,   119,   120,   121,
-       0,   131,   132,  -171,     0,  -171,  -171,  -171,  -171,     0,
-       0,  -171,  -171,  -171,  -171,     0,     0,     0,  -171,  -171,
-    -171,  -171,  -171,     0,    91,    92,   459,     0,   110,   111,
-     112,   113,     0,     0,   155,   114,   115,   116,     0,     0,
-       0,   117,   118,   119,   120,   121,   503,     0,   110,   111,
-     112,   113,     0,     0,   155,   114,   115,   116,     0,     0,
-       0,   117,   118,   119,   120,   121,   461,     0,   110,   111,
-     112,   113,     0,     0,     0,   114,   115,   116,     0,     0,
-       0,   117,   118,   119,   120,   121,   110,   111,   112,   113,
-       0,     0,   155,   114,   115,   116,     0,     0,     0,   117,
-     118,   119,   120,   121,   110,   111,   112,   113,     0,     0,
-       0,   114,   115,   116,     0,     0,     0,   117,   118,   119,
-     120,   121,   130,     0,   130,     0,  -194,  -194,  -194,  -194,
-       0,     0,   156,  -194,  -194,  -194,     0,   117,   118,   119,
-     120,   121,     0,   131,   132,   131,   132,     0,     0,   110,
-     111,   112,   113,     0,     0,  -171,   114,   115,   116,   110,
-     111,   112,   113,     0,     0,     0,   114,   115,   116,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   156,   110,
-     111,   112,   113,     0,     0,     0,   114,   115,   116,     0,
-       0,     0,     0,   110,   111,   112,   113,     0,   156,     0,
-     114,   115,   116,   130,     0,  -194,  -194,  -194,  -194,     0,
-       0,     0,  -194,  -194,  -194,     0,     0,     0,   156,     0,
-       0,     0,     0,     0,   131,   132,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   156,     0,     0,     0,
-       0,     0,     0,     0,   138,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   156,     0,     0,     0,     0,     0,
-       0,   283,     0,   284,   285,     0,     0,   286,     0,   287,
-       0,   288,  -194,     0,     0,     0,   289,   290,   291,   292,
-     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,   305,     0,   436,     0,     0,   437,     0,     0,
-       0,     0,     0,     0,     0,     0,   438,     0,   439,   539,
-     540,     0,     0,     0,     0,     0,   431,   541,   542,     0,
-       0,     0,     0,   138
+     160,   160,   160,   168,   173,   131,   160,   494,   483,   168,
+     160,   451,   170,   144,   462,   589,   360,   168,   160,   207,
+     561,   186,   206,   590,   565,   498,   132,   133,   217,   219,
+     221,   168,   224,   226,   228,   603,  -191,   211,   160,   160,
+     160,   160,   168,   159,   159,   159,   167,   131,   160,   322,
+     323,   131,   188,   159,   158,   164,   165,  -191,  -191,   475,
+     198,   131,   528,   475,   189,   131,   254,   529,   132,   133,
+     200,   127,   132,   133,   222,   131,   137,   138,   256,   506,
+     131,   596,   132,   133,   257,   240,   132,   133,   620,   130,
+     233,   235,   237,   239,   130,   130,   132,   133,   147,   148,
+     247,   132,   133,   139,   597,   205,   607,   111,   112,   113,
+     114,   621,   190,   191,   115,   116,   117,   118,   119,   120,
+     121,   122,   539,   130,   606,   540,   111,   112,   113,   114,
+     218,   220,   282,   115,   116,   117,   229,   139,   231,   118,
+     119,   120,   121,   122,   261,   149,   243,   244,   150,   285,
+     212,   604,   214,   252,   151,   152,   153,   139,   258,   259,
+     260,   315,   130,   145,   317,  -196,   131,   134,   271,   242,
+     160,   130,   160,   280,   281,   320,   321,   322,   323,   309,
+     452,   118,   119,   120,   121,   122,   351,   132,   133,   331,
+     333,   334,   567,   319,   318,   131,   344,   160,   359,   404,
+     320,   321,   322,   323,   432,   174,   248,   326,   327,   492,
+     481,   328,   130,   329,   608,   609,   132,   133,   567,   446,
+     131,   319,   352,   499,   353,   130,   130,   -64,   447,   130,
+     448,   130,   502,    91,   130,   130,   130,   503,   522,   485,
+     131,   132,   133,   523,   320,   321,   322,   323,   131,   370,
+    -196,  -196,  -196,  -196,   468,   223,   524,  -196,  -196,  -196,
+     131,   132,   133,  -196,  -196,  -196,  -196,  -196,   469,   132,
+     133,   168,   365,   525,   366,   118,   119,   120,   121,   122,
+     123,   132,   133,   526,  -191,   527,   396,   397,   533,   534,
+     130,   537,   130,   330,   486,   111,   112,   113,   114,   538,
+     566,   570,   115,   116,   117,  -191,  -191,   571,   118,   119,
+     120,   121,   122,   168,   423,   588,   139,   567,   592,   160,
+     168,   602,   123,   605,   168,   615,   616,   168,   394,   617,
+     407,   130,   130,   409,   410,   160,   619,   411,   131,   170,
+     412,   168,   622,   118,   119,   120,   121,   122,   130,  -196,
+     623,   130,   130,   487,   624,   130,   459,   625,   130,   132,
+     133,   345,   159,   466,   131,   626,   629,   473,   628,   139,
+     477,   207,   316,   464,   430,   431,   630,   631,   444,   445,
+     272,   433,   434,   160,   484,   132,   133,   480,   435,   436,
+     453,   454,   455,   456,   195,   196,   197,   479,   160,   579,
+     557,   476,   144,   548,  -196,   139,   467,     0,   130,   130,
+     130,   130,     0,     0,   215,     0,  -196,   118,   119,   120,
+     121,   122,   433,   434,   130,   472,   159,     0,   394,   435,
+     436,   610,   478,   611,  -186,     0,     0,   508,     0,     0,
+       0,   131,     0,     0,   168,     0,   277,   490,  -186,   123,
+     516,   437,   612,   613,   614,  -186,  -186,     0,   312,   314,
+       0,   124,   132,   133,   500,     0,   501,     0,     0,   433,
+     434,   509,   283,   433,   434,   487,   435,   436,   600,   487,
+     435,   436,   131,   517,   123,     0,     0,   550,     0,   130,
+       0,   111,   112,   113,   114,     0,     0,     0,   115,   116,
+     117,   130,   531,   132,   133,   520,   518,   273,   519,   111,
+     112,   113,   114,   433,   434,     0,   115,   116,   117,     0,
+     435,   436,   118,   119,   120,   121,   122,     0,   132,   133,
+     332,     0,   111,   112,   113,   114,   547,     0,  -184,   115,
+     116,   117,   535,     0,     0,   118,   119,   120,   121,   122,
+       0,     0,   145,     0,     0,   139,     0,     0,   472,  -184,
+    -184,   487,  -173,   111,   112,   113,   114,   433,   434,   490,
+     115,   116,   117,   490,   435,   436,   118,   119,   120,   121,
+     122,     0,     0,  -173,  -173,   118,   119,   120,   121,   122,
+       0,   168,   193,   394,   136,   150,   594,   140,   142,     0,
+       0,   151,   152,   153,     0,     0,   166,   169,   175,   177,
+     182,   185,   187,   132,   133,     0,   192,   194,     0,     0,
+       0,   199,   201,   203,     0,     0,   208,   210,     0,   213,
+       0,   216,     0,     0,   627,     0,   225,   227,   391,   230,
+       0,   232,   234,   236,   238,     0,   241,     0,     0,     0,
+     245,   246,   249,   250,   251,   490,   253,   320,   321,   322,
+     323,     0,     0,   123,   262,     0,   265,   266,   268,   269,
+       0,     0,   274,   278,   279,   124,   485,     0,   284,     0,
+       0,   311,   313,     0,     0,     0,   123,     0,     0,     0,
+       0,     0,   111,   112,   113,   114,     0,     0,   124,   115,
+     116,   117,     0,     0,     0,   118,   119,   120,   121,   122,
+       0,   111,   112,   113,   114,     0,   324,   123,   115,   116,
+     117,     0,     0,   325,   118,   119,   120,   121,   122,     0,
+     131,   486,   111,   112,   113,   114,     0,     0,   156,   115,
+     116,   117,     0,   335,     0,   118,   119,   120,   121,   122,
+       0,   132,   133,   131,     0,     0,   342,     0,     0,     0,
+     346,     0,   347,   348,     0,     0,     0,   350,   118,   119,
+     120,   121,   122,     0,   132,   133,     0,   354,     0,   356,
+     357,     0,     0,     0,   358,     0,     0,   362,     0,   364,
+       0,     0,     0,     0,   367,   368,     0,     0,   369,     0,
+       0,   371,     0,   372,   373,     0,   374,   376,     0,   378,
+       0,     0,   381,     0,     0,   383,     0,   384,   385,     0,
+     386,     0,   387,     0,   388,     0,   389,     0,   390,     0,
+       0,   395,     0,     0,     0,     0,   398,   399,     0,     0,
+       0,   400,     0,     0,   402,   403,   123,   405,   406,     0,
+     408,     0,     0,     0,   320,   321,   322,   323,   124,     0,
+       0,   414,     0,     0,   415,   123,   416,     0,     0,   417,
+     419,   421,   422,   530,     0,     0,     0,   124,   532,     0,
+       0,     0,   536,   157,     0,     0,     0,   541,   542,     0,
+       0,     0,     0,     0,   320,   321,   322,   323,     0,     0,
+       0,   449,     0,   450,     0,   131,     0,   111,   112,   113,
+     114,     0,     0,     0,   115,   116,   117,   460,   461,     0,
+       0,     0,     0,     0,     0,     0,   132,   133,     0,   131,
+       0,  -177,  -177,  -177,  -177,     0,     0,  -177,  -177,  -177,
+    -177,     0,   181,     0,  -177,  -177,  -177,  -177,  -177,   491,
+     132,   133,     0,     0,   496,   497,     0,     0,     0,     0,
+     111,   112,   113,   114,   141,   143,   474,   115,   116,   117,
+       0,     0,   591,     0,     0,   593,   595,     0,   598,   599,
+     601,   504,     0,     0,     0,     0,     0,     0,     0,   202,
+     204,     0,     0,   510,     0,     0,   511,     0,   512,   513,
+     514,   515,     0,     0,     0,     0,   111,   112,   113,   114,
+       0,     0,   521,   115,   116,   117,     0,     0,     0,   118,
+     119,   120,   121,   122,     0,     0,     0,     0,     0,     0,
+       0,   263,   264,     0,   267,   618,   270,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   549,     0,   551,     0,
+       0,   552,     0,   553,   468,   554,   555,     0,     0,   556,
+       0,     0,     0,     0,     0,   558,   559,     0,   469,   560,
+       0,   562,   563,   564,     0,     0,     0,   568,     0,     0,
+       0,   569,  -177,     0,   572,     0,     0,   573,   574,   575,
+     576,   577,   578,     0,     0,   580,     0,   581,   582,     0,
+       0,     0,     0,     0,     0,   583,   584,   585,   586,   587,
+     336,     0,     0,     0,   337,   338,   339,     0,     0,     0,
+     340,   341,     0,     0,   343,     0,   111,   112,   113,   114,
+       0,     0,   349,   115,   116,   117,   338,     0,     0,   131,
+       0,  -196,  -196,  -196,  -196,   355,     0,     0,  -196,  -196,
+    -196,     0,     0,   361,     0,     0,     0,   157,     0,     0,
+     132,   133,     0,     0,     0,     0,     0,     0,   320,   321,
+     322,   323,     0,   375,     0,   377,     0,   379,   380,   131,
+     382,   111,   112,   113,   114,     0,     0,   156,   115,   116,
+     117,     0,     0,     0,   118,   119,   120,   121,   122,     0,
+     132,   133,   111,   112,   113,   114,     0,     0,   401,   115,
+     116,   117,     0,     0,     0,   118,   119,   120,   121,   122,
+       1,     0,     0,     0,     0,     0,     2,   413,     0,     0,
+       0,     0,     0,     0,     0,     3,   418,   420,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,     0,     0,    19,    20,    21,    22,    23,
+     139,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,     0,    85,    86,    87,    88,    89,    90,     0,
+       0,     0,   157,     0,     0,     0,     0,   176,     0,     0,
+       0,   131,     0,   111,   112,   113,   114,     0,   505,   156,
+     115,   116,   117,   157,     0,     0,   118,   119,   120,   121,
+     122,     0,   132,   133,     0,     0,    91,   131,     0,   111,
+     112,   113,   114,     0,    92,    93,   115,   116,   117,     0,
+       0,     0,   118,   119,   120,   121,   122,     0,   132,   133,
+       0,     0,     1,     0,     0,     0,     0,     0,     2,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,     0,     0,    19,    20,    21,
+      22,    23,   505,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,   157,    85,    86,    87,    88,    89,
+      90,     0,     0,     0,     0,     0,  -173,     0,  -173,  -173,
+    -173,  -173,     0,     0,  -173,  -173,  -173,  -173,     0,     0,
+     157,  -173,  -173,  -173,  -173,  -173,   463,     0,   111,   112,
+     113,   114,     0,     0,   156,   115,   116,   117,     0,     0,
+       0,   118,   119,   120,   121,   122,    92,    93,   507,     0,
+     111,   112,   113,   114,     0,     0,   156,   115,   116,   117,
+       0,     0,     0,   118,   119,   120,   121,   122,   465,     0,
+     111,   112,   113,   114,     0,     0,     0,   115,   116,   117,
+       0,     0,     0,   118,   119,   120,   121,   122,   111,   112,
+     113,   114,     0,     0,   156,   115,   116,   117,     0,     0,
+       0,   118,   119,   120,   121,   122,   131,     0,  -196,  -196,
+    -196,  -196,     0,     0,     0,  -196,  -196,  -196,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   132,   133,   111,
+     112,   113,   114,     0,     0,     0,   115,   116,   117,   111,
+     112,   113,   114,     0,     0,     0,   115,   116,   117,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -173,
+       0,     0,     0,     0,   111,   112,   113,   114,     0,     0,
+       0,   115,   116,   117,     0,     0,     0,     0,     0,   157,
+     111,   112,   113,   114,     0,     0,     0,   115,   116,   117,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   157,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   157,     0,     0,     0,     0,     0,   139,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   157,
+       0,     0,   286,     0,   287,   288,     0,     0,   289,     0,
+     290,     0,   291,     0,     0,  -196,     0,   292,   293,   294,
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   424,   425,   426,   427,   428,   429,
+     440,     0,     0,   441,     0,     0,     0,     0,     0,     0,
+       0,     0,   442,     0,   443,     0,     0,   543,   544,     0,
+       0,     0,     0,     0,   435,   545,   546
 };
 
 static const yytype_int16 yycheck[] =
 {
-      14,    15,    16,    17,    18,   360,    20,    22,     1,    23,
-      24,    18,   119,     1,    14,    15,    16,    31,    32,   151,
-     127,   328,    36,    38,    24,   151,   124,   149,    42,    43,
-      44,    45,    46,    47,    48,   145,   146,   147,    52,    53,
-      54,    55,    56,    14,    15,    16,    17,    32,    62,   147,
-       1,   121,    23,    24,     1,   124,     3,     4,     5,     6,
-      31,     1,   350,    10,    11,    12,     1,    52,    53,    54,
-      55,   149,     8,     9,    45,    22,    23,    62,   147,   367,
-     477,     1,    22,    23,   481,    56,   393,    22,    23,   162,
-       1,    21,     3,     4,     5,     6,     1,    33,    34,    10,
-      11,    12,    22,    23,     1,    16,    17,    18,    19,    20,
-       1,    22,    23,    11,    12,   116,   121,    22,    23,   124,
-     121,     0,    39,   116,    41,    22,    23,    25,    26,    22,
-     336,     1,   242,   243,   340,   156,     6,     7,     1,    75,
-      76,    58,    78,    21,    80,    43,    44,     3,     4,     5,
-       6,    49,    14,    51,    10,    11,    12,   166,   167,    22,
-      23,    59,    60,     1,   157,    35,   563,    15,    66,   183,
-       1,   185,     1,    71,    72,    73,   164,   165,   166,   167,
-     149,   169,   121,    81,    22,    23,   121,   121,    86,    87,
-       1,    22,    23,    22,    23,   121,   210,   121,   183,   150,
-     185,    15,   149,   149,    74,    16,    17,    18,    19,    20,
-     121,   566,   567,    83,   152,   116,   163,   153,   158,   154,
-      90,   157,   158,   159,   153,   210,   154,   163,   164,   116,
-     121,   167,   153,   116,     1,     1,   116,   157,   147,   175,
-       6,     7,     1,   179,   116,   156,    16,    17,    18,    19,
-      20,   156,   188,   123,   121,    22,    23,   168,   149,   116,
-     196,   121,   121,    22,    23,   162,   136,   137,   282,    35,
-     140,   122,   142,   154,   121,   145,   146,   147,     1,   122,
-     216,   147,   218,   121,   220,   221,     1,   223,     3,     4,
-       5,     6,   155,   149,   121,    10,    11,    12,   171,    22,
-      23,    16,    17,    18,    19,    20,   116,   163,    74,   116,
-     324,   282,   157,   121,    94,   251,   330,   331,   124,   124,
-     151,   335,   124,   152,   338,     1,   164,   165,   166,   167,
-     330,   201,   346,   203,   270,   342,   124,   124,   352,   150,
-     124,     1,   120,   279,   280,   124,    22,    23,   124,   356,
-      82,   120,   342,   324,   121,    15,   118,   123,   120,   330,
-     331,   346,    22,    23,   335,   337,     1,   338,   501,   239,
-     136,   137,   242,   243,   140,   466,   142,   139,   140,   141,
-     394,   352,   444,   119,   120,    -1,   156,    22,    23,   259,
-     126,   127,   262,   263,   394,   409,   266,    -1,   121,   269,
-     115,    -1,    28,    29,    30,   164,   165,   166,   167,    -1,
-       1,    -1,   148,   283,   284,    -1,    -1,   287,   288,   164,
-     165,   166,   167,   394,   409,    16,    17,    18,    19,    20,
-      -1,    22,    23,   109,    -1,   201,    -1,   203,    -1,    -1,
-     454,   156,    16,    17,    18,    19,    20,   317,   318,   319,
-     320,   119,   120,   389,    -1,   170,    -1,    -1,   126,   127,
-      -1,   121,    -1,   333,   334,    91,    92,   337,    -1,     1,
-     477,   341,    -1,     1,   481,    -1,   374,     1,   376,    -1,
-     148,   119,   120,   454,    -1,    -1,   356,    -1,   126,   127,
-      22,    23,    24,   259,    22,    23,   262,   263,    22,    23,
-     266,    -1,    -1,   269,     1,    -1,     3,     4,     5,     6,
-     148,    -1,    -1,    10,    11,    12,     1,    -1,    -1,    16,
-      17,    18,    19,    20,    -1,    22,    23,    -1,   398,    -1,
-      -1,    16,    17,    18,    19,    20,   472,    22,    23,    -1,
-     410,   119,   120,    -1,    -1,   415,    -1,   417,   126,   127,
-      -1,   317,   318,   319,   320,    -1,   563,    -1,    -1,    -1,
-      -1,   119,   120,    -1,    -1,   156,    -1,   333,   126,   127,
-     148,    -1,    -1,    -1,   444,     1,    -1,     5,     4,   153,
-       8,     9,    -1,    -1,    10,    11,    12,   601,    -1,    17,
-      18,    19,    20,    21,    22,    23,   466,    -1,    -1,    27,
-      28,    -1,    -1,    -1,    32,    33,    34,   477,    -1,    37,
-      38,   481,    40,    -1,    42,    -1,    -1,    -1,    -1,    47,
-      48,    -1,    50,    -1,    52,    53,    54,    55,    -1,    57,
-     601,   501,   398,    61,    62,    63,    64,    65,    -1,    67,
-      -1,    -1,    -1,    -1,   410,    -1,    -1,    75,    -1,    77,
-      78,    79,    80,   119,   120,    83,    84,    85,    -1,   156,
-     126,   127,   128,    91,    92,    -1,    -1,    -1,    -1,   154,
-       1,   168,     3,     4,     5,     6,    -1,    -1,    -1,    10,
+      14,    15,    16,    17,    18,     1,    20,   363,   353,    23,
+      24,     1,    18,     1,   331,   120,     1,    31,    32,   152,
+     481,    22,    36,   128,   485,   370,    22,    23,    42,    43,
+      44,    45,    46,    47,    48,     1,     1,    38,    52,    53,
+      54,    55,    56,    14,    15,    16,    17,     1,    62,   167,
+     168,     1,    23,    24,    14,    15,    16,    22,    23,   339,
+      31,     1,   117,   343,    24,     1,   152,   122,    22,    23,
+      32,     1,    22,    23,    45,     1,     6,     7,   150,   396,
+       1,   125,    22,    23,   150,    56,    22,    23,   125,     1,
+      52,    53,    54,    55,     6,     7,    22,    23,    11,    12,
+      62,    22,    23,   122,   148,    35,   567,     3,     4,     5,
+       6,   148,    25,    26,    10,    11,    12,    16,    17,    18,
+      19,    20,   122,    35,     1,   125,     3,     4,     5,     6,
+      43,    44,   163,    10,    11,    12,    49,   122,    51,    16,
+      17,    18,    19,    20,    74,     1,    59,    60,     4,    21,
+      39,   117,    41,    66,    10,    11,    12,   122,    71,    72,
+      73,     0,    74,   151,    22,   150,     1,   163,    81,    58,
+     184,    83,   186,    86,    87,   165,   166,   167,   168,    91,
+     170,    16,    17,    18,    19,    20,    14,    22,    23,   146,
+     147,   148,   158,   157,   124,     1,    21,   211,    15,   150,
+     165,   166,   167,   168,   122,   159,   156,   137,   138,   150,
+      15,   141,   124,   143,   570,   571,    22,    23,   158,   122,
+       1,   157,   184,   155,   186,   137,   138,   153,   122,   141,
+     122,   143,   154,   153,   146,   147,   148,   154,   117,   116,
+       1,    22,    23,   117,   165,   166,   167,   168,     1,   211,
+       3,     4,     5,     6,   150,   154,   117,    10,    11,    12,
+       1,    22,    23,    16,    17,    18,    19,    20,   164,    22,
+      23,   285,   202,   117,   204,    16,    17,    18,    19,    20,
+     157,    22,    23,   117,     1,   117,   243,   244,   148,   122,
+     202,   122,   204,     1,   171,     3,     4,     5,     6,   122,
+     155,   123,    10,    11,    12,    22,    23,   123,    16,    17,
+      18,    19,    20,   327,   285,   122,   122,   158,   148,   333,
+     334,   122,   157,   172,   338,   117,   117,   341,   240,   125,
+     260,   243,   244,   263,   264,   349,   125,   267,     1,   345,
+     270,   355,   125,    16,    17,    18,    19,    20,   260,   155,
+     125,   263,   264,   359,   125,   267,   327,   125,   270,    22,
+      23,   122,   333,   334,     1,   121,   125,   338,   122,   122,
+     341,   152,    95,   333,   286,   287,   125,   121,   290,   291,
+      82,   120,   121,   397,   355,    22,    23,   349,   127,   128,
+     320,   321,   322,   323,    28,    29,    30,   345,   412,   505,
+     470,   340,     1,   448,   157,   122,   336,    -1,   320,   321,
+     322,   323,    -1,    -1,   155,    -1,   169,    16,    17,    18,
+      19,    20,   120,   121,   336,   337,   397,    -1,   340,   127,
+     128,   119,   344,   121,     1,    -1,    -1,   397,    -1,    -1,
+      -1,     1,    -1,    -1,   458,    -1,   109,   359,    15,   157,
+     412,   149,   140,   141,   142,    22,    23,    -1,    92,    93,
+      -1,   169,    22,    23,   377,    -1,   379,    -1,    -1,   120,
+     121,   401,   109,   120,   121,   481,   127,   128,   129,   485,
+     127,   128,     1,   413,   157,    -1,    -1,   458,    -1,   401,
+      -1,     3,     4,     5,     6,    -1,    -1,    -1,    10,    11,
+      12,   413,   149,    22,    23,    24,   418,     1,   420,     3,
+       4,     5,     6,   120,   121,    -1,    10,    11,    12,    -1,
+     127,   128,    16,    17,    18,    19,    20,    -1,    22,    23,
+       1,    -1,     3,     4,     5,     6,   448,    -1,     1,    10,
+      11,    12,   149,    -1,    -1,    16,    17,    18,    19,    20,
+      -1,    -1,   151,    -1,    -1,   122,    -1,    -1,   470,    22,
+      23,   567,     1,     3,     4,     5,     6,   120,   121,   481,
+      10,    11,    12,   485,   127,   128,    16,    17,    18,    19,
+      20,    -1,    -1,    22,    23,    16,    17,    18,    19,    20,
+      -1,   605,     1,   505,     5,     4,   149,     8,     9,    -1,
+      -1,    10,    11,    12,    -1,    -1,    17,    18,    19,    20,
+      21,    22,    23,    22,    23,    -1,    27,    28,    -1,    -1,
+      -1,    32,    33,    34,    -1,    -1,    37,    38,    -1,    40,
+      -1,    42,    -1,    -1,   605,    -1,    47,    48,   150,    50,
+      -1,    52,    53,    54,    55,    -1,    57,    -1,    -1,    -1,
+      61,    62,    63,    64,    65,   567,    67,   165,   166,   167,
+     168,    -1,    -1,   157,    75,    -1,    77,    78,    79,    80,
+      -1,    -1,    83,    84,    85,   169,   116,    -1,    89,    -1,
+      -1,    92,    93,    -1,    -1,    -1,   157,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,    -1,    -1,   169,    10,
       11,    12,    -1,    -1,    -1,    16,    17,    18,    19,    20,
-      -1,    -1,     1,   563,     3,     4,     5,     6,   126,    -1,
-      -1,    10,    11,    12,    -1,   133,    -1,    16,    17,    18,
-      19,    20,    16,    17,    18,    19,    20,    -1,    -1,     3,
-       4,     5,     6,    -1,    -1,   153,    10,    11,    12,    -1,
-      -1,    -1,    16,    17,    18,    19,    20,    -1,   166,    -1,
-      -1,    -1,   170,     1,   172,   173,     4,    -1,    -1,   177,
-      -1,    -1,    10,    11,    12,    -1,    -1,    -1,    -1,   187,
-      -1,   189,   190,    -1,    22,    23,   194,    -1,    -1,   197,
-      -1,   199,    -1,    -1,    -1,    -1,   204,   205,    -1,    -1,
-     208,    -1,    -1,   211,    -1,   213,   214,    -1,   216,   217,
-      -1,   219,    -1,    -1,   222,    -1,    -1,   225,    -1,   227,
-     228,    -1,   230,    -1,   232,    -1,   234,    -1,   236,    -1,
-     238,    -1,    -1,   241,    -1,    -1,    -1,    -1,   246,   247,
-      -1,    -1,    -1,   251,    -1,   156,   254,   255,    -1,   257,
-     258,   115,   260,     3,     4,     5,     6,   168,    -1,    -1,
-      10,    11,    12,   271,    -1,    -1,   274,   156,   276,    -1,
-      -1,   279,   280,   281,    -1,    -1,    -1,    -1,     1,   168,
+      -1,     3,     4,     5,     6,    -1,   127,   157,    10,    11,
+      12,    -1,    -1,   134,    16,    17,    18,    19,    20,    -1,
+       1,   171,     3,     4,     5,     6,    -1,    -1,     9,    10,
+      11,    12,    -1,   154,    -1,    16,    17,    18,    19,    20,
+      -1,    22,    23,     1,    -1,    -1,   167,    -1,    -1,    -1,
+     171,    -1,   173,   174,    -1,    -1,    -1,   178,    16,    17,
+      18,    19,    20,    -1,    22,    23,    -1,   188,    -1,   190,
+     191,    -1,    -1,    -1,   195,    -1,    -1,   198,    -1,   200,
+      -1,    -1,    -1,    -1,   205,   206,    -1,    -1,   209,    -1,
+      -1,   212,    -1,   214,   215,    -1,   217,   218,    -1,   220,
+      -1,    -1,   223,    -1,    -1,   226,    -1,   228,   229,    -1,
+     231,    -1,   233,    -1,   235,    -1,   237,    -1,   239,    -1,
+      -1,   242,    -1,    -1,    -1,    -1,   247,   248,    -1,    -1,
+      -1,   252,    -1,    -1,   255,   256,   157,   258,   259,    -1,
+     261,    -1,    -1,    -1,   165,   166,   167,   168,   169,    -1,
+      -1,   272,    -1,    -1,   275,   157,   277,    -1,    -1,   280,
+     281,   282,   283,   432,    -1,    -1,    -1,   169,   437,    -1,
+      -1,    -1,   441,   154,    -1,    -1,    -1,   446,   447,    -1,
+      -1,    -1,    -1,    -1,   165,   166,   167,   168,    -1,    -1,
+      -1,   312,    -1,   314,    -1,     1,    -1,     3,     4,     5,
+       6,    -1,    -1,    -1,    10,    11,    12,   328,   329,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    -1,     1,
+      -1,     3,     4,     5,     6,    -1,    -1,     9,    10,    11,
+      12,    -1,    14,    -1,    16,    17,    18,    19,    20,   360,
+      22,    23,    -1,    -1,   365,   366,    -1,    -1,    -1,    -1,
+       3,     4,     5,     6,     8,     9,     9,    10,    11,    12,
+      -1,    -1,   531,    -1,    -1,   534,   535,    -1,   537,   538,
+     539,   392,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,
+      34,    -1,    -1,   404,    -1,    -1,   407,    -1,   409,   410,
+     411,   412,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+      -1,    -1,   423,    10,    11,    12,    -1,    -1,    -1,    16,
+      17,    18,    19,    20,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    75,    76,    -1,    78,   594,    80,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   457,    -1,   459,    -1,
+      -1,   462,    -1,   464,   150,   466,   467,    -1,    -1,   470,
+      -1,    -1,    -1,    -1,    -1,   476,   477,    -1,   164,   480,
+      -1,   482,   483,   484,    -1,    -1,    -1,   488,    -1,    -1,
+      -1,   492,   154,    -1,   495,    -1,    -1,   498,   499,   500,
+     501,   502,   503,    -1,    -1,   506,    -1,   508,   509,    -1,
+      -1,    -1,    -1,    -1,    -1,   516,   517,   518,   519,   520,
+     154,    -1,    -1,    -1,   158,   159,   160,    -1,    -1,    -1,
+     164,   165,    -1,    -1,   168,    -1,     3,     4,     5,     6,
+      -1,    -1,   176,    10,    11,    12,   180,    -1,    -1,     1,
+      -1,     3,     4,     5,     6,   189,    -1,    -1,    10,    11,
+      12,    -1,    -1,   197,    -1,    -1,    -1,   154,    -1,    -1,
+      22,    23,    -1,    -1,    -1,    -1,    -1,    -1,   165,   166,
+     167,   168,    -1,   217,    -1,   219,    -1,   221,   222,     1,
+     224,     3,     4,     5,     6,    -1,    -1,     9,    10,    11,
+      12,    -1,    -1,    -1,    16,    17,    18,    19,    20,    -1,
+      22,    23,     3,     4,     5,     6,    -1,    -1,   252,    10,
+      11,    12,    -1,    -1,    -1,    16,    17,    18,    19,    20,
+       7,    -1,    -1,    -1,    -1,    -1,    13,   271,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,   280,   281,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    -1,    -1,    42,    43,    44,    45,    46,
+     122,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,    -1,   110,   111,   112,   113,   114,   115,    -1,
+      -1,    -1,   154,    -1,    -1,    -1,    -1,   159,    -1,    -1,
+      -1,     1,    -1,     3,     4,     5,     6,    -1,   392,     9,
+      10,    11,    12,   154,    -1,    -1,    16,    17,    18,    19,
+      20,    -1,    22,    23,    -1,    -1,   153,     1,    -1,     3,
+       4,     5,     6,    -1,   161,   162,    10,    11,    12,    -1,
+      -1,    -1,    16,    17,    18,    19,    20,    -1,    22,    23,
+      -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,    13,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    -1,    -1,    42,    43,    44,
+      45,    46,   476,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   154,   110,   111,   112,   113,   114,
+     115,    -1,    -1,    -1,    -1,    -1,     1,    -1,     3,     4,
+       5,     6,    -1,    -1,     9,    10,    11,    12,    -1,    -1,
+     154,    16,    17,    18,    19,    20,     1,    -1,     3,     4,
+       5,     6,    -1,    -1,     9,    10,    11,    12,    -1,    -1,
+      -1,    16,    17,    18,    19,    20,   161,   162,     1,    -1,
        3,     4,     5,     6,    -1,    -1,     9,    10,    11,    12,
-      -1,    -1,   156,    16,    17,    18,    19,    20,    -1,    22,
-      23,   309,    -1,   311,    -1,    -1,   170,    -1,    -1,    -1,
-      -1,    -1,    -1,     3,     4,     5,     6,   325,   326,    -1,
-      10,    11,    12,    -1,    -1,    -1,    16,    17,    18,    19,
-      20,    -1,    -1,   428,    -1,    -1,    -1,    -1,   433,    -1,
-      -1,    -1,   437,    -1,    -1,    -1,    -1,   442,   443,   357,
-       3,     4,     5,     6,   362,   363,    -1,    10,    11,    12,
-      -1,    -1,    -1,    16,    17,    18,    19,    20,    -1,     3,
-       4,     5,     6,    -1,    -1,    -1,    10,    11,    12,    -1,
-      -1,   389,    16,    17,    18,    19,    20,   137,   138,   139,
-     140,   141,   142,   401,    -1,    -1,   404,    -1,   406,   407,
-     408,   409,    -1,    -1,     1,    -1,     3,     4,     5,     6,
-      -1,   419,     9,    10,    11,    12,    -1,    -1,    -1,    16,
-      17,    18,    19,    20,    -1,    22,    23,    -1,    -1,    -1,
-     153,    -1,   527,    -1,    -1,   530,   531,    -1,   533,   534,
-     535,   164,   165,   166,   167,   453,    -1,   455,    -1,    -1,
-     458,    -1,   460,    -1,   462,   463,    -1,    -1,   466,    -1,
-      -1,    -1,    -1,    -1,   472,   473,   156,    -1,   476,    -1,
-     478,   479,   480,    -1,    -1,    -1,   484,    -1,   168,    -1,
-     488,    -1,    -1,   491,    -1,    -1,   494,   495,   496,   497,
-     498,   499,    -1,    -1,   502,   590,   504,   505,    -1,    -1,
-      -1,    -1,    -1,   156,   512,   513,   514,   515,   516,    -1,
-      -1,   164,   165,   166,   167,   168,    -1,    -1,    -1,   153,
+      -1,    -1,    -1,    16,    17,    18,    19,    20,     1,    -1,
        3,     4,     5,     6,    -1,    -1,    -1,    10,    11,    12,
-     164,   165,   166,   167,    -1,    -1,     1,    -1,     3,     4,
-       5,     6,    -1,    -1,     7,    10,    11,    12,    -1,    -1,
-      13,    16,    17,    18,    19,    20,   153,    22,    23,    22,
-      -1,   158,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    -1,    -1,    42,
-      43,    44,    45,    46,    -1,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
-      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
-      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,    -1,   110,   111,   112,
-     113,   114,     1,    -1,     3,     4,     5,     6,    -1,    -1,
-       9,    10,    11,    12,    -1,    14,   149,    16,    17,    18,
-      19,    20,    -1,    22,    23,    -1,     3,     4,     5,     6,
-      -1,     7,     9,    10,    11,    12,    -1,    13,   153,   152,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   160,   161,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    45,
-      46,    -1,    48,    49,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
-     106,   107,   108,    -1,   110,   111,   112,   113,   114,    -1,
-       1,    -1,     3,     4,     5,     6,    -1,    -1,     9,    10,
-      11,    12,    -1,    -1,   153,    16,    17,    18,    19,    20,
-      -1,    22,    23,     1,    -1,     3,     4,     5,     6,    -1,
-      -1,     9,    10,    11,    12,    -1,    -1,    -1,    16,    17,
-      18,    19,    20,    -1,   160,   161,     1,    -1,     3,     4,
-       5,     6,    -1,    -1,     9,    10,    11,    12,    -1,    -1,
-      -1,    16,    17,    18,    19,    20,     1,    -1,     3,     4,
+      -1,    -1,    -1,    16,    17,    18,    19,    20,     3,     4,
        5,     6,    -1,    -1,     9,    10,    11,    12,    -1,    -1,
       -1,    16,    17,    18,    19,    20,     1,    -1,     3,     4,
        5,     6,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,
-      -1,    16,    17,    18,    19,    20,     3,     4,     5,     6,
-      -1,    -1,     9,    10,    11,    12,    -1,    -1,    -1,    16,
-      17,    18,    19,    20,     3,     4,     5,     6,    -1,    -1,
-      -1,    10,    11,    12,    -1,    -1,    -1,    16,    17,    18,
-      19,    20,     1,    -1,     1,    -1,     3,     4,     5,     6,
-      -1,    -1,   153,    10,    11,    12,    -1,    16,    17,    18,
-      19,    20,    -1,    22,    23,    22,    23,    -1,    -1,     3,
-       4,     5,     6,    -1,    -1,   153,    10,    11,    12,     3,
-       4,     5,     6,    -1,    -1,    -1,    10,    11,    12,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,     3,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,     3,
+       4,     5,     6,    -1,    -1,    -1,    10,    11,    12,     3,
        4,     5,     6,    -1,    -1,    -1,    10,    11,    12,    -1,
-      -1,    -1,    -1,     3,     4,     5,     6,    -1,   153,    -1,
-      10,    11,    12,     1,    -1,     3,     4,     5,     6,    -1,
-      -1,    -1,    10,    11,    12,    -1,    -1,    -1,   153,    -1,
-      -1,    -1,    -1,    -1,    22,    23,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   121,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,    -1,    -1,
-      -1,   115,    -1,   117,   118,    -1,    -1,   121,    -1,   123,
-      -1,   125,   149,    -1,    -1,    -1,   130,   131,   132,   133,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   154,
+      -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,    -1,
+      -1,    10,    11,    12,    -1,    -1,    -1,    -1,    -1,   154,
+       3,     4,     5,     6,    -1,    -1,    -1,    10,    11,    12,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   154,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   154,    -1,    -1,    -1,    -1,    -1,   122,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   154,
+      -1,    -1,   116,    -1,   118,   119,    -1,    -1,   122,    -1,
+     124,    -1,   126,    -1,    -1,   150,    -1,   131,   132,   133,
      134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,    -1,   118,    -1,    -1,   121,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   130,    -1,   132,   119,
-     120,    -1,    -1,    -1,    -1,    -1,   126,   127,   128,    -1,
-      -1,    -1,    -1,   121
+     144,   145,   146,   147,   138,   139,   140,   141,   142,   143,
+     119,    -1,    -1,   122,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   131,    -1,   133,    -1,    -1,   120,   121,    -1,
+      -1,    -1,    -1,    -1,   127,   128,   129
 };
 
   /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
@@ -1560,97 +1583,98 @@ static const yytype_uint8 yystos[] =
       84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
       94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
      104,   105,   106,   107,   108,   110,   111,   112,   113,   114,
-     152,   160,   161,   173,   174,   176,   177,   178,   179,   180,
-     182,   183,   184,   185,   186,   187,   188,   189,   190,   222,
-       3,     4,     5,     6,    10,    11,    12,    16,    17,    18,
-      19,    20,   156,   168,   197,   206,   209,   217,   219,   220,
-       1,    22,    23,   162,   175,   175,   209,   209,   121,   175,
-     205,   175,   205,     1,   150,   193,   193,   193,     1,     4,
-      10,    11,    12,   200,   218,     9,   153,   202,   204,   206,
-     207,   208,   220,   202,   202,   175,   204,   206,   175,   197,
-     198,   199,   206,   158,   175,   158,   175,   201,   202,   204,
-      14,   175,   195,   196,   175,   196,   175,   204,   202,   193,
-     193,   175,     1,   175,   200,   200,   200,   204,   175,   201,
-     175,   205,   175,   205,   209,   206,   151,   175,   191,   175,
-     196,   191,   175,   191,   154,   175,   206,   193,   206,   193,
-     206,   204,   153,   206,   175,   206,   175,   206,   193,   175,
-     193,   175,   201,   175,   201,   175,   201,   175,   201,   204,
-     175,   191,   193,   193,   175,   175,   201,   155,   175,   175,
-     175,   193,   175,   151,   192,   149,   149,   193,   193,   193,
-     209,   175,   205,   205,   175,   175,   205,   175,   175,   205,
-     193,   192,     1,   175,   194,   209,   109,   175,   175,   193,
-     193,   162,    21,   115,   117,   118,   121,   123,   125,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   220,   224,   175,   200,
-     175,   200,     0,   176,    22,   209,   156,   164,   165,   166,
-     167,   175,   175,   209,   209,   209,   209,     1,   194,     1,
-     194,   194,   175,   205,   205,   205,   205,   205,   205,   175,
-     205,    21,   121,   175,   175,   175,   205,   175,    14,   201,
-     201,   175,   205,   175,   175,   175,    15,     1,   205,   175,
-     181,   175,   209,   209,   175,   175,   175,   201,   175,   175,
-     175,   175,   205,   175,   205,   175,   205,   205,   175,   205,
-     175,   175,   175,   175,   175,   175,   175,   175,   149,   213,
-     214,   220,   175,   194,   194,   175,   175,   175,   205,   175,
-     175,   149,   175,   175,   209,   175,   209,   209,   209,   209,
-     205,   175,   175,   175,   175,   205,   175,   205,   175,   204,
-     137,   138,   139,   140,   141,   142,   220,   220,   121,   119,
-     120,   126,   127,   148,   225,   226,   118,   121,   130,   132,
-     220,   220,   121,   121,   121,   175,   175,     1,   169,   209,
-     209,   209,   209,   203,   205,   204,   175,   175,   203,     1,
-     202,     1,   204,   209,   149,   163,   215,   216,   220,   204,
-       9,   207,   213,   204,   220,   199,   201,    15,   210,   210,
-     204,   115,   170,   197,   211,   212,   220,   175,   149,   221,
-     222,   223,   175,   175,   210,   154,   193,   193,   153,   153,
-     175,   205,   203,     1,   202,   209,   175,   175,   175,   175,
-     175,   175,   201,   209,   220,   220,    24,   175,   116,   116,
-     116,   116,   116,   116,   116,   121,   225,   148,   225,   147,
-     121,   148,   225,   121,   121,   121,   124,   225,   225,   119,
-     120,   127,   128,   220,   226,   175,   204,   175,   175,   175,
-     175,   175,   175,   216,   175,   175,   175,   211,   175,   175,
-     175,   211,   154,   157,   175,   175,   122,   122,   175,   175,
-     175,   175,   175,   175,   175,   214,   175,   175,   175,   175,
-     175,   175,   175,   175,   121,   119,   127,   225,   147,   225,
-     148,   225,   124,   147,   225,   225,   128,   225,   121,     1,
-     116,   171,     1,   211,   222,   222,   118,   120,   139,   140,
-     141,   116,   116,   124,   225,   124,   124,   147,   124,   124,
-     124,   124,   120,   204,   121,   124,   124,   120
+     115,   153,   161,   162,   174,   175,   177,   178,   179,   180,
+     181,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     223,     3,     4,     5,     6,    10,    11,    12,    16,    17,
+      18,    19,    20,   157,   169,   198,   207,   210,   218,   220,
+     221,     1,    22,    23,   163,   176,   176,   210,   210,   122,
+     176,   206,   176,   206,     1,   151,   194,   194,   194,     1,
+       4,    10,    11,    12,   201,   219,     9,   154,   203,   205,
+     207,   208,   209,   221,   203,   203,   176,   205,   207,   176,
+     198,   199,   200,   207,   159,   176,   159,   176,   202,   203,
+     205,    14,   176,   196,   197,   176,   197,   176,   205,   203,
+     194,   194,   176,     1,   176,   201,   201,   201,   205,   176,
+     202,   176,   206,   176,   206,   210,   207,   152,   176,   192,
+     176,   197,   192,   176,   192,   155,   176,   207,   194,   207,
+     194,   207,   205,   154,   207,   176,   207,   176,   207,   194,
+     176,   194,   176,   202,   176,   202,   176,   202,   176,   202,
+     205,   176,   192,   194,   194,   176,   176,   202,   156,   176,
+     176,   176,   194,   176,   152,   193,   150,   150,   194,   194,
+     194,   210,   176,   206,   206,   176,   176,   206,   176,   176,
+     206,   194,   193,     1,   176,   195,   210,   109,   176,   176,
+     194,   194,   163,   109,   176,    21,   116,   118,   119,   122,
+     124,   126,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   221,
+     225,   176,   201,   176,   201,     0,   177,    22,   210,   157,
+     165,   166,   167,   168,   176,   176,   210,   210,   210,   210,
+       1,   195,     1,   195,   195,   176,   206,   206,   206,   206,
+     206,   206,   176,   206,    21,   122,   176,   176,   176,   206,
+     176,    14,   202,   202,   176,   206,   176,   176,   176,    15,
+       1,   206,   176,   182,   176,   210,   210,   176,   176,   176,
+     202,   176,   176,   176,   176,   206,   176,   206,   176,   206,
+     206,   176,   206,   176,   176,   176,   176,   176,   176,   176,
+     176,   150,   214,   215,   221,   176,   195,   195,   176,   176,
+     176,   206,   176,   176,   150,   176,   176,   210,   176,   210,
+     210,   210,   210,   206,   176,   176,   176,   176,   206,   176,
+     206,   176,   176,   205,   138,   139,   140,   141,   142,   143,
+     221,   221,   122,   120,   121,   127,   128,   149,   226,   227,
+     119,   122,   131,   133,   221,   221,   122,   122,   122,   176,
+     176,     1,   170,   210,   210,   210,   210,   204,   206,   205,
+     176,   176,   204,     1,   203,     1,   205,   210,   150,   164,
+     216,   217,   221,   205,     9,   208,   214,   205,   221,   200,
+     202,    15,   211,   211,   205,   116,   171,   198,   212,   213,
+     221,   176,   150,   222,   223,   224,   176,   176,   211,   155,
+     194,   194,   154,   154,   176,   206,   204,     1,   203,   210,
+     176,   176,   176,   176,   176,   176,   202,   210,   221,   221,
+      24,   176,   117,   117,   117,   117,   117,   117,   117,   122,
+     226,   149,   226,   148,   122,   149,   226,   122,   122,   122,
+     125,   226,   226,   120,   121,   128,   129,   221,   227,   176,
+     205,   176,   176,   176,   176,   176,   176,   217,   176,   176,
+     176,   212,   176,   176,   176,   212,   155,   158,   176,   176,
+     123,   123,   176,   176,   176,   176,   176,   176,   176,   215,
+     176,   176,   176,   176,   176,   176,   176,   176,   122,   120,
+     128,   226,   148,   226,   149,   226,   125,   148,   226,   226,
+     129,   226,   122,     1,   117,   172,     1,   212,   223,   223,
+     119,   121,   140,   141,   142,   117,   117,   125,   226,   125,
+     125,   148,   125,   125,   125,   125,   121,   205,   122,   125,
+     125,   121
 };
 
   /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,   172,   173,   173,   173,   174,   174,   175,   175,   175,
-     176,   176,   176,   176,   176,   176,   176,   176,   176,   176,
-     176,   176,   176,   177,   177,   177,   177,   177,   177,   177,
+       0,   173,   174,   174,   174,   175,   175,   176,   176,   176,
      177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
-     177,   177,   177,   177,   177,   177,   177,   177,   178,   178,
-     178,   179,   179,   179,   179,   179,   179,   179,   179,   179,
-     179,   179,   179,   179,   181,   180,   180,   180,   180,   182,
-     182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
-     182,   182,   182,   182,   182,   182,   182,   182,   182,   183,
-     183,   183,   183,   183,   183,   183,   183,   184,   184,   184,
-     184,   184,   184,   184,   184,   184,   184,   184,   185,   185,
-     185,   185,   185,   185,   185,   185,   185,   186,   186,   186,
-     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
-     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
+     177,   177,   177,   178,   178,   178,   178,   178,   178,   178,
+     178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
+     178,   178,   178,   178,   178,   178,   178,   178,   179,   179,
+     179,   180,   180,   180,   180,   180,   180,   180,   180,   180,
+     180,   180,   180,   180,   182,   181,   181,   181,   181,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   184,
+     184,   184,   184,   184,   184,   184,   184,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   186,   186,
+     186,   186,   186,   186,   186,   186,   186,   187,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
      187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
-     187,   187,   187,   187,   187,   187,   187,   187,   187,   188,
-     188,   188,   189,   189,   190,   191,   192,   192,   193,   193,
+     187,   187,   188,   188,   188,   188,   188,   188,   188,   188,
+     188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
+     188,   189,   189,   189,   190,   190,   191,   192,   193,   193,
      194,   194,   195,   195,   196,   196,   197,   197,   198,   198,
-     199,   200,   200,   201,   201,   202,   202,   202,   203,   203,
-     204,   204,   204,   205,   205,   206,   206,   206,   206,   206,
-     207,   208,   209,   209,   209,   209,   209,   209,   209,   210,
-     210,   211,   211,   211,   211,   211,   212,   212,   212,   213,
-     213,   214,   214,   215,   215,   216,   216,   216,   217,   217,
-     218,   218,   218,   218,   219,   219,   219,   220,   220,   220,
-     220,   220,   221,   221,   221,   222,   223,   223,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     225,   225,   225,   225,   226
+     199,   199,   200,   201,   201,   202,   202,   203,   203,   203,
+     204,   204,   205,   205,   205,   206,   206,   207,   207,   207,
+     207,   207,   208,   209,   210,   210,   210,   210,   210,   210,
+     210,   211,   211,   212,   212,   212,   212,   212,   213,   213,
+     213,   214,   214,   215,   215,   216,   216,   217,   217,   217,
+     218,   218,   219,   219,   219,   219,   220,   220,   220,   221,
+     221,   221,   221,   221,   222,   222,   222,   223,   224,   224,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   226,   226,   226,   226,   227
 };
 
   /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
@@ -1670,24 +1694,24 @@ static const yytype_uint8 yyr2[] =
        3,     2,     3,     2,     2,     2,     3,     3,     3,     2,
        3,     3,     3,     3,     2,     3,     2,     3,     5,     3,
        4,     3,     3,     2,     4,     4,     2,     3,     3,     2,
-       5,     5,     5,     3,     4,     5,     4,     5,     4,     5,
-       5,     2,     3,     4,     3,     3,     5,     3,     5,     3,
-       2,     3,     4,     2,     2,     1,     1,     0,     1,     1,
-       1,     1,     2,     1,     1,     0,     1,     2,     3,     1,
-       3,     1,     1,     1,     1,     3,     1,     3,     2,     0,
-       1,     3,     1,     1,     0,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     3,     3,     3,     3,     1,     2,
-       0,     3,     3,     3,     3,     1,     1,     1,     4,     3,
-       1,     1,     1,     2,     1,     1,     1,     1,     1,     1,
+       3,     2,     5,     5,     5,     3,     4,     5,     4,     5,
+       4,     5,     5,     2,     3,     4,     3,     3,     5,     3,
+       5,     3,     2,     3,     4,     2,     2,     1,     1,     0,
+       1,     1,     1,     1,     2,     1,     1,     0,     1,     2,
+       3,     1,     3,     1,     1,     1,     1,     3,     1,     3,
+       2,     0,     1,     3,     1,     1,     0,     1,     1,     1,
+       1,     1,     1,     1,     3,     3,     3,     3,     3,     3,
+       1,     2,     0,     3,     3,     3,     3,     1,     1,     1,
+       4,     3,     1,     1,     1,     2,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     2,     2,     1,     1,     2,     1,
-       3,     3,     3,     3,     3,     5,     7,     5,     3,     3,
-       3,     3,     3,     3,     5,     5,     5,     5,     0,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     3,     3,
-       4,     3,     4,     2,     3,     3,     3,     3,     5,     5,
-       6,     5,     6,     4,     5,     5,     5,     5,     3,     5,
-       1,     1,     1,     1,     1
+       1,     1,     1,     1,     3,     3,     2,     2,     1,     1,
+       2,     1,     3,     3,     3,     3,     3,     5,     7,     5,
+       3,     3,     3,     3,     3,     3,     5,     5,     5,     5,
+       0,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       3,     3,     4,     3,     4,     2,     3,     3,     3,     3,
+       5,     5,     6,     5,     6,     4,     5,     5,     5,     5,
+       3,     5,     1,     1,     1,     1,     1
 };
 
 
@@ -2364,431 +2388,431 @@ yyreduce:
   switch (yyn)
     {
         case 2:
-#line 199 "mon_parse.y" /* yacc.c:1646  */
+#line 200 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = 0; }
-#line 2370 "mon_parse.c" /* yacc.c:1646  */
+#line 2394 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 3:
-#line 200 "mon_parse.y" /* yacc.c:1646  */
+#line 201 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = 0; }
-#line 2376 "mon_parse.c" /* yacc.c:1646  */
+#line 2400 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 4:
-#line 201 "mon_parse.y" /* yacc.c:1646  */
+#line 202 "mon_parse.y" /* yacc.c:1646  */
     { new_cmd = 1; asm_mode = 0;  (yyval.i) = 0; }
-#line 2382 "mon_parse.c" /* yacc.c:1646  */
+#line 2406 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 9:
-#line 210 "mon_parse.y" /* yacc.c:1646  */
+#line 211 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_EXPECT_END_CMD; }
-#line 2388 "mon_parse.c" /* yacc.c:1646  */
+#line 2412 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 22:
-#line 225 "mon_parse.y" /* yacc.c:1646  */
+#line 226 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_BAD_CMD; }
-#line 2394 "mon_parse.c" /* yacc.c:1646  */
+#line 2418 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 23:
-#line 229 "mon_parse.y" /* yacc.c:1646  */
+#line 230 "mon_parse.y" /* yacc.c:1646  */
     { mon_bank(e_default_space, NULL); }
-#line 2400 "mon_parse.c" /* yacc.c:1646  */
+#line 2424 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 24:
-#line 231 "mon_parse.y" /* yacc.c:1646  */
+#line 232 "mon_parse.y" /* yacc.c:1646  */
     { mon_bank((yyvsp[-1].i), NULL); }
-#line 2406 "mon_parse.c" /* yacc.c:1646  */
+#line 2430 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 25:
-#line 233 "mon_parse.y" /* yacc.c:1646  */
+#line 234 "mon_parse.y" /* yacc.c:1646  */
     { mon_bank(e_default_space, (yyvsp[-1].str)); }
-#line 2412 "mon_parse.c" /* yacc.c:1646  */
+#line 2436 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 26:
-#line 235 "mon_parse.y" /* yacc.c:1646  */
+#line 236 "mon_parse.y" /* yacc.c:1646  */
     { mon_bank((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2418 "mon_parse.c" /* yacc.c:1646  */
+#line 2442 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 27:
-#line 237 "mon_parse.y" /* yacc.c:1646  */
+#line 238 "mon_parse.y" /* yacc.c:1646  */
     { mon_jump((yyvsp[-1].a)); }
-#line 2424 "mon_parse.c" /* yacc.c:1646  */
+#line 2448 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 28:
-#line 239 "mon_parse.y" /* yacc.c:1646  */
+#line 240 "mon_parse.y" /* yacc.c:1646  */
     { mon_go(); }
-#line 2430 "mon_parse.c" /* yacc.c:1646  */
+#line 2454 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 29:
-#line 241 "mon_parse.y" /* yacc.c:1646  */
+#line 242 "mon_parse.y" /* yacc.c:1646  */
     { mon_display_io_regs(0); }
-#line 2436 "mon_parse.c" /* yacc.c:1646  */
+#line 2460 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 30:
-#line 243 "mon_parse.y" /* yacc.c:1646  */
+#line 244 "mon_parse.y" /* yacc.c:1646  */
     { mon_display_io_regs((yyvsp[-1].a)); }
-#line 2442 "mon_parse.c" /* yacc.c:1646  */
+#line 2466 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 31:
-#line 245 "mon_parse.y" /* yacc.c:1646  */
+#line 246 "mon_parse.y" /* yacc.c:1646  */
     { monitor_cpu_type_set(""); }
-#line 2448 "mon_parse.c" /* yacc.c:1646  */
+#line 2472 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 32:
-#line 247 "mon_parse.y" /* yacc.c:1646  */
+#line 248 "mon_parse.y" /* yacc.c:1646  */
     { monitor_cpu_type_set((yyvsp[-1].str)); }
-#line 2454 "mon_parse.c" /* yacc.c:1646  */
+#line 2478 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 33:
-#line 249 "mon_parse.y" /* yacc.c:1646  */
+#line 250 "mon_parse.y" /* yacc.c:1646  */
     { mon_cpuhistory(-1); }
-#line 2460 "mon_parse.c" /* yacc.c:1646  */
+#line 2484 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 34:
-#line 251 "mon_parse.y" /* yacc.c:1646  */
+#line 252 "mon_parse.y" /* yacc.c:1646  */
     { mon_cpuhistory((yyvsp[-1].i)); }
-#line 2466 "mon_parse.c" /* yacc.c:1646  */
+#line 2490 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 35:
-#line 253 "mon_parse.y" /* yacc.c:1646  */
+#line 254 "mon_parse.y" /* yacc.c:1646  */
     { mon_instruction_return(); }
-#line 2472 "mon_parse.c" /* yacc.c:1646  */
+#line 2496 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 36:
-#line 255 "mon_parse.y" /* yacc.c:1646  */
+#line 256 "mon_parse.y" /* yacc.c:1646  */
     { machine_write_snapshot((yyvsp[-1].str),0,0,0); /* FIXME */ }
-#line 2478 "mon_parse.c" /* yacc.c:1646  */
+#line 2502 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 37:
-#line 257 "mon_parse.y" /* yacc.c:1646  */
+#line 258 "mon_parse.y" /* yacc.c:1646  */
     { machine_read_snapshot((yyvsp[-1].str), 0); }
-#line 2484 "mon_parse.c" /* yacc.c:1646  */
+#line 2508 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 38:
-#line 259 "mon_parse.y" /* yacc.c:1646  */
+#line 260 "mon_parse.y" /* yacc.c:1646  */
     { mon_instructions_step(-1); }
-#line 2490 "mon_parse.c" /* yacc.c:1646  */
+#line 2514 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 39:
-#line 261 "mon_parse.y" /* yacc.c:1646  */
+#line 262 "mon_parse.y" /* yacc.c:1646  */
     { mon_instructions_step((yyvsp[-1].i)); }
-#line 2496 "mon_parse.c" /* yacc.c:1646  */
+#line 2520 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 40:
-#line 263 "mon_parse.y" /* yacc.c:1646  */
+#line 264 "mon_parse.y" /* yacc.c:1646  */
     { mon_instructions_next(-1); }
-#line 2502 "mon_parse.c" /* yacc.c:1646  */
+#line 2526 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 41:
-#line 265 "mon_parse.y" /* yacc.c:1646  */
+#line 266 "mon_parse.y" /* yacc.c:1646  */
     { mon_instructions_next((yyvsp[-1].i)); }
-#line 2508 "mon_parse.c" /* yacc.c:1646  */
+#line 2532 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 42:
-#line 267 "mon_parse.y" /* yacc.c:1646  */
+#line 268 "mon_parse.y" /* yacc.c:1646  */
     { mon_stack_up(-1); }
-#line 2514 "mon_parse.c" /* yacc.c:1646  */
+#line 2538 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 43:
-#line 269 "mon_parse.y" /* yacc.c:1646  */
+#line 270 "mon_parse.y" /* yacc.c:1646  */
     { mon_stack_up((yyvsp[-1].i)); }
-#line 2520 "mon_parse.c" /* yacc.c:1646  */
+#line 2544 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 44:
-#line 271 "mon_parse.y" /* yacc.c:1646  */
+#line 272 "mon_parse.y" /* yacc.c:1646  */
     { mon_stack_down(-1); }
-#line 2526 "mon_parse.c" /* yacc.c:1646  */
+#line 2550 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 45:
-#line 273 "mon_parse.y" /* yacc.c:1646  */
+#line 274 "mon_parse.y" /* yacc.c:1646  */
     { mon_stack_down((yyvsp[-1].i)); }
-#line 2532 "mon_parse.c" /* yacc.c:1646  */
+#line 2556 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 46:
-#line 275 "mon_parse.y" /* yacc.c:1646  */
+#line 276 "mon_parse.y" /* yacc.c:1646  */
     { mon_display_screen(); }
-#line 2538 "mon_parse.c" /* yacc.c:1646  */
+#line 2562 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 48:
-#line 280 "mon_parse.y" /* yacc.c:1646  */
+#line 281 "mon_parse.y" /* yacc.c:1646  */
     { (monitor_cpu_for_memspace[default_memspace]->mon_register_print)(default_memspace); }
-#line 2544 "mon_parse.c" /* yacc.c:1646  */
+#line 2568 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 49:
-#line 282 "mon_parse.y" /* yacc.c:1646  */
+#line 283 "mon_parse.y" /* yacc.c:1646  */
     { (monitor_cpu_for_memspace[(yyvsp[-1].i)]->mon_register_print)((yyvsp[-1].i)); }
-#line 2550 "mon_parse.c" /* yacc.c:1646  */
+#line 2574 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 51:
-#line 287 "mon_parse.y" /* yacc.c:1646  */
+#line 288 "mon_parse.y" /* yacc.c:1646  */
     {
                         /* What about the memspace? */
                         mon_playback_init((yyvsp[-1].str));
                     }
-#line 2559 "mon_parse.c" /* yacc.c:1646  */
+#line 2583 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 52:
-#line 292 "mon_parse.y" /* yacc.c:1646  */
+#line 293 "mon_parse.y" /* yacc.c:1646  */
     {
                         /* What about the memspace? */
                         mon_playback_init((yyvsp[-1].str));
                     }
-#line 2568 "mon_parse.c" /* yacc.c:1646  */
+#line 2592 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 53:
-#line 297 "mon_parse.y" /* yacc.c:1646  */
+#line 298 "mon_parse.y" /* yacc.c:1646  */
     { mon_save_symbols((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2574 "mon_parse.c" /* yacc.c:1646  */
+#line 2598 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 54:
-#line 299 "mon_parse.y" /* yacc.c:1646  */
+#line 300 "mon_parse.y" /* yacc.c:1646  */
     { mon_save_symbols(e_default_space, (yyvsp[-1].str)); }
-#line 2580 "mon_parse.c" /* yacc.c:1646  */
+#line 2604 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 55:
-#line 301 "mon_parse.y" /* yacc.c:1646  */
+#line 302 "mon_parse.y" /* yacc.c:1646  */
     { mon_add_name_to_symbol_table((yyvsp[-3].a), (yyvsp[-1].str)); }
-#line 2586 "mon_parse.c" /* yacc.c:1646  */
+#line 2610 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 56:
-#line 303 "mon_parse.y" /* yacc.c:1646  */
+#line 304 "mon_parse.y" /* yacc.c:1646  */
     { mon_remove_name_from_symbol_table(e_default_space, (yyvsp[-1].str)); }
-#line 2592 "mon_parse.c" /* yacc.c:1646  */
+#line 2616 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 57:
-#line 305 "mon_parse.y" /* yacc.c:1646  */
+#line 306 "mon_parse.y" /* yacc.c:1646  */
     { mon_remove_name_from_symbol_table((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2598 "mon_parse.c" /* yacc.c:1646  */
+#line 2622 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 58:
-#line 307 "mon_parse.y" /* yacc.c:1646  */
+#line 308 "mon_parse.y" /* yacc.c:1646  */
     { mon_print_symbol_table((yyvsp[-1].i)); }
-#line 2604 "mon_parse.c" /* yacc.c:1646  */
+#line 2628 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 59:
-#line 309 "mon_parse.y" /* yacc.c:1646  */
+#line 310 "mon_parse.y" /* yacc.c:1646  */
     { mon_print_symbol_table(e_default_space); }
-#line 2610 "mon_parse.c" /* yacc.c:1646  */
+#line 2634 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 60:
-#line 311 "mon_parse.y" /* yacc.c:1646  */
+#line 312 "mon_parse.y" /* yacc.c:1646  */
     { mon_clear_symbol_table((yyvsp[-1].i)); }
-#line 2616 "mon_parse.c" /* yacc.c:1646  */
+#line 2640 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 61:
-#line 313 "mon_parse.y" /* yacc.c:1646  */
+#line 314 "mon_parse.y" /* yacc.c:1646  */
     { mon_clear_symbol_table(e_default_space); }
-#line 2622 "mon_parse.c" /* yacc.c:1646  */
+#line 2646 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 62:
-#line 315 "mon_parse.y" /* yacc.c:1646  */
+#line 316 "mon_parse.y" /* yacc.c:1646  */
     {
                         mon_add_name_to_symbol_table((yyvsp[-1].a), mon_prepend_dot_to_name((yyvsp[-3].str)));
                     }
-#line 2630 "mon_parse.c" /* yacc.c:1646  */
+#line 2654 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 63:
-#line 319 "mon_parse.y" /* yacc.c:1646  */
+#line 320 "mon_parse.y" /* yacc.c:1646  */
     {
                         mon_add_name_to_symbol_table((yyvsp[-2].a), mon_prepend_dot_to_name((yyvsp[-4].str)));
                     }
-#line 2638 "mon_parse.c" /* yacc.c:1646  */
+#line 2662 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 64:
-#line 325 "mon_parse.y" /* yacc.c:1646  */
+#line 326 "mon_parse.y" /* yacc.c:1646  */
     { mon_start_assemble_mode((yyvsp[0].a), NULL); }
-#line 2644 "mon_parse.c" /* yacc.c:1646  */
+#line 2668 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 65:
-#line 326 "mon_parse.y" /* yacc.c:1646  */
+#line 327 "mon_parse.y" /* yacc.c:1646  */
     { }
-#line 2650 "mon_parse.c" /* yacc.c:1646  */
+#line 2674 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 66:
-#line 328 "mon_parse.y" /* yacc.c:1646  */
+#line 329 "mon_parse.y" /* yacc.c:1646  */
     { mon_start_assemble_mode((yyvsp[-1].a), NULL); }
-#line 2656 "mon_parse.c" /* yacc.c:1646  */
+#line 2680 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 67:
-#line 330 "mon_parse.y" /* yacc.c:1646  */
+#line 331 "mon_parse.y" /* yacc.c:1646  */
     { mon_disassemble_lines((yyvsp[-1].range)[0], (yyvsp[-1].range)[1]); }
-#line 2662 "mon_parse.c" /* yacc.c:1646  */
+#line 2686 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 68:
-#line 332 "mon_parse.y" /* yacc.c:1646  */
+#line 333 "mon_parse.y" /* yacc.c:1646  */
     { mon_disassemble_lines(BAD_ADDR, BAD_ADDR); }
-#line 2668 "mon_parse.c" /* yacc.c:1646  */
+#line 2692 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 69:
-#line 336 "mon_parse.y" /* yacc.c:1646  */
+#line 337 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_move((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
-#line 2674 "mon_parse.c" /* yacc.c:1646  */
+#line 2698 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 70:
-#line 338 "mon_parse.y" /* yacc.c:1646  */
+#line 339 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_compare((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
-#line 2680 "mon_parse.c" /* yacc.c:1646  */
+#line 2704 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 71:
-#line 340 "mon_parse.y" /* yacc.c:1646  */
+#line 341 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_fill((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
-#line 2686 "mon_parse.c" /* yacc.c:1646  */
+#line 2710 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 72:
-#line 342 "mon_parse.y" /* yacc.c:1646  */
+#line 343 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_hunt((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
-#line 2692 "mon_parse.c" /* yacc.c:1646  */
+#line 2716 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 73:
-#line 344 "mon_parse.y" /* yacc.c:1646  */
+#line 345 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display((yyvsp[-3].rt), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
-#line 2698 "mon_parse.c" /* yacc.c:1646  */
+#line 2722 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 74:
-#line 346 "mon_parse.y" /* yacc.c:1646  */
+#line 347 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display(default_radix, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
-#line 2704 "mon_parse.c" /* yacc.c:1646  */
+#line 2728 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 75:
-#line 348 "mon_parse.y" /* yacc.c:1646  */
+#line 349 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display(default_radix, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
-#line 2710 "mon_parse.c" /* yacc.c:1646  */
+#line 2734 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 76:
-#line 350 "mon_parse.y" /* yacc.c:1646  */
+#line 351 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 8, 8); }
-#line 2716 "mon_parse.c" /* yacc.c:1646  */
+#line 2740 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 77:
-#line 352 "mon_parse.y" /* yacc.c:1646  */
+#line 353 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 8, 8); }
-#line 2722 "mon_parse.c" /* yacc.c:1646  */
+#line 2746 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 78:
-#line 354 "mon_parse.y" /* yacc.c:1646  */
+#line 355 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 24, 21); }
-#line 2728 "mon_parse.c" /* yacc.c:1646  */
+#line 2752 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 79:
-#line 356 "mon_parse.y" /* yacc.c:1646  */
+#line 357 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 24, 21); }
-#line 2734 "mon_parse.c" /* yacc.c:1646  */
+#line 2758 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 80:
-#line 358 "mon_parse.y" /* yacc.c:1646  */
+#line 359 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
-#line 2740 "mon_parse.c" /* yacc.c:1646  */
+#line 2764 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 81:
-#line 360 "mon_parse.y" /* yacc.c:1646  */
+#line 361 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
-#line 2746 "mon_parse.c" /* yacc.c:1646  */
+#line 2770 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 82:
-#line 362 "mon_parse.y" /* yacc.c:1646  */
+#line 363 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_SCREEN_CODE); }
-#line 2752 "mon_parse.c" /* yacc.c:1646  */
+#line 2776 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 83:
-#line 364 "mon_parse.y" /* yacc.c:1646  */
+#line 365 "mon_parse.y" /* yacc.c:1646  */
     { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_SCREEN_CODE); }
-#line 2758 "mon_parse.c" /* yacc.c:1646  */
+#line 2782 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 84:
-#line 366 "mon_parse.y" /* yacc.c:1646  */
+#line 367 "mon_parse.y" /* yacc.c:1646  */
     { mon_memmap_zap(); }
-#line 2764 "mon_parse.c" /* yacc.c:1646  */
+#line 2788 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 85:
-#line 368 "mon_parse.y" /* yacc.c:1646  */
+#line 369 "mon_parse.y" /* yacc.c:1646  */
     { mon_memmap_show(-1,BAD_ADDR,BAD_ADDR); }
-#line 2770 "mon_parse.c" /* yacc.c:1646  */
+#line 2794 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 86:
-#line 370 "mon_parse.y" /* yacc.c:1646  */
+#line 371 "mon_parse.y" /* yacc.c:1646  */
     { mon_memmap_show((yyvsp[-1].i),BAD_ADDR,BAD_ADDR); }
-#line 2776 "mon_parse.c" /* yacc.c:1646  */
+#line 2800 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 87:
-#line 372 "mon_parse.y" /* yacc.c:1646  */
+#line 373 "mon_parse.y" /* yacc.c:1646  */
     { mon_memmap_show((yyvsp[-2].i),(yyvsp[-1].range)[0],(yyvsp[-1].range)[1]); }
-#line 2782 "mon_parse.c" /* yacc.c:1646  */
+#line 2806 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 88:
-#line 374 "mon_parse.y" /* yacc.c:1646  */
+#line 375 "mon_parse.y" /* yacc.c:1646  */
     { mon_memmap_save((yyvsp[-3].str),(yyvsp[-1].i)); }
-#line 2788 "mon_parse.c" /* yacc.c:1646  */
+#line 2812 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 89:
-#line 378 "mon_parse.y" /* yacc.c:1646  */
+#line 379 "mon_parse.y" /* yacc.c:1646  */
     {
                       if ((yyvsp[-3].i)) {
                           temp = mon_breakpoint_add_checkpoint((yyvsp[-2].range)[0], (yyvsp[-2].range)[1], TRUE, (yyvsp[-3].i), FALSE);
@@ -2797,31 +2821,31 @@ yyreduce:
                       }
                       mon_breakpoint_set_checkpoint_condition(temp, (yyvsp[-1].cond_node));
                   }
-#line 2801 "mon_parse.c" /* yacc.c:1646  */
+#line 2825 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 90:
-#line 387 "mon_parse.y" /* yacc.c:1646  */
+#line 388 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_print_checkpoints(); }
-#line 2807 "mon_parse.c" /* yacc.c:1646  */
+#line 2831 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 91:
-#line 390 "mon_parse.y" /* yacc.c:1646  */
+#line 391 "mon_parse.y" /* yacc.c:1646  */
     {
                       mon_breakpoint_add_checkpoint((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], TRUE, e_exec, TRUE);
                   }
-#line 2815 "mon_parse.c" /* yacc.c:1646  */
+#line 2839 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 92:
-#line 394 "mon_parse.y" /* yacc.c:1646  */
+#line 395 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_print_checkpoints(); }
-#line 2821 "mon_parse.c" /* yacc.c:1646  */
+#line 2845 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 93:
-#line 397 "mon_parse.y" /* yacc.c:1646  */
+#line 398 "mon_parse.y" /* yacc.c:1646  */
     {
                       if ((yyvsp[-3].i)) {
                           temp = mon_breakpoint_add_checkpoint((yyvsp[-2].range)[0], (yyvsp[-2].range)[1], TRUE, (yyvsp[-3].i), FALSE);
@@ -2830,17 +2854,17 @@ yyreduce:
                       }
                       mon_breakpoint_set_checkpoint_condition(temp, (yyvsp[-1].cond_node));
                   }
-#line 2834 "mon_parse.c" /* yacc.c:1646  */
+#line 2858 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 94:
-#line 406 "mon_parse.y" /* yacc.c:1646  */
+#line 407 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_print_checkpoints(); }
-#line 2840 "mon_parse.c" /* yacc.c:1646  */
+#line 2864 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 95:
-#line 409 "mon_parse.y" /* yacc.c:1646  */
+#line 410 "mon_parse.y" /* yacc.c:1646  */
     {
                       if ((yyvsp[-3].i)) {
                           temp = mon_breakpoint_add_checkpoint((yyvsp[-2].range)[0], (yyvsp[-2].range)[1], FALSE, (yyvsp[-3].i), FALSE);
@@ -2849,104 +2873,104 @@ yyreduce:
                       }
                       mon_breakpoint_set_checkpoint_condition(temp, (yyvsp[-1].cond_node));
                   }
-#line 2853 "mon_parse.c" /* yacc.c:1646  */
+#line 2877 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 96:
-#line 418 "mon_parse.y" /* yacc.c:1646  */
+#line 419 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_print_checkpoints(); }
-#line 2859 "mon_parse.c" /* yacc.c:1646  */
+#line 2883 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 97:
-#line 423 "mon_parse.y" /* yacc.c:1646  */
+#line 424 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_switch_checkpoint(e_ON, (yyvsp[-1].i)); }
-#line 2865 "mon_parse.c" /* yacc.c:1646  */
+#line 2889 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 98:
-#line 425 "mon_parse.y" /* yacc.c:1646  */
+#line 426 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_switch_checkpoint(e_ON, -1); }
-#line 2871 "mon_parse.c" /* yacc.c:1646  */
+#line 2895 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 99:
-#line 427 "mon_parse.y" /* yacc.c:1646  */
+#line 428 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_switch_checkpoint(e_OFF, (yyvsp[-1].i)); }
-#line 2877 "mon_parse.c" /* yacc.c:1646  */
+#line 2901 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 100:
-#line 429 "mon_parse.y" /* yacc.c:1646  */
+#line 430 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_switch_checkpoint(e_OFF, -1); }
-#line 2883 "mon_parse.c" /* yacc.c:1646  */
+#line 2907 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 101:
-#line 431 "mon_parse.y" /* yacc.c:1646  */
+#line 432 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_set_ignore_count((yyvsp[-1].i), -1); }
-#line 2889 "mon_parse.c" /* yacc.c:1646  */
+#line 2913 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 102:
-#line 433 "mon_parse.y" /* yacc.c:1646  */
+#line 434 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_set_ignore_count((yyvsp[-3].i), (yyvsp[-1].i)); }
-#line 2895 "mon_parse.c" /* yacc.c:1646  */
+#line 2919 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 103:
-#line 435 "mon_parse.y" /* yacc.c:1646  */
+#line 436 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_delete_checkpoint((yyvsp[-1].i)); }
-#line 2901 "mon_parse.c" /* yacc.c:1646  */
+#line 2925 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 104:
-#line 437 "mon_parse.y" /* yacc.c:1646  */
+#line 438 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_delete_checkpoint(-1); }
-#line 2907 "mon_parse.c" /* yacc.c:1646  */
+#line 2931 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 105:
-#line 439 "mon_parse.y" /* yacc.c:1646  */
+#line 440 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_set_checkpoint_condition((yyvsp[-3].i), (yyvsp[-1].cond_node)); }
-#line 2913 "mon_parse.c" /* yacc.c:1646  */
+#line 2937 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 106:
-#line 441 "mon_parse.y" /* yacc.c:1646  */
+#line 442 "mon_parse.y" /* yacc.c:1646  */
     { mon_breakpoint_set_checkpoint_command((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2919 "mon_parse.c" /* yacc.c:1646  */
+#line 2943 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 107:
-#line 443 "mon_parse.y" /* yacc.c:1646  */
+#line 444 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_EXPECT_STRING; }
-#line 2925 "mon_parse.c" /* yacc.c:1646  */
+#line 2949 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 108:
-#line 447 "mon_parse.y" /* yacc.c:1646  */
+#line 448 "mon_parse.y" /* yacc.c:1646  */
     { sidefx = (((yyvsp[-1].action) == e_TOGGLE) ? (sidefx ^ 1) : (yyvsp[-1].action)); }
-#line 2931 "mon_parse.c" /* yacc.c:1646  */
+#line 2955 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 109:
-#line 449 "mon_parse.y" /* yacc.c:1646  */
+#line 450 "mon_parse.y" /* yacc.c:1646  */
     {
                          mon_out("I/O side effects are %s\n",
                                    sidefx ? "enabled" : "disabled");
                      }
-#line 2940 "mon_parse.c" /* yacc.c:1646  */
+#line 2964 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 110:
-#line 454 "mon_parse.y" /* yacc.c:1646  */
+#line 455 "mon_parse.y" /* yacc.c:1646  */
     { default_radix = (yyvsp[-1].rt); }
-#line 2946 "mon_parse.c" /* yacc.c:1646  */
+#line 2970 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 111:
-#line 456 "mon_parse.y" /* yacc.c:1646  */
+#line 457 "mon_parse.y" /* yacc.c:1646  */
     {
                          const char *p;
 
@@ -2963,477 +2987,489 @@ yyreduce:
 
                          mon_out("Default radix is %s\n", p);
                      }
-#line 2967 "mon_parse.c" /* yacc.c:1646  */
+#line 2991 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 112:
-#line 474 "mon_parse.y" /* yacc.c:1646  */
+#line 475 "mon_parse.y" /* yacc.c:1646  */
     { monitor_change_device((yyvsp[-1].i)); }
-#line 2973 "mon_parse.c" /* yacc.c:1646  */
+#line 2997 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 113:
-#line 476 "mon_parse.y" /* yacc.c:1646  */
+#line 477 "mon_parse.y" /* yacc.c:1646  */
     { mon_export(); }
-#line 2979 "mon_parse.c" /* yacc.c:1646  */
+#line 3003 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 114:
-#line 478 "mon_parse.y" /* yacc.c:1646  */
+#line 479 "mon_parse.y" /* yacc.c:1646  */
     { mon_quit(); YYACCEPT; }
-#line 2985 "mon_parse.c" /* yacc.c:1646  */
+#line 3009 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 115:
-#line 480 "mon_parse.y" /* yacc.c:1646  */
+#line 481 "mon_parse.y" /* yacc.c:1646  */
     { mon_exit(); YYACCEPT; }
-#line 2991 "mon_parse.c" /* yacc.c:1646  */
+#line 3015 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 116:
-#line 482 "mon_parse.y" /* yacc.c:1646  */
+#line 483 "mon_parse.y" /* yacc.c:1646  */
     { mon_maincpu_toggle_trace((yyvsp[-1].action)); }
-#line 2997 "mon_parse.c" /* yacc.c:1646  */
+#line 3021 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 117:
-#line 486 "mon_parse.y" /* yacc.c:1646  */
+#line 487 "mon_parse.y" /* yacc.c:1646  */
     { mon_drive_execute_disk_cmd((yyvsp[-1].str)); }
-#line 3003 "mon_parse.c" /* yacc.c:1646  */
+#line 3027 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 118:
-#line 488 "mon_parse.y" /* yacc.c:1646  */
+#line 489 "mon_parse.y" /* yacc.c:1646  */
     { mon_out("\t%d\n",(yyvsp[-1].i)); }
-#line 3009 "mon_parse.c" /* yacc.c:1646  */
+#line 3033 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 119:
-#line 490 "mon_parse.y" /* yacc.c:1646  */
+#line 491 "mon_parse.y" /* yacc.c:1646  */
     { mon_command_print_help(NULL); }
-#line 3015 "mon_parse.c" /* yacc.c:1646  */
+#line 3039 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 120:
-#line 492 "mon_parse.y" /* yacc.c:1646  */
+#line 493 "mon_parse.y" /* yacc.c:1646  */
     { mon_command_print_help((yyvsp[-1].str)); }
-#line 3021 "mon_parse.c" /* yacc.c:1646  */
+#line 3045 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 121:
-#line 494 "mon_parse.y" /* yacc.c:1646  */
+#line 495 "mon_parse.y" /* yacc.c:1646  */
     { mon_print_convert((yyvsp[-1].i)); }
-#line 3027 "mon_parse.c" /* yacc.c:1646  */
+#line 3051 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 122:
-#line 496 "mon_parse.y" /* yacc.c:1646  */
+#line 497 "mon_parse.y" /* yacc.c:1646  */
     { mon_change_dir((yyvsp[-1].str)); }
-#line 3033 "mon_parse.c" /* yacc.c:1646  */
+#line 3057 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 123:
-#line 498 "mon_parse.y" /* yacc.c:1646  */
+#line 499 "mon_parse.y" /* yacc.c:1646  */
     { mon_keyboard_feed((yyvsp[-1].str)); }
-#line 3039 "mon_parse.c" /* yacc.c:1646  */
+#line 3063 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 124:
-#line 500 "mon_parse.y" /* yacc.c:1646  */
+#line 501 "mon_parse.y" /* yacc.c:1646  */
     { mon_backtrace(); }
-#line 3045 "mon_parse.c" /* yacc.c:1646  */
+#line 3069 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 125:
-#line 502 "mon_parse.y" /* yacc.c:1646  */
+#line 503 "mon_parse.y" /* yacc.c:1646  */
     { mon_show_dir((yyvsp[-1].str)); }
-#line 3051 "mon_parse.c" /* yacc.c:1646  */
+#line 3075 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 126:
-#line 504 "mon_parse.y" /* yacc.c:1646  */
+#line 505 "mon_parse.y" /* yacc.c:1646  */
     { mon_show_pwd(); }
-#line 3057 "mon_parse.c" /* yacc.c:1646  */
+#line 3081 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 127:
-#line 506 "mon_parse.y" /* yacc.c:1646  */
+#line 507 "mon_parse.y" /* yacc.c:1646  */
     { mon_screenshot_save((yyvsp[-1].str),-1); }
-#line 3063 "mon_parse.c" /* yacc.c:1646  */
+#line 3087 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 128:
-#line 508 "mon_parse.y" /* yacc.c:1646  */
+#line 509 "mon_parse.y" /* yacc.c:1646  */
     { mon_screenshot_save((yyvsp[-3].str),(yyvsp[-1].i)); }
-#line 3069 "mon_parse.c" /* yacc.c:1646  */
+#line 3093 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 129:
-#line 510 "mon_parse.y" /* yacc.c:1646  */
+#line 511 "mon_parse.y" /* yacc.c:1646  */
     { mon_resource_get((yyvsp[-1].str)); }
-#line 3075 "mon_parse.c" /* yacc.c:1646  */
+#line 3099 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 130:
-#line 512 "mon_parse.y" /* yacc.c:1646  */
+#line 513 "mon_parse.y" /* yacc.c:1646  */
     { mon_resource_set((yyvsp[-2].str),(yyvsp[-1].str)); }
-#line 3081 "mon_parse.c" /* yacc.c:1646  */
+#line 3105 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 131:
-#line 514 "mon_parse.y" /* yacc.c:1646  */
+#line 515 "mon_parse.y" /* yacc.c:1646  */
     { resources_load((yyvsp[-1].str)); }
-#line 3087 "mon_parse.c" /* yacc.c:1646  */
+#line 3111 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 132:
-#line 516 "mon_parse.y" /* yacc.c:1646  */
+#line 517 "mon_parse.y" /* yacc.c:1646  */
     { resources_save((yyvsp[-1].str)); }
-#line 3093 "mon_parse.c" /* yacc.c:1646  */
+#line 3117 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 133:
-#line 518 "mon_parse.y" /* yacc.c:1646  */
+#line 519 "mon_parse.y" /* yacc.c:1646  */
     { mon_reset_machine(-1); }
-#line 3099 "mon_parse.c" /* yacc.c:1646  */
+#line 3123 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 134:
-#line 520 "mon_parse.y" /* yacc.c:1646  */
+#line 521 "mon_parse.y" /* yacc.c:1646  */
     { mon_reset_machine((yyvsp[-1].i)); }
-#line 3105 "mon_parse.c" /* yacc.c:1646  */
+#line 3129 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 135:
-#line 522 "mon_parse.y" /* yacc.c:1646  */
+#line 523 "mon_parse.y" /* yacc.c:1646  */
     { mon_tape_ctrl((yyvsp[-1].i)); }
-#line 3111 "mon_parse.c" /* yacc.c:1646  */
+#line 3135 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 136:
-#line 524 "mon_parse.y" /* yacc.c:1646  */
+#line 525 "mon_parse.y" /* yacc.c:1646  */
     { mon_cart_freeze(); }
-#line 3117 "mon_parse.c" /* yacc.c:1646  */
+#line 3141 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 137:
-#line 526 "mon_parse.y" /* yacc.c:1646  */
+#line 527 "mon_parse.y" /* yacc.c:1646  */
     { }
-#line 3123 "mon_parse.c" /* yacc.c:1646  */
+#line 3147 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 138:
-#line 528 "mon_parse.y" /* yacc.c:1646  */
+#line 529 "mon_parse.y" /* yacc.c:1646  */
     { mon_stopwatch_reset(); }
-#line 3129 "mon_parse.c" /* yacc.c:1646  */
+#line 3153 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 139:
-#line 530 "mon_parse.y" /* yacc.c:1646  */
+#line 531 "mon_parse.y" /* yacc.c:1646  */
     { mon_stopwatch_show("Stopwatch: ", "\n"); }
-#line 3135 "mon_parse.c" /* yacc.c:1646  */
+#line 3159 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 140:
-#line 534 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), FALSE); }
-#line 3141 "mon_parse.c" /* yacc.c:1646  */
+#line 533 "mon_parse.y" /* yacc.c:1646  */
+    { profile_reset(); }
+#line 3165 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 141:
-#line 536 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), TRUE); }
-#line 3147 "mon_parse.c" /* yacc.c:1646  */
+#line 535 "mon_parse.y" /* yacc.c:1646  */
+    { profile_show(); }
+#line 3171 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 142:
-#line 538 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], FALSE); }
-#line 3153 "mon_parse.c" /* yacc.c:1646  */
+#line 539 "mon_parse.y" /* yacc.c:1646  */
+    { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), FALSE); }
+#line 3177 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 143:
-#line 540 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_DEVICE_NUM; }
-#line 3159 "mon_parse.c" /* yacc.c:1646  */
+#line 541 "mon_parse.y" /* yacc.c:1646  */
+    { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), TRUE); }
+#line 3183 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 144:
-#line 542 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_ADDRESS; }
-#line 3165 "mon_parse.c" /* yacc.c:1646  */
+#line 543 "mon_parse.y" /* yacc.c:1646  */
+    { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], FALSE); }
+#line 3189 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 145:
-#line 544 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], TRUE); }
-#line 3171 "mon_parse.c" /* yacc.c:1646  */
+#line 545 "mon_parse.y" /* yacc.c:1646  */
+    { return ERR_EXPECT_DEVICE_NUM; }
+#line 3195 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 146:
-#line 546 "mon_parse.y" /* yacc.c:1646  */
+#line 547 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_EXPECT_ADDRESS; }
-#line 3177 "mon_parse.c" /* yacc.c:1646  */
+#line 3201 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 147:
-#line 548 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_verify((yyvsp[-3].str),(yyvsp[-2].i),(yyvsp[-1].a)); }
-#line 3183 "mon_parse.c" /* yacc.c:1646  */
+#line 549 "mon_parse.y" /* yacc.c:1646  */
+    { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], TRUE); }
+#line 3207 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 148:
-#line 550 "mon_parse.y" /* yacc.c:1646  */
+#line 551 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_EXPECT_ADDRESS; }
-#line 3189 "mon_parse.c" /* yacc.c:1646  */
+#line 3213 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 149:
-#line 552 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_block_cmd(0,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
-#line 3195 "mon_parse.c" /* yacc.c:1646  */
+#line 553 "mon_parse.y" /* yacc.c:1646  */
+    { mon_file_verify((yyvsp[-3].str),(yyvsp[-2].i),(yyvsp[-1].a)); }
+#line 3219 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 150:
-#line 554 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_block_cmd(1,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
-#line 3201 "mon_parse.c" /* yacc.c:1646  */
+#line 555 "mon_parse.y" /* yacc.c:1646  */
+    { return ERR_EXPECT_ADDRESS; }
+#line 3225 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 151:
-#line 556 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_list(-1); }
-#line 3207 "mon_parse.c" /* yacc.c:1646  */
+#line 557 "mon_parse.y" /* yacc.c:1646  */
+    { mon_drive_block_cmd(0,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
+#line 3231 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 152:
-#line 558 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_list((yyvsp[-1].i)); }
-#line 3213 "mon_parse.c" /* yacc.c:1646  */
+#line 559 "mon_parse.y" /* yacc.c:1646  */
+    { mon_drive_block_cmd(1,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
+#line 3237 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 153:
-#line 560 "mon_parse.y" /* yacc.c:1646  */
-    { mon_attach((yyvsp[-2].str),(yyvsp[-1].i)); }
-#line 3219 "mon_parse.c" /* yacc.c:1646  */
+#line 561 "mon_parse.y" /* yacc.c:1646  */
+    { mon_drive_list(-1); }
+#line 3243 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 154:
-#line 562 "mon_parse.y" /* yacc.c:1646  */
-    { mon_detach((yyvsp[-1].i)); }
-#line 3225 "mon_parse.c" /* yacc.c:1646  */
+#line 563 "mon_parse.y" /* yacc.c:1646  */
+    { mon_drive_list((yyvsp[-1].i)); }
+#line 3249 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 155:
-#line 564 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-1].str),0,1); }
-#line 3231 "mon_parse.c" /* yacc.c:1646  */
+#line 565 "mon_parse.y" /* yacc.c:1646  */
+    { mon_attach((yyvsp[-2].str),(yyvsp[-1].i)); }
+#line 3255 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 156:
-#line 566 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),1); }
-#line 3237 "mon_parse.c" /* yacc.c:1646  */
+#line 567 "mon_parse.y" /* yacc.c:1646  */
+    { mon_detach((yyvsp[-1].i)); }
+#line 3261 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 157:
-#line 568 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-1].str),0,0); }
-#line 3243 "mon_parse.c" /* yacc.c:1646  */
+#line 569 "mon_parse.y" /* yacc.c:1646  */
+    { mon_autostart((yyvsp[-1].str),0,1); }
+#line 3267 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 158:
-#line 570 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),0); }
-#line 3249 "mon_parse.c" /* yacc.c:1646  */
+#line 571 "mon_parse.y" /* yacc.c:1646  */
+    { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),1); }
+#line 3273 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 159:
-#line 574 "mon_parse.y" /* yacc.c:1646  */
-    { mon_record_commands((yyvsp[-1].str)); }
-#line 3255 "mon_parse.c" /* yacc.c:1646  */
+#line 573 "mon_parse.y" /* yacc.c:1646  */
+    { mon_autostart((yyvsp[-1].str),0,0); }
+#line 3279 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 160:
-#line 576 "mon_parse.y" /* yacc.c:1646  */
-    { mon_end_recording(); }
-#line 3261 "mon_parse.c" /* yacc.c:1646  */
+#line 575 "mon_parse.y" /* yacc.c:1646  */
+    { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),0); }
+#line 3285 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 161:
-#line 578 "mon_parse.y" /* yacc.c:1646  */
-    { mon_playback_init((yyvsp[-1].str)); }
-#line 3267 "mon_parse.c" /* yacc.c:1646  */
+#line 579 "mon_parse.y" /* yacc.c:1646  */
+    { mon_record_commands((yyvsp[-1].str)); }
+#line 3291 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 162:
-#line 582 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_fill((yyvsp[-2].a), BAD_ADDR, (unsigned char *)(yyvsp[-1].str)); }
-#line 3273 "mon_parse.c" /* yacc.c:1646  */
+#line 581 "mon_parse.y" /* yacc.c:1646  */
+    { mon_end_recording(); }
+#line 3297 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 163:
-#line 584 "mon_parse.y" /* yacc.c:1646  */
-    { printf("Not yet.\n"); }
-#line 3279 "mon_parse.c" /* yacc.c:1646  */
+#line 583 "mon_parse.y" /* yacc.c:1646  */
+    { mon_playback_init((yyvsp[-1].str)); }
+#line 3303 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 164:
-#line 588 "mon_parse.y" /* yacc.c:1646  */
-    { yydebug = 1; }
-#line 3285 "mon_parse.c" /* yacc.c:1646  */
+#line 587 "mon_parse.y" /* yacc.c:1646  */
+    { mon_memory_fill((yyvsp[-2].a), BAD_ADDR, (unsigned char *)(yyvsp[-1].str)); }
+#line 3309 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 165:
-#line 591 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); }
-#line 3291 "mon_parse.c" /* yacc.c:1646  */
+#line 589 "mon_parse.y" /* yacc.c:1646  */
+    { printf("Not yet.\n"); }
+#line 3315 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 166:
-#line 594 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); }
-#line 3297 "mon_parse.c" /* yacc.c:1646  */
+#line 593 "mon_parse.y" /* yacc.c:1646  */
+    { yydebug = 1; }
+#line 3321 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 167:
-#line 595 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.str) = NULL; }
-#line 3303 "mon_parse.c" /* yacc.c:1646  */
+#line 596 "mon_parse.y" /* yacc.c:1646  */
+    { (yyval.str) = (yyvsp[0].str); }
+#line 3327 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 169:
+  case 168:
 #line 599 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_FILENAME; }
-#line 3309 "mon_parse.c" /* yacc.c:1646  */
+    { (yyval.str) = (yyvsp[0].str); }
+#line 3333 "mon_parse.c" /* yacc.c:1646  */
+    break;
+
+  case 169:
+#line 600 "mon_parse.y" /* yacc.c:1646  */
+    { (yyval.str) = NULL; }
+#line 3339 "mon_parse.c" /* yacc.c:1646  */
     break;
 
   case 171:
-#line 603 "mon_parse.y" /* yacc.c:1646  */
+#line 604 "mon_parse.y" /* yacc.c:1646  */
+    { return ERR_EXPECT_FILENAME; }
+#line 3345 "mon_parse.c" /* yacc.c:1646  */
+    break;
+
+  case 173:
+#line 608 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_EXPECT_DEVICE_NUM; }
-#line 3315 "mon_parse.c" /* yacc.c:1646  */
+#line 3351 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 172:
-#line 606 "mon_parse.y" /* yacc.c:1646  */
+  case 174:
+#line 611 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[-1].i) | (yyvsp[0].i); }
-#line 3321 "mon_parse.c" /* yacc.c:1646  */
+#line 3357 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 173:
-#line 607 "mon_parse.y" /* yacc.c:1646  */
+  case 175:
+#line 612 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3327 "mon_parse.c" /* yacc.c:1646  */
+#line 3363 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 174:
-#line 610 "mon_parse.y" /* yacc.c:1646  */
+  case 176:
+#line 615 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3333 "mon_parse.c" /* yacc.c:1646  */
+#line 3369 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 175:
-#line 611 "mon_parse.y" /* yacc.c:1646  */
+  case 177:
+#line 616 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = 0; }
-#line 3339 "mon_parse.c" /* yacc.c:1646  */
+#line 3375 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 176:
-#line 614 "mon_parse.y" /* yacc.c:1646  */
+  case 178:
+#line 619 "mon_parse.y" /* yacc.c:1646  */
     {
                                     if (!mon_register_valid(default_memspace, (yyvsp[0].reg))) {
                                         return ERR_INVALID_REGISTER;
                                     }
                                     (yyval.i) = new_reg(default_memspace, (yyvsp[0].reg));
                                 }
-#line 3350 "mon_parse.c" /* yacc.c:1646  */
+#line 3386 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 177:
-#line 620 "mon_parse.y" /* yacc.c:1646  */
+  case 179:
+#line 625 "mon_parse.y" /* yacc.c:1646  */
     {
                                     if (!mon_register_valid((yyvsp[-1].i), (yyvsp[0].reg))) {
                                         return ERR_INVALID_REGISTER;
                                     }
                                     (yyval.i) = new_reg((yyvsp[-1].i), (yyvsp[0].reg));
                                 }
-#line 3361 "mon_parse.c" /* yacc.c:1646  */
+#line 3397 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 180:
-#line 633 "mon_parse.y" /* yacc.c:1646  */
+  case 182:
+#line 638 "mon_parse.y" /* yacc.c:1646  */
     { (monitor_cpu_for_memspace[reg_memspace((yyvsp[-2].i))]->mon_register_set_val)(reg_memspace((yyvsp[-2].i)), reg_regid((yyvsp[-2].i)), (uint16_t) (yyvsp[0].i)); }
-#line 3367 "mon_parse.c" /* yacc.c:1646  */
+#line 3403 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 181:
-#line 636 "mon_parse.y" /* yacc.c:1646  */
+  case 183:
+#line 641 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3373 "mon_parse.c" /* yacc.c:1646  */
+#line 3409 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 182:
-#line 637 "mon_parse.y" /* yacc.c:1646  */
+  case 184:
+#line 642 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_EXPECT_CHECKNUM; }
-#line 3379 "mon_parse.c" /* yacc.c:1646  */
+#line 3415 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 184:
-#line 641 "mon_parse.y" /* yacc.c:1646  */
+  case 186:
+#line 646 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.range)[0] = (yyvsp[0].a); (yyval.range)[1] = BAD_ADDR; }
-#line 3385 "mon_parse.c" /* yacc.c:1646  */
+#line 3421 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 185:
-#line 644 "mon_parse.y" /* yacc.c:1646  */
+  case 187:
+#line 649 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.range)[0] = (yyvsp[-2].a); (yyval.range)[1] = (yyvsp[0].a); }
-#line 3391 "mon_parse.c" /* yacc.c:1646  */
+#line 3427 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 186:
-#line 646 "mon_parse.y" /* yacc.c:1646  */
+  case 188:
+#line 651 "mon_parse.y" /* yacc.c:1646  */
     { if (resolve_range(e_default_space, (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
-#line 3397 "mon_parse.c" /* yacc.c:1646  */
+#line 3433 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 187:
-#line 648 "mon_parse.y" /* yacc.c:1646  */
+  case 189:
+#line 653 "mon_parse.y" /* yacc.c:1646  */
     { if (resolve_range((yyvsp[-2].i), (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
-#line 3403 "mon_parse.c" /* yacc.c:1646  */
+#line 3439 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 188:
-#line 651 "mon_parse.y" /* yacc.c:1646  */
+  case 190:
+#line 656 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.a) = (yyvsp[0].a); }
-#line 3409 "mon_parse.c" /* yacc.c:1646  */
+#line 3445 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 189:
-#line 652 "mon_parse.y" /* yacc.c:1646  */
+  case 191:
+#line 657 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.a) = BAD_ADDR; }
-#line 3415 "mon_parse.c" /* yacc.c:1646  */
+#line 3451 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 190:
-#line 656 "mon_parse.y" /* yacc.c:1646  */
+  case 192:
+#line 661 "mon_parse.y" /* yacc.c:1646  */
     {
              (yyval.a) = new_addr(e_default_space,(yyvsp[0].i));
              if (opt_asm) new_cmd = asm_mode = 1;
          }
-#line 3424 "mon_parse.c" /* yacc.c:1646  */
+#line 3460 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 191:
-#line 661 "mon_parse.y" /* yacc.c:1646  */
+  case 193:
+#line 666 "mon_parse.y" /* yacc.c:1646  */
     {
              (yyval.a) = new_addr((yyvsp[-2].i), (yyvsp[0].i));
              if (opt_asm) new_cmd = asm_mode = 1;
          }
-#line 3433 "mon_parse.c" /* yacc.c:1646  */
+#line 3469 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 192:
-#line 666 "mon_parse.y" /* yacc.c:1646  */
+  case 194:
+#line 671 "mon_parse.y" /* yacc.c:1646  */
     {
              temp = mon_symbol_table_lookup_addr(e_default_space, (yyvsp[0].str));
              if (temp >= 0)
@@ -3441,287 +3477,287 @@ yyreduce:
              else
                  return ERR_UNDEFINED_LABEL;
          }
-#line 3445 "mon_parse.c" /* yacc.c:1646  */
+#line 3481 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 195:
-#line 679 "mon_parse.y" /* yacc.c:1646  */
+  case 197:
+#line 684 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = e_comp_space; }
-#line 3451 "mon_parse.c" /* yacc.c:1646  */
+#line 3487 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 196:
-#line 680 "mon_parse.y" /* yacc.c:1646  */
+  case 198:
+#line 685 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = e_disk8_space; }
-#line 3457 "mon_parse.c" /* yacc.c:1646  */
+#line 3493 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 197:
-#line 681 "mon_parse.y" /* yacc.c:1646  */
+  case 199:
+#line 686 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = e_disk9_space; }
-#line 3463 "mon_parse.c" /* yacc.c:1646  */
+#line 3499 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 198:
-#line 682 "mon_parse.y" /* yacc.c:1646  */
+  case 200:
+#line 687 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = e_disk10_space; }
-#line 3469 "mon_parse.c" /* yacc.c:1646  */
+#line 3505 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 199:
-#line 683 "mon_parse.y" /* yacc.c:1646  */
+  case 201:
+#line 688 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = e_disk11_space; }
-#line 3475 "mon_parse.c" /* yacc.c:1646  */
+#line 3511 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 200:
-#line 686 "mon_parse.y" /* yacc.c:1646  */
+  case 202:
+#line 691 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); if (!CHECK_ADDR((yyvsp[0].i))) return ERR_ADDR_TOO_BIG; }
-#line 3481 "mon_parse.c" /* yacc.c:1646  */
+#line 3517 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 201:
-#line 688 "mon_parse.y" /* yacc.c:1646  */
+  case 203:
+#line 693 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3487 "mon_parse.c" /* yacc.c:1646  */
+#line 3523 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 202:
-#line 690 "mon_parse.y" /* yacc.c:1646  */
+  case 204:
+#line 695 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[-2].i) + (yyvsp[0].i); }
-#line 3493 "mon_parse.c" /* yacc.c:1646  */
+#line 3529 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 203:
-#line 691 "mon_parse.y" /* yacc.c:1646  */
+  case 205:
+#line 696 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[-2].i) - (yyvsp[0].i); }
-#line 3499 "mon_parse.c" /* yacc.c:1646  */
+#line 3535 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 204:
-#line 692 "mon_parse.y" /* yacc.c:1646  */
+  case 206:
+#line 697 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[-2].i) * (yyvsp[0].i); }
-#line 3505 "mon_parse.c" /* yacc.c:1646  */
+#line 3541 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 205:
-#line 693 "mon_parse.y" /* yacc.c:1646  */
+  case 207:
+#line 698 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = ((yyvsp[0].i)) ? ((yyvsp[-2].i) / (yyvsp[0].i)) : 1; }
-#line 3511 "mon_parse.c" /* yacc.c:1646  */
+#line 3547 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 206:
-#line 694 "mon_parse.y" /* yacc.c:1646  */
+  case 208:
+#line 699 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[-1].i); }
-#line 3517 "mon_parse.c" /* yacc.c:1646  */
+#line 3553 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 207:
-#line 695 "mon_parse.y" /* yacc.c:1646  */
+  case 209:
+#line 700 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_MISSING_CLOSE_PAREN; }
-#line 3523 "mon_parse.c" /* yacc.c:1646  */
+#line 3559 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 208:
-#line 696 "mon_parse.y" /* yacc.c:1646  */
+  case 210:
+#line 701 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3529 "mon_parse.c" /* yacc.c:1646  */
+#line 3565 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 209:
-#line 699 "mon_parse.y" /* yacc.c:1646  */
+  case 211:
+#line 704 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.cond_node) = (yyvsp[0].cond_node); }
-#line 3535 "mon_parse.c" /* yacc.c:1646  */
+#line 3571 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 210:
-#line 700 "mon_parse.y" /* yacc.c:1646  */
+  case 212:
+#line 705 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.cond_node) = 0; }
-#line 3541 "mon_parse.c" /* yacc.c:1646  */
+#line 3577 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 211:
-#line 703 "mon_parse.y" /* yacc.c:1646  */
+  case 213:
+#line 708 "mon_parse.y" /* yacc.c:1646  */
     {
                (yyval.cond_node) = new_cond; (yyval.cond_node)->is_parenthized = FALSE;
                (yyval.cond_node)->child1 = (yyvsp[-2].cond_node); (yyval.cond_node)->child2 = (yyvsp[0].cond_node); (yyval.cond_node)->operation = (yyvsp[-1].cond_op);
            }
-#line 3550 "mon_parse.c" /* yacc.c:1646  */
+#line 3586 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 212:
-#line 708 "mon_parse.y" /* yacc.c:1646  */
+  case 214:
+#line 713 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_INCOMPLETE_COMPARE_OP; }
-#line 3556 "mon_parse.c" /* yacc.c:1646  */
+#line 3592 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 213:
-#line 710 "mon_parse.y" /* yacc.c:1646  */
+  case 215:
+#line 715 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.cond_node) = (yyvsp[-1].cond_node); (yyval.cond_node)->is_parenthized = TRUE; }
-#line 3562 "mon_parse.c" /* yacc.c:1646  */
+#line 3598 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 214:
-#line 712 "mon_parse.y" /* yacc.c:1646  */
+  case 216:
+#line 717 "mon_parse.y" /* yacc.c:1646  */
     { return ERR_MISSING_CLOSE_PAREN; }
-#line 3568 "mon_parse.c" /* yacc.c:1646  */
+#line 3604 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 215:
-#line 714 "mon_parse.y" /* yacc.c:1646  */
+  case 217:
+#line 719 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.cond_node) = (yyvsp[0].cond_node); }
-#line 3574 "mon_parse.c" /* yacc.c:1646  */
+#line 3610 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 216:
-#line 717 "mon_parse.y" /* yacc.c:1646  */
+  case 218:
+#line 722 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.cond_node) = new_cond;
                             (yyval.cond_node)->operation = e_INV;
                             (yyval.cond_node)->is_parenthized = FALSE;
                             (yyval.cond_node)->reg_num = (yyvsp[0].i); (yyval.cond_node)->is_reg = TRUE; (yyval.cond_node)->banknum=-1;
                             (yyval.cond_node)->child1 = NULL; (yyval.cond_node)->child2 = NULL;
                           }
-#line 3585 "mon_parse.c" /* yacc.c:1646  */
+#line 3621 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 217:
-#line 723 "mon_parse.y" /* yacc.c:1646  */
+  case 219:
+#line 728 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.cond_node) = new_cond;
                             (yyval.cond_node)->operation = e_INV;
                             (yyval.cond_node)->is_parenthized = FALSE;
                             (yyval.cond_node)->value = (yyvsp[0].i); (yyval.cond_node)->is_reg = FALSE; (yyval.cond_node)->banknum=-1;
                             (yyval.cond_node)->child1 = NULL; (yyval.cond_node)->child2 = NULL;
                           }
-#line 3596 "mon_parse.c" /* yacc.c:1646  */
+#line 3632 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 218:
-#line 729 "mon_parse.y" /* yacc.c:1646  */
+  case 220:
+#line 734 "mon_parse.y" /* yacc.c:1646  */
     {(yyval.cond_node)=new_cond;
                             (yyval.cond_node)->operation=e_INV;
                             (yyval.cond_node)->is_parenthized = FALSE;
                             (yyval.cond_node)->banknum=mon_banknum_from_bank(e_default_space,(yyvsp[-2].str)); (yyval.cond_node)->value = (yyvsp[0].a); (yyval.cond_node)->is_reg = FALSE;
                             (yyval.cond_node)->child1 = NULL; (yyval.cond_node)->child2 = NULL;  
                         }
-#line 3607 "mon_parse.c" /* yacc.c:1646  */
+#line 3643 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 221:
-#line 741 "mon_parse.y" /* yacc.c:1646  */
+  case 223:
+#line 746 "mon_parse.y" /* yacc.c:1646  */
     { mon_add_number_to_buffer((yyvsp[0].i)); }
-#line 3613 "mon_parse.c" /* yacc.c:1646  */
+#line 3649 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 222:
-#line 742 "mon_parse.y" /* yacc.c:1646  */
+  case 224:
+#line 747 "mon_parse.y" /* yacc.c:1646  */
     { mon_add_string_to_buffer((yyvsp[0].str)); }
-#line 3619 "mon_parse.c" /* yacc.c:1646  */
+#line 3655 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 225:
-#line 749 "mon_parse.y" /* yacc.c:1646  */
+  case 227:
+#line 754 "mon_parse.y" /* yacc.c:1646  */
     { mon_add_number_to_buffer((yyvsp[0].i)); }
-#line 3625 "mon_parse.c" /* yacc.c:1646  */
+#line 3661 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 226:
-#line 750 "mon_parse.y" /* yacc.c:1646  */
+  case 228:
+#line 755 "mon_parse.y" /* yacc.c:1646  */
     { mon_add_number_masked_to_buffer((yyvsp[0].i), 0x00); }
-#line 3631 "mon_parse.c" /* yacc.c:1646  */
+#line 3667 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 227:
-#line 751 "mon_parse.y" /* yacc.c:1646  */
+  case 229:
+#line 756 "mon_parse.y" /* yacc.c:1646  */
     { mon_add_string_to_buffer((yyvsp[0].str)); }
-#line 3637 "mon_parse.c" /* yacc.c:1646  */
+#line 3673 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 228:
-#line 754 "mon_parse.y" /* yacc.c:1646  */
+  case 230:
+#line 759 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3643 "mon_parse.c" /* yacc.c:1646  */
+#line 3679 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 229:
-#line 755 "mon_parse.y" /* yacc.c:1646  */
+  case 231:
+#line 760 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (monitor_cpu_for_memspace[reg_memspace((yyvsp[0].i))]->mon_register_get_val)(reg_memspace((yyvsp[0].i)), reg_regid((yyvsp[0].i))); }
-#line 3649 "mon_parse.c" /* yacc.c:1646  */
+#line 3685 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 230:
-#line 758 "mon_parse.y" /* yacc.c:1646  */
+  case 232:
+#line 763 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3655 "mon_parse.c" /* yacc.c:1646  */
+#line 3691 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 231:
-#line 759 "mon_parse.y" /* yacc.c:1646  */
+  case 233:
+#line 764 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
-#line 3661 "mon_parse.c" /* yacc.c:1646  */
+#line 3697 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 232:
-#line 760 "mon_parse.y" /* yacc.c:1646  */
+  case 234:
+#line 765 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
-#line 3667 "mon_parse.c" /* yacc.c:1646  */
+#line 3703 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 233:
-#line 761 "mon_parse.y" /* yacc.c:1646  */
+  case 235:
+#line 766 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
-#line 3673 "mon_parse.c" /* yacc.c:1646  */
+#line 3709 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 234:
-#line 764 "mon_parse.y" /* yacc.c:1646  */
+  case 236:
+#line 769 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = resolve_datatype(B_NUMBER,(yyvsp[0].str)); }
-#line 3679 "mon_parse.c" /* yacc.c:1646  */
+#line 3715 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 235:
-#line 765 "mon_parse.y" /* yacc.c:1646  */
+  case 237:
+#line 770 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = resolve_datatype(O_NUMBER,(yyvsp[0].str)); }
-#line 3685 "mon_parse.c" /* yacc.c:1646  */
+#line 3721 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 236:
-#line 766 "mon_parse.y" /* yacc.c:1646  */
+  case 238:
+#line 771 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = resolve_datatype(D_NUMBER,(yyvsp[0].str)); }
-#line 3691 "mon_parse.c" /* yacc.c:1646  */
+#line 3727 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 237:
-#line 769 "mon_parse.y" /* yacc.c:1646  */
+  case 239:
+#line 774 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3697 "mon_parse.c" /* yacc.c:1646  */
+#line 3733 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 238:
-#line 770 "mon_parse.y" /* yacc.c:1646  */
+  case 240:
+#line 775 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3703 "mon_parse.c" /* yacc.c:1646  */
+#line 3739 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 239:
-#line 771 "mon_parse.y" /* yacc.c:1646  */
+  case 241:
+#line 776 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3709 "mon_parse.c" /* yacc.c:1646  */
+#line 3745 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 240:
-#line 772 "mon_parse.y" /* yacc.c:1646  */
+  case 242:
+#line 777 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3715 "mon_parse.c" /* yacc.c:1646  */
+#line 3751 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 241:
-#line 773 "mon_parse.y" /* yacc.c:1646  */
+  case 243:
+#line 778 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 3721 "mon_parse.c" /* yacc.c:1646  */
+#line 3757 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 245:
-#line 781 "mon_parse.y" /* yacc.c:1646  */
+  case 247:
+#line 786 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = 0;
                                                 if ((yyvsp[-1].str)) {
                                                     (monitor_cpu_for_memspace[default_memspace]->mon_assemble_instr)((yyvsp[-1].str), (yyvsp[0].mode));
@@ -3731,17 +3767,17 @@ yyreduce:
                                                 }
                                                 opt_asm = 0;
                                               }
-#line 3735 "mon_parse.c" /* yacc.c:1646  */
+#line 3771 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 247:
-#line 792 "mon_parse.y" /* yacc.c:1646  */
+  case 249:
+#line 797 "mon_parse.y" /* yacc.c:1646  */
     { asm_mode = 0; }
-#line 3741 "mon_parse.c" /* yacc.c:1646  */
+#line 3777 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 248:
-#line 795 "mon_parse.y" /* yacc.c:1646  */
+  case 250:
+#line 800 "mon_parse.y" /* yacc.c:1646  */
     { if ((yyvsp[0].i) > 0xff) {
                           (yyval.mode).addr_mode = ASM_ADDR_MODE_IMMEDIATE_16;
                           (yyval.mode).param = (yyvsp[0].i);
@@ -3749,11 +3785,11 @@ yyreduce:
                           (yyval.mode).addr_mode = ASM_ADDR_MODE_IMMEDIATE;
                           (yyval.mode).param = (yyvsp[0].i);
                         } }
-#line 3753 "mon_parse.c" /* yacc.c:1646  */
+#line 3789 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 249:
-#line 802 "mon_parse.y" /* yacc.c:1646  */
+  case 251:
+#line 807 "mon_parse.y" /* yacc.c:1646  */
     { if ((yyvsp[0].i) >= 0x10000) {
                (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_LONG;
                (yyval.mode).param = (yyvsp[0].i);
@@ -3765,11 +3801,11 @@ yyreduce:
                (yyval.mode).param = (yyvsp[0].i);
              }
            }
-#line 3769 "mon_parse.c" /* yacc.c:1646  */
+#line 3805 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 250:
-#line 813 "mon_parse.y" /* yacc.c:1646  */
+  case 252:
+#line 818 "mon_parse.y" /* yacc.c:1646  */
     { if ((yyvsp[-2].i) >= 0x10000) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_LONG_X;
                             (yyval.mode).param = (yyvsp[-2].i);
@@ -3781,11 +3817,11 @@ yyreduce:
                             (yyval.mode).param = (yyvsp[-2].i);
                           }
                         }
-#line 3785 "mon_parse.c" /* yacc.c:1646  */
+#line 3821 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 251:
-#line 824 "mon_parse.y" /* yacc.c:1646  */
+  case 253:
+#line 829 "mon_parse.y" /* yacc.c:1646  */
     { if ((yyvsp[-2].i) < 0x100) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_ZERO_PAGE_Y;
                             (yyval.mode).param = (yyvsp[-2].i);
@@ -3794,11 +3830,11 @@ yyreduce:
                             (yyval.mode).param = (yyvsp[-2].i);
                           }
                         }
-#line 3798 "mon_parse.c" /* yacc.c:1646  */
+#line 3834 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 252:
-#line 832 "mon_parse.y" /* yacc.c:1646  */
+  case 254:
+#line 837 "mon_parse.y" /* yacc.c:1646  */
     { if ((yyvsp[-2].i) < 0x100) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_STACK_RELATIVE;
                             (yyval.mode).param = (yyvsp[-2].i);
@@ -3818,22 +3854,22 @@ yyreduce:
                             }
                           }
                         }
-#line 3822 "mon_parse.c" /* yacc.c:1646  */
+#line 3858 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 253:
-#line 851 "mon_parse.y" /* yacc.c:1646  */
+  case 255:
+#line 856 "mon_parse.y" /* yacc.c:1646  */
     { if ((yyvsp[-2].i) < 0x100) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_DOUBLE;
                             (yyval.mode).param = (yyvsp[0].i);
                             (yyval.mode).addr_submode = (yyvsp[-2].i);
                           }
                         }
-#line 3833 "mon_parse.c" /* yacc.c:1646  */
+#line 3869 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 254:
-#line 857 "mon_parse.y" /* yacc.c:1646  */
+  case 256:
+#line 862 "mon_parse.y" /* yacc.c:1646  */
     { if ((yyvsp[-1].i) < 0x100) {
                                (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT;
                                (yyval.mode).param = (yyvsp[-1].i);
@@ -3842,11 +3878,11 @@ yyreduce:
                                (yyval.mode).param = (yyvsp[-1].i);
                              }
                            }
-#line 3846 "mon_parse.c" /* yacc.c:1646  */
+#line 3882 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 255:
-#line 865 "mon_parse.y" /* yacc.c:1646  */
+  case 257:
+#line 870 "mon_parse.y" /* yacc.c:1646  */
     { if ((yyvsp[-3].i) < 0x100) {
                                            (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT_X;
                                            (yyval.mode).param = (yyvsp[-3].i);
@@ -3855,203 +3891,203 @@ yyreduce:
                                            (yyval.mode).param = (yyvsp[-3].i);
                                          }
                                        }
-#line 3859 "mon_parse.c" /* yacc.c:1646  */
+#line 3895 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 256:
-#line 874 "mon_parse.y" /* yacc.c:1646  */
+  case 258:
+#line 879 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_STACK_RELATIVE_Y; (yyval.mode).param = (yyvsp[-5].i); }
-#line 3865 "mon_parse.c" /* yacc.c:1646  */
+#line 3901 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 257:
-#line 876 "mon_parse.y" /* yacc.c:1646  */
+  case 259:
+#line 881 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT_Y; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3871 "mon_parse.c" /* yacc.c:1646  */
+#line 3907 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 258:
-#line 877 "mon_parse.y" /* yacc.c:1646  */
+  case 260:
+#line 882 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_BC; }
-#line 3877 "mon_parse.c" /* yacc.c:1646  */
+#line 3913 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 259:
-#line 878 "mon_parse.y" /* yacc.c:1646  */
+  case 261:
+#line 883 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_DE; }
-#line 3883 "mon_parse.c" /* yacc.c:1646  */
+#line 3919 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 260:
-#line 879 "mon_parse.y" /* yacc.c:1646  */
+  case 262:
+#line 884 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_HL; }
-#line 3889 "mon_parse.c" /* yacc.c:1646  */
+#line 3925 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 261:
-#line 880 "mon_parse.y" /* yacc.c:1646  */
+  case 263:
+#line 885 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IX; }
-#line 3895 "mon_parse.c" /* yacc.c:1646  */
+#line 3931 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 262:
-#line 881 "mon_parse.y" /* yacc.c:1646  */
+  case 264:
+#line 886 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IY; }
-#line 3901 "mon_parse.c" /* yacc.c:1646  */
+#line 3937 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 263:
-#line 882 "mon_parse.y" /* yacc.c:1646  */
+  case 265:
+#line 887 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_SP; }
-#line 3907 "mon_parse.c" /* yacc.c:1646  */
+#line 3943 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 264:
-#line 884 "mon_parse.y" /* yacc.c:1646  */
+  case 266:
+#line 889 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_A; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3913 "mon_parse.c" /* yacc.c:1646  */
+#line 3949 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 265:
-#line 886 "mon_parse.y" /* yacc.c:1646  */
+  case 267:
+#line 891 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_HL; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3919 "mon_parse.c" /* yacc.c:1646  */
+#line 3955 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 266:
-#line 888 "mon_parse.y" /* yacc.c:1646  */
+  case 268:
+#line 893 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_IX; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3925 "mon_parse.c" /* yacc.c:1646  */
+#line 3961 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 267:
-#line 890 "mon_parse.y" /* yacc.c:1646  */
+  case 269:
+#line 895 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_IY; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3931 "mon_parse.c" /* yacc.c:1646  */
+#line 3967 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 268:
-#line 891 "mon_parse.y" /* yacc.c:1646  */
+  case 270:
+#line 896 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_IMPLIED; }
-#line 3937 "mon_parse.c" /* yacc.c:1646  */
+#line 3973 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 269:
-#line 892 "mon_parse.y" /* yacc.c:1646  */
+  case 271:
+#line 897 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ACCUMULATOR; }
-#line 3943 "mon_parse.c" /* yacc.c:1646  */
+#line 3979 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 270:
-#line 893 "mon_parse.y" /* yacc.c:1646  */
+  case 272:
+#line 898 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_B; }
-#line 3949 "mon_parse.c" /* yacc.c:1646  */
+#line 3985 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 271:
-#line 894 "mon_parse.y" /* yacc.c:1646  */
+  case 273:
+#line 899 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_C; }
-#line 3955 "mon_parse.c" /* yacc.c:1646  */
+#line 3991 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 272:
-#line 895 "mon_parse.y" /* yacc.c:1646  */
+  case 274:
+#line 900 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_D; }
-#line 3961 "mon_parse.c" /* yacc.c:1646  */
+#line 3997 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 273:
-#line 896 "mon_parse.y" /* yacc.c:1646  */
+  case 275:
+#line 901 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_E; }
-#line 3967 "mon_parse.c" /* yacc.c:1646  */
+#line 4003 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 274:
-#line 897 "mon_parse.y" /* yacc.c:1646  */
+  case 276:
+#line 902 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_H; }
-#line 3973 "mon_parse.c" /* yacc.c:1646  */
+#line 4009 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 275:
-#line 898 "mon_parse.y" /* yacc.c:1646  */
+  case 277:
+#line 903 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXH; }
-#line 3979 "mon_parse.c" /* yacc.c:1646  */
+#line 4015 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 276:
-#line 899 "mon_parse.y" /* yacc.c:1646  */
+  case 278:
+#line 904 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYH; }
-#line 3985 "mon_parse.c" /* yacc.c:1646  */
+#line 4021 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 277:
-#line 900 "mon_parse.y" /* yacc.c:1646  */
+  case 279:
+#line 905 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_L; }
-#line 3991 "mon_parse.c" /* yacc.c:1646  */
+#line 4027 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 278:
-#line 901 "mon_parse.y" /* yacc.c:1646  */
+  case 280:
+#line 906 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXL; }
-#line 3997 "mon_parse.c" /* yacc.c:1646  */
+#line 4033 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 279:
-#line 902 "mon_parse.y" /* yacc.c:1646  */
+  case 281:
+#line 907 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYL; }
-#line 4003 "mon_parse.c" /* yacc.c:1646  */
+#line 4039 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 280:
-#line 903 "mon_parse.y" /* yacc.c:1646  */
+  case 282:
+#line 908 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_AF; }
-#line 4009 "mon_parse.c" /* yacc.c:1646  */
+#line 4045 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 281:
-#line 904 "mon_parse.y" /* yacc.c:1646  */
+  case 283:
+#line 909 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_BC; }
-#line 4015 "mon_parse.c" /* yacc.c:1646  */
+#line 4051 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 282:
-#line 905 "mon_parse.y" /* yacc.c:1646  */
+  case 284:
+#line 910 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_DE; }
-#line 4021 "mon_parse.c" /* yacc.c:1646  */
+#line 4057 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 283:
-#line 906 "mon_parse.y" /* yacc.c:1646  */
+  case 285:
+#line 911 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_HL; }
-#line 4027 "mon_parse.c" /* yacc.c:1646  */
+#line 4063 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 284:
-#line 907 "mon_parse.y" /* yacc.c:1646  */
+  case 286:
+#line 912 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IX; }
-#line 4033 "mon_parse.c" /* yacc.c:1646  */
+#line 4069 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 285:
-#line 908 "mon_parse.y" /* yacc.c:1646  */
+  case 287:
+#line 913 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IY; }
-#line 4039 "mon_parse.c" /* yacc.c:1646  */
+#line 4075 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 286:
-#line 909 "mon_parse.y" /* yacc.c:1646  */
+  case 288:
+#line 914 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_SP; }
-#line 4045 "mon_parse.c" /* yacc.c:1646  */
+#line 4081 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 287:
-#line 911 "mon_parse.y" /* yacc.c:1646  */
+  case 289:
+#line 916 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_DIRECT; (yyval.mode).param = (yyvsp[0].i); }
-#line 4051 "mon_parse.c" /* yacc.c:1646  */
+#line 4087 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 288:
-#line 912 "mon_parse.y" /* yacc.c:1646  */
+  case 290:
+#line 917 "mon_parse.y" /* yacc.c:1646  */
     {    /* Clash with addr,x addr,y addr,s modes! */
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         if ((yyvsp[-2].i) >= -16 && (yyvsp[-2].i) < 16) {
@@ -4067,83 +4103,83 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4071 "mon_parse.c" /* yacc.c:1646  */
+#line 4107 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 289:
-#line 927 "mon_parse.y" /* yacc.c:1646  */
+  case 291:
+#line 932 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_INC1;
         }
-#line 4080 "mon_parse.c" /* yacc.c:1646  */
+#line 4116 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 290:
-#line 931 "mon_parse.y" /* yacc.c:1646  */
+  case 292:
+#line 936 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_INC2;
         }
-#line 4089 "mon_parse.c" /* yacc.c:1646  */
+#line 4125 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 291:
-#line 935 "mon_parse.y" /* yacc.c:1646  */
+  case 293:
+#line 940 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[0].i) | ASM_ADDR_MODE_INDEXED_DEC1;
         }
-#line 4098 "mon_parse.c" /* yacc.c:1646  */
+#line 4134 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 292:
-#line 939 "mon_parse.y" /* yacc.c:1646  */
+  case 294:
+#line 944 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[0].i) | ASM_ADDR_MODE_INDEXED_DEC2;
         }
-#line 4107 "mon_parse.c" /* yacc.c:1646  */
+#line 4143 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 293:
-#line 943 "mon_parse.y" /* yacc.c:1646  */
+  case 295:
+#line 948 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[0].i) | ASM_ADDR_MODE_INDEXED_OFF0;
         }
-#line 4116 "mon_parse.c" /* yacc.c:1646  */
+#line 4152 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 294:
-#line 947 "mon_parse.y" /* yacc.c:1646  */
+  case 296:
+#line 952 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFFB;
         }
-#line 4125 "mon_parse.c" /* yacc.c:1646  */
+#line 4161 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 295:
-#line 951 "mon_parse.y" /* yacc.c:1646  */
+  case 297:
+#line 956 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFFA;
         }
-#line 4134 "mon_parse.c" /* yacc.c:1646  */
+#line 4170 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 296:
-#line 955 "mon_parse.y" /* yacc.c:1646  */
+  case 298:
+#line 960 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFFD;
         }
-#line 4143 "mon_parse.c" /* yacc.c:1646  */
+#line 4179 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 297:
-#line 959 "mon_parse.y" /* yacc.c:1646  */
+  case 299:
+#line 964 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).param = (yyvsp[-2].i);
@@ -4156,11 +4192,11 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4160 "mon_parse.c" /* yacc.c:1646  */
+#line 4196 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 298:
-#line 971 "mon_parse.y" /* yacc.c:1646  */
+  case 300:
+#line 976 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         if ((yyvsp[-3].i) >= -16 && (yyvsp[-3].i) < 16) {
@@ -4176,83 +4212,83 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4180 "mon_parse.c" /* yacc.c:1646  */
+#line 4216 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 299:
-#line 986 "mon_parse.y" /* yacc.c:1646  */
+  case 301:
+#line 991 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_INC1;
         }
-#line 4189 "mon_parse.c" /* yacc.c:1646  */
+#line 4225 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 300:
-#line 990 "mon_parse.y" /* yacc.c:1646  */
+  case 302:
+#line 995 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-3].i) | ASM_ADDR_MODE_INDEXED_INC2;
         }
-#line 4198 "mon_parse.c" /* yacc.c:1646  */
+#line 4234 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 301:
-#line 994 "mon_parse.y" /* yacc.c:1646  */
+  case 303:
+#line 999 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_DEC1;
         }
-#line 4207 "mon_parse.c" /* yacc.c:1646  */
+#line 4243 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 302:
-#line 998 "mon_parse.y" /* yacc.c:1646  */
+  case 304:
+#line 1003 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_DEC2;
         }
-#line 4216 "mon_parse.c" /* yacc.c:1646  */
+#line 4252 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 303:
-#line 1002 "mon_parse.y" /* yacc.c:1646  */
+  case 305:
+#line 1007 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFF0;
         }
-#line 4225 "mon_parse.c" /* yacc.c:1646  */
+#line 4261 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 304:
-#line 1006 "mon_parse.y" /* yacc.c:1646  */
+  case 306:
+#line 1011 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_OFFB;
         }
-#line 4234 "mon_parse.c" /* yacc.c:1646  */
+#line 4270 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 305:
-#line 1010 "mon_parse.y" /* yacc.c:1646  */
+  case 307:
+#line 1015 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_OFFA;
         }
-#line 4243 "mon_parse.c" /* yacc.c:1646  */
+#line 4279 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 306:
-#line 1014 "mon_parse.y" /* yacc.c:1646  */
+  case 308:
+#line 1019 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_OFFD;
         }
-#line 4252 "mon_parse.c" /* yacc.c:1646  */
+#line 4288 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 307:
-#line 1018 "mon_parse.y" /* yacc.c:1646  */
+  case 309:
+#line 1023 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).param = (yyvsp[-3].i);
@@ -4265,60 +4301,60 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4269 "mon_parse.c" /* yacc.c:1646  */
+#line 4305 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 308:
-#line 1030 "mon_parse.y" /* yacc.c:1646  */
+  case 310:
+#line 1035 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | ASM_ADDR_MODE_EXTENDED_INDIRECT;
         (yyval.mode).param = (yyvsp[-1].i);
         }
-#line 4279 "mon_parse.c" /* yacc.c:1646  */
+#line 4315 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 309:
-#line 1035 "mon_parse.y" /* yacc.c:1646  */
+  case 311:
+#line 1040 "mon_parse.y" /* yacc.c:1646  */
     {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT_LONG_Y;
         (yyval.mode).param = (yyvsp[-3].i);
         }
-#line 4288 "mon_parse.c" /* yacc.c:1646  */
+#line 4324 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 310:
-#line 1043 "mon_parse.y" /* yacc.c:1646  */
+  case 312:
+#line 1048 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (0 << 5); printf("reg_x\n"); }
-#line 4294 "mon_parse.c" /* yacc.c:1646  */
+#line 4330 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 311:
-#line 1044 "mon_parse.y" /* yacc.c:1646  */
+  case 313:
+#line 1049 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (1 << 5); printf("reg_y\n"); }
-#line 4300 "mon_parse.c" /* yacc.c:1646  */
+#line 4336 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 312:
-#line 1045 "mon_parse.y" /* yacc.c:1646  */
+  case 314:
+#line 1050 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (yyvsp[0].i); }
-#line 4306 "mon_parse.c" /* yacc.c:1646  */
+#line 4342 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 313:
-#line 1046 "mon_parse.y" /* yacc.c:1646  */
+  case 315:
+#line 1051 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (3 << 5); printf("reg_s\n"); }
-#line 4312 "mon_parse.c" /* yacc.c:1646  */
+#line 4348 "mon_parse.c" /* yacc.c:1646  */
     break;
 
-  case 314:
-#line 1050 "mon_parse.y" /* yacc.c:1646  */
+  case 316:
+#line 1055 "mon_parse.y" /* yacc.c:1646  */
     { (yyval.i) = (2 << 5); printf("reg_u\n"); }
-#line 4318 "mon_parse.c" /* yacc.c:1646  */
+#line 4354 "mon_parse.c" /* yacc.c:1646  */
     break;
 
 
-#line 4322 "mon_parse.c" /* yacc.c:1646  */
+#line 4358 "mon_parse.c" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -4546,7 +4582,7 @@ yyreturn:
 #endif
   return yyresult;
 }
-#line 1054 "mon_parse.y" /* yacc.c:1906  */
+#line 1059 "mon_parse.y" /* yacc.c:1906  */
 
 
 void parse_and_execute_line(char *input)
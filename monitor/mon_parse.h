@@ -156,56 +156,57 @@ extern int yydebug;
     CMD_AUTOSTART = 366,
     CMD_AUTOLOAD = 367,
     CMD_MAINCPU_TRACE = 368,
-    CMD_LABEL_ASGN = 369,
-    L_PAREN = 370,
-    R_PAREN = 371,
-    ARG_IMMEDIATE = 372,
-    REG_A = 373,
-    REG_X = 374,
-    REG_Y = 375,
-    COMMA = 376,
-    INST_SEP = 377,
-    L_BRACKET = 378,
-    R_BRACKET = 379,
-    LESS_THAN = 380,
-    REG_U = 381,
-    REG_S = 382,
-    REG_PC = 383,
-    REG_PCR = 384,
-    REG_B = 385,
-    REG_C = 386,
-    REG_D = 387,
-    REG_E = 388,
-    REG_H = 389,
-    REG_L = 390,
-    REG_AF = 391,
-    REG_BC = 392,
-    REG_DE = 393,
-    REG_HL = 394,
-    REG_IX = 395,
-    REG_IY = 396,
-    REG_SP = 397,
-    REG_IXH = 398,
-    REG_IXL = 399,
-    REG_IYH = 400,
-    REG_IYL = 401,
-    PLUS = 402,
-    MINUS = 403,
-    STRING = 404,
-    FILENAME = 405,
-    R_O_L = 406,
-    OPCODE = 407,
-    LABEL = 408,
-    BANKNAME = 409,
-    CPUTYPE = 410,
-    MON_REGISTER = 411,
-    COMPARE_OP = 412,
-    RADIX_TYPE = 413,
-    INPUT_SPEC = 414,
-    CMD_CHECKPT_ON = 415,
-    CMD_CHECKPT_OFF = 416,
-    TOGGLE = 417,
-    MASK = 418
+    CMD_PROFILE = 369,
+    CMD_LABEL_ASGN = 370,
+    L_PAREN = 371,
+    R_PAREN = 372,
+    ARG_IMMEDIATE = 373,
+    REG_A = 374,
+    REG_X = 375,
+    REG_Y = 376,
+    COMMA = 377,
+    INST_SEP = 378,
+    L_BRACKET = 379,
+    R_BRACKET = 380,
+    LESS_THAN = 381,
+    REG_U = 382,
+    REG_S = 383,
+    REG_PC = 384,
+    REG_PCR = 385,
+    REG_B = 386,
+    REG_C = 387,
+    REG_D = 388,
+    REG_E = 389,
+    REG_H = 390,
+    REG_L = 391,
+    REG_AF = 392,
+    REG_BC = 393,
+    REG_DE = 394,
+    REG_HL = 395,
+    REG_IX = 396,
+    REG_IY = 397,
+    REG_SP = 398,
+    REG_IXH = 399,
+    REG_IXL = 400,
+    REG_IYH = 401,
+    REG_IYL = 402,
+    PLUS = 403,
+    MINUS = 404,
+    STRING = 405,
+    FILENAME = 406,
+    R_O_L = 407,
+    OPCODE = 408,
+    LABEL = 409,
+    BANKNAME = 410,
+    CPUTYPE = 411,
+    MON_REGISTER = 412,
+    COMPARE_OP = 413,
+    RADIX_TYPE = 414,
+    INPUT_SPEC = 415,
+    CMD_CHECKPT_ON = 416,
+    CMD_CHECKPT_OFF = 417,
+    TOGGLE = 418,
+    MASK = 419
   };
 #endif
 /* Tokens.  */
@@ -320,63 +321,64 @@ extern int yydebug;
 #define CMD_AUTOSTART 366
 #define CMD_AUTOLOAD 367
 #define CMD_MAINCPU_TRACE 368
-#define CMD_LABEL_ASGN 369
-#define L_PAREN 370
-#define R_PAREN 371
-#define ARG_IMMEDIATE 372
-#define REG_A 373
-#define REG_X 374
-#define REG_Y 375
-#define COMMA 376
-#define INST_SEP 377
-#define L_BRACKET 378
-#define R_BRACKET 379
-#define LESS_THAN 380
-#define REG_U 381
-#define REG_S 382
-#define REG_PC 383
-#define REG_PCR 384
-#define REG_B 385
-#define REG_C 386
-#define REG_D 387
-#define REG_E 388
-#define REG_H 389
-#define REG_L 390
-#define REG_AF 391
-#define REG_BC 392
-#define REG_DE 393
-#define REG_HL 394
-#define REG_IX 395
-#define REG_IY 396
-#define REG_SP 397
-#define REG_IXH 398
-#define REG_IXL 399
-#define REG_IYH 400
-#define REG_IYL 401
-#define PLUS 402
-#define MINUS 403
-#define STRING 404
-#define FILENAME 405
-#define R_O_L 406
-#define OPCODE 407
-#define LABEL 408
-#define BANKNAME 409
-#define CPUTYPE 410
-#define MON_REGISTER 411
-#define COMPARE_OP 412
-#define RADIX_TYPE 413
-#define INPUT_SPEC 414
-#define CMD_CHECKPT_ON 415
-#define CMD_CHECKPT_OFF 416
-#define TOGGLE 417
-#define MASK 418
+#define CMD_PROFILE 369
+#define CMD_LABEL_ASGN 370
+#define L_PAREN 371
+#define R_PAREN 372
+#define ARG_IMMEDIATE 373
+#define REG_A 374
+#define REG_X 375
+#define REG_Y 376
+#define COMMA 377
+#define INST_SEP 378
+#define L_BRACKET 379
+#define R_BRACKET 380
+#define LESS_THAN 381
+#define REG_U 382
+#define REG_S 383
+#define REG_PC 384
+#define REG_PCR 385
+#define REG_B 386
+#define REG_C 387
+#define REG_D 388
+#define REG_E 389
+#define REG_H 390
+#define REG_L 391
+#define REG_AF 392
+#define REG_BC 393
+#define REG_DE 394
+#define REG_HL 395
+#define REG_IX 396
+#define REG_IY 397
+#define REG_SP 398
+#define REG_IXH 399
+#define REG_IXL 400
+#define REG_IYH 401
+#define REG_IYL 402
+#define PLUS 403
+#define MINUS 404
+#define STRING 405
+#define FILENAME 406
+#define R_O_L 407
+#define OPCODE 408
+#define LABEL 409
+#define BANKNAME 410
+#define CPUTYPE 411
+#define MON_REGISTER 412
+#define COMPARE_OP 413
+#define RADIX_TYPE 414
+#define INPUT_SPEC 415
+#define CMD_CHECKPT_ON 416
+#define CMD_CHECKPT_OFF 417
+#define TOGGLE 418
+#define MASK 419
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 
 union YYSTYPE
 {
-#line 135 "mon_parse.y" /* yacc.c:1909  */
+#line 136 "mon_parse.y" /* yacc.c:1909  */
 
     MON_ADDR a;
     MON_ADDR range[2];
@@ -389,7 +391,7 @@ union YYSTYPE
     char *str;
     asm_mode_addr_info_t mode;
 
-#line 393 "mon_parse.h" /* yacc.c:1909  */
+#line 395 "mon_parse.h" /* yacc.c:1909  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -1212,10 +1212,37 @@ static int set_keep_monitor_open(int val, void *param)
 }
 #endif
 
+#ifdef FEATURE_CPUMEMHISTORY
+static void cpuhistory_trap(uint16_t addr, void *data)
+{
+    /* nothing to do, the main CPU checks the resource after the trap */
+}
+
+/* The main CPU picks this up at its next pending interrupt and switches to
+   the instance of its main loop that records (or skips) the history.  A
+   trap is raised so that this happens at the next instruction.  */
+static int set_cpuhistory_enabled(int val, void *param)
+{
+    val = val ? 1 : 0;
+
+    if (val != monitor_cpuhistory_enabled && maincpu_int_status != NULL
+        && !(maincpu_int_status->global_pending_int & IK_TRAP)) {
+        interrupt_maincpu_trigger_trap(cpuhistory_trap, NULL);
+    }
+    monitor_cpuhistory_enabled = val;
+
+    return 0;
+}
+#endif
+
 static const resource_int_t resources_int[] = {
 #ifdef ARCHDEP_SEPERATE_MONITOR_WINDOW
     { "KeepMonitorOpen", 1, RES_EVENT_NO, NULL,
       &keep_monitor_open, set_keep_monitor_open, NULL },
+#endif
+#ifdef FEATURE_CPUMEMHISTORY
+    { "CPUMemHistory", 0, RES_EVENT_NO, NULL,
+      &monitor_cpuhistory_enabled, set_cpuhistory_enabled, NULL },
 #endif
     RESOURCE_INT_LIST_END
 };
@@ -95,7 +95,7 @@ static int palette_set_entry(palette_t *p, unsigned int number,
     return 0;
 }
 
-static int palette_copy(palette_t *dest, const palette_t *src)
+int palette_copy(palette_t *dest, const palette_t *src)
 {
     unsigned int i;
 
@@ -46,6 +46,7 @@ typedef struct palette_s {
 extern void palette_init(void);
 extern palette_t *palette_create(unsigned int num_entries, const char *entry_names[]);
 extern void palette_free(palette_t *p);
+extern int palette_copy(palette_t *dest, const palette_t *src);
 extern int palette_load(const char *file_name, palette_t *palette_return);
 extern int palette_save(const char *file_name, const palette_t *palette);
 
@@ -0,0 +1,131 @@
+/*
+ * profile.c - Hot path profiling counters.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "alarm.h"
+#include "monitor.h"
+#include "profile.h"
+#include "types.h"
+#include "vsync.h"
+
+#ifdef FEATURE_PROFILING
+
+unsigned long profile_counters[PROFILE_NUM_COUNTERS];
+
+/* Number of frames emulated since the last reset.  */
+static unsigned long profile_frames;
+
+static const char * const profile_counter_names[PROFILE_NUM_COUNTERS] = {
+    "CPU instructions",
+    "Raster lines drawn",
+    "Raster cache hits",
+    "Drive CPU cycles",
+    "SID samples"
+};
+
+void profile_frame(void)
+{
+    profile_frames++;
+}
+
+static void profile_show_line(const char *name, unsigned long count,
+                              double frames, double seconds)
+{
+    mon_out("%-32s %12lu %12.1f %14.1f\n", name, count,
+            frames > 0.0 ? count / frames : 0.0,
+            seconds > 0.0 ? count / seconds : 0.0);
+}
+
+void profile_show(void)
+{
+    alarm_context_t *context;
+    alarm_t *alarm;
+    double frames, seconds, refresh;
+    char name[64];
+    int i;
+
+    refresh = vsync_get_refresh_frequency();
+    frames = (double)profile_frames;
+    seconds = refresh > 0.0 ? frames / refresh : 0.0;
+
+    mon_out("%lu frames, %.2f emulated seconds since last reset.\n",
+            profile_frames, seconds);
+    mon_out("%-32s %12s %12s %14s\n", "Counter", "total", "per frame",
+            "per second");
+
+    for (i = 0; i < PROFILE_NUM_COUNTERS; i++) {
+        profile_show_line(profile_counter_names[i], profile_counters[i],
+                          frames, seconds);
+    }
+
+    for (context = alarm_context_list; context != NULL;
+         context = context->next_context) {
+        for (alarm = context->alarms; alarm != NULL; alarm = alarm->next) {
+            if (alarm->dispatch_count == 0) {
+                continue;
+            }
+            sprintf(name, "Alarm %.24s/%.24s", context->name, alarm->name);
+            profile_show_line(name, alarm->dispatch_count, frames, seconds);
+        }
+    }
+}
+
+void profile_reset(void)
+{
+    alarm_context_t *context;
+    alarm_t *alarm;
+
+    memset(profile_counters, 0, sizeof(profile_counters));
+    profile_frames = 0;
+
+    for (context = alarm_context_list; context != NULL;
+         context = context->next_context) {
+        for (alarm = context->alarms; alarm != NULL; alarm = alarm->next) {
+            alarm->dispatch_count = 0;
+        }
+    }
+}
+
+#else /* !FEATURE_PROFILING */
+
+/* stubs */
+static void profile_stub(void)
+{
+    mon_out("Disabled. define FEATURE_PROFILING and recompile.\n");
+}
+
+void profile_show(void)
+{
+    profile_stub();
+}
+
+void profile_reset(void)
+{
+    profile_stub();
+}
+
+#endif
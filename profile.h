@@ -0,0 +1,67 @@
+/*
+ * profile.h - Hot path profiling counters.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_PROFILE_H
+#define VICE_PROFILE_H
+
+#include "types.h"
+
+/* The counters are only compiled in when FEATURE_PROFILING is defined;
+   otherwise the macros below expand to nothing.  Alarms are counted per
+   alarm in `alarm_t' itself.  */
+
+enum profile_counter_e {
+    PROFILE_CPU_INSTRUCTIONS = 0,
+    PROFILE_RASTER_LINES,
+    PROFILE_RASTER_CACHE_HITS,
+    PROFILE_DRIVE_CYCLES,
+    PROFILE_SID_SAMPLES,
+    PROFILE_NUM_COUNTERS
+};
+
+#ifdef FEATURE_PROFILING
+
+extern unsigned long profile_counters[PROFILE_NUM_COUNTERS];
+
+#define PROFILE_INC(counter) \
+    (profile_counters[(counter)]++)
+
+#define PROFILE_ADD(counter, value) \
+    (profile_counters[(counter)] += (unsigned long)(value))
+
+extern void profile_frame(void);
+
+#else
+
+#define PROFILE_INC(counter)
+#define PROFILE_ADD(counter, value)
+
+#define profile_frame()
+
+#endif
+
+/* Monitor interface, always available.  */
+extern void profile_show(void);
+extern void profile_reset(void);
+
+#endif
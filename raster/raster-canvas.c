@@ -39,26 +39,21 @@
 #include "viewport.h"
 
 
-inline static void refresh_canvas(raster_t *raster)
+inline static void refresh_span(raster_t *raster,
+                                const raster_canvas_span_t *span)
 {
-    raster_canvas_area_t *update_area;
     viewport_t *viewport;
     int x, y, xx, yy;
     int w, h;
 
-    update_area = raster->update_area;
     viewport = raster->canvas->viewport;
 
-    if (update_area->is_null) {
-        return;
-    }
-
-    x = update_area->xs;
-    y = update_area->ys;
-    xx = update_area->xs - viewport->first_x;
-    yy = update_area->ys - viewport->first_line;
-    w = update_area->xe - update_area->xs + 1;
-    h = update_area->ye - update_area->ys + 1;
+    x = span->xs;
+    y = span->ys;
+    xx = span->xs - viewport->first_x;
+    yy = span->ys - viewport->first_line;
+    w = span->xe - span->xs + 1;
+    h = span->ye - span->ys + 1;
 
     if (raster->canvas->videoconfig->filter == VIDEO_FILTER_CRT) {
         /* if pal emu is activated, more pixels have to be updated: around,
@@ -101,6 +96,24 @@ inline static void refresh_canvas(raster_t *raster)
                              MIN(w, (int)(raster->canvas->draw_buffer->canvas_width - xx)),
                              MIN(h, (int)(raster->canvas->draw_buffer->canvas_height - yy)));
     }
+}
+
+/* Refresh only the spans of lines that changed, so that the unchanged
+   lines between them are neither rendered nor uploaded.  */
+inline static void refresh_canvas(raster_t *raster)
+{
+    raster_canvas_area_t *update_area;
+    unsigned int i;
+
+    update_area = raster->update_area;
+
+    if (update_area->is_null) {
+        return;
+    }
+
+    for (i = 0; i < update_area->num_spans; i++) {
+        refresh_span(raster, &update_area->spans[i]);
+    }
 
     update_area->is_null = 1;
 }
@@ -131,6 +144,7 @@ void raster_canvas_init(raster_t *raster)
     raster->update_area = lib_malloc(sizeof(raster_canvas_area_t));
 
     raster->update_area->is_null = 1;
+    raster->update_area->num_spans = 0;
 }
 
 void raster_canvas_shutdown(raster_t *raster)
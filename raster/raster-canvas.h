@@ -29,13 +29,30 @@
 
 struct raster_s;
 
-/* A simple convenience type for defining a rectangular area on the screen.  */
+/* Maximum number of separate line ranges tracked per frame.  */
+#define RASTER_CANVAS_MAX_SPANS 8
+
+/* A range of consecutive changed lines.  */
+struct raster_canvas_span_s {
+    unsigned int xs;
+    unsigned int ys;
+    unsigned int xe;
+    unsigned int ye;
+};
+typedef struct raster_canvas_span_s raster_canvas_span_t;
+
+/* A simple convenience type for defining a rectangular area on the screen.
+   Besides the bounding rectangle, the changed lines are kept as separate
+   spans so that unchanged lines in between need not be refreshed; once
+   all spans are used, the last one grows to take further lines.  */
 struct raster_canvas_area_s {
     unsigned int xs;
     unsigned int ys;
     unsigned int xe;
     unsigned int ye;
     int is_null;
+    raster_canvas_span_t spans[RASTER_CANVAS_MAX_SPANS];
+    unsigned int num_spans;
 };
 typedef struct raster_canvas_area_s raster_canvas_area_t;
 
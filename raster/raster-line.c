@@ -33,6 +33,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "profile.h"
 #include "raster-cache.h"
 #include "raster-canvas.h"
 #include "raster-changes.h"
@@ -57,17 +58,38 @@ unsigned int raster_line_get_real_mode(raster_t *raster)
 inline static void add_line_to_area(raster_canvas_area_t *area, unsigned int y,
                                     unsigned int xs, unsigned int xe)
 {
+    raster_canvas_span_t *span;
+
     if (area->is_null) {
         area->ys = area->ye = y;
         area->xs = xs;
         area->xe = xe;
         area->is_null = 0;
+        area->num_spans = 0;
     } else {
         area->xs = MIN(xs, area->xs);
         area->xe = MAX(xe, area->xe);
         area->ys = MIN(y, area->ys);
         area->ye = MAX(y, area->ye);
     }
+
+    /* Lines usually arrive in order: extend the current span if `y' is next
+       to it, otherwise start a new one.  */
+    if (area->num_spans > 0) {
+        span = &area->spans[area->num_spans - 1];
+        if (y <= span->ye + 1 || area->num_spans == RASTER_CANVAS_MAX_SPANS) {
+            span->xs = MIN(xs, span->xs);
+            span->xe = MAX(xe, span->xe);
+            span->ys = MIN(y, span->ys);
+            span->ye = MAX(y, span->ye);
+            return;
+        }
+    }
+
+    span = &area->spans[area->num_spans++];
+    span->ys = span->ye = y;
+    span->xs = xs;
+    span->xe = xe;
 }
 
 inline void raster_line_draw_blank(raster_t *raster, unsigned int start,
@@ -387,6 +409,9 @@ static void handle_visible_line_with_cache(raster_t *raster)
         needs_update = update_for_minor_changes(raster,
                                                 &changed_start,
                                                 &changed_end);
+        if (!needs_update) {
+            PROFILE_INC(PROFILE_RASTER_CACHE_HITS);
+        }
     }
 
     if (needs_update) {
@@ -631,6 +656,8 @@ static void handle_visible_line_with_changes(raster_t *raster)
 
 inline static void handle_visible_line(raster_t *raster)
 {
+    PROFILE_INC(PROFILE_RASTER_LINES);
+
     if (raster->changes->have_on_this_line) {
         handle_visible_line_with_changes(raster);
     } else {
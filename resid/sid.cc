@@ -27,6 +27,14 @@
 #include "sid.h"
 #include <math.h>
 
+#if defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(_M_X64)
+#define RESID_CONVOLVE_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define RESID_CONVOLVE_NEON 1
+#include <arm_neon.h>
+#endif
+
 #ifndef round
 #define round(x) (x>=0.0?floor(x+0.5):ceil(x-0.5))
 #endif
@@ -860,6 +868,53 @@ int SID::clock_interpolate(cycle_count& delta_t, short* buf, int n, int interlea
 }
 
 
+// ----------------------------------------------------------------------------
+// Inner product of a sample window and a FIR table.
+// The sum is accumulated in 32 bit integers in all variants, so the vector
+// kernels give exactly the same result as the scalar loop.
+// ----------------------------------------------------------------------------
+static inline int convolve(const short* a, const short* b, int n)
+{
+  int out = 0;
+
+#if defined(RESID_CONVOLVE_SSE2)
+  __m128i acc = _mm_setzero_si128();
+  for (; n >= 8; n -= 8, a += 8, b += 8) {
+    __m128i va = _mm_loadu_si128((const __m128i*)a);
+    __m128i vb = _mm_loadu_si128((const __m128i*)b);
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(va, vb));
+  }
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+  out = _mm_cvtsi128_si32(acc);
+#elif defined(RESID_CONVOLVE_NEON)
+  int32x4_t acc = vdupq_n_s32(0);
+  for (; n >= 8; n -= 8, a += 8, b += 8) {
+    int16x8_t va = vld1q_s16(a);
+    int16x8_t vb = vld1q_s16(b);
+    acc = vmlal_s16(acc, vget_low_s16(va), vget_low_s16(vb));
+    acc = vmlal_s16(acc, vget_high_s16(va), vget_high_s16(vb));
+  }
+  int32x2_t sum = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+  out = vget_lane_s32(vpadd_s32(sum, sum), 0);
+#else
+  int out1 = 0, out2 = 0, out3 = 0;
+  for (; n >= 4; n -= 4, a += 4, b += 4) {
+    out += a[0]*b[0];
+    out1 += a[1]*b[1];
+    out2 += a[2]*b[2];
+    out3 += a[3]*b[3];
+  }
+  out += out1 + out2 + out3;
+#endif
+
+  for (; n > 0; n--) {
+    out += *a++ * *b++;
+  }
+
+  return out;
+}
+
 // ----------------------------------------------------------------------------
 // SID clocking with audio sampling - cycle based with audio resampling.
 //
@@ -927,10 +982,7 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n, int interleave)
     short* sample_start = sample + sample_index - fir_N - 1 + RINGSIZE;
 
     // Convolution with filter impulse response.
-    int v1 = 0;
-    for (int j = 0; j < fir_N; j++) {
-      v1 += sample_start[j]*fir_start[j];
-    }
+    int v1 = convolve(sample_start, fir_start, fir_N);
 
     // Use next FIR table, wrap around to first FIR table using
     // next sample.
@@ -941,10 +993,7 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n, int interleave)
     fir_start = fir + fir_offset*fir_N;
 
     // Convolution with filter impulse response.
-    int v2 = 0;
-    for (int k = 0; k < fir_N; k++) {
-      v2 += sample_start[k]*fir_start[k];
-    }
+    int v2 = convolve(sample_start, fir_start, fir_N);
 
     // Linear interpolation.
     // fir_offset_rmd is equal for all samples, it can thus be factorized out:
@@ -1002,10 +1051,7 @@ int SID::clock_resample_fastmem(cycle_count& delta_t, short* buf, int n, int int
     short* sample_start = sample + sample_index - fir_N + RINGSIZE;
 
     // Convolution with filter impulse response.
-    int v = 0;
-    for (int j = 0; j < fir_N; j++) {
-      v += sample_start[j]*fir_start[j];
-    }
+    int v = convolve(sample_start, fir_start, fir_N);
 
     v >>= FIR_SHIFT;
 
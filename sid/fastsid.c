@@ -763,22 +763,185 @@ static int16_t fastsid_calculate_single_sample(sound_t *psid, int i)
     return (int16_t)(((int32_t)((o0 + o1 + o2) >> 20) - 0x600) * psid->vol);
 }
 
+#ifdef WAVETABLES
+/* Number of samples calculated per pass in the block renderer.  */
+#define FASTSID_BLOCK_SIZE 256
+
+/* Advance the oscillator of one voice over a block, recording the counter
+   value for every sample, and the noise output if noise is selected.  */
+static void fastsid_block_osc(voice_t *pv, uint32_t *phase, uint32_t *noise, int n)
+{
+    int i;
+    uint32_t f = pv->f, fs = pv->fs, rv = pv->rv;
+
+    if (pv->noise) {
+        for (i = 0; i < n; i++) {
+            if ((f += fs) < fs) {
+                rv = NSHIFT(rv, 16);
+            }
+            phase[i] = f;
+            noise[i] = ((uint32_t)NVALUE(NSHIFT(rv, f >> 28))) << 7;
+        }
+    } else {
+        for (i = 0; i < n; i++) {
+            if ((f += fs) < fs) {
+                rv = NSHIFT(rv, 16);
+            }
+            phase[i] = f;
+        }
+    }
+    pv->f = f;
+    pv->rv = rv;
+}
+
+/* Run the envelope and waveform lookup of one voice over a block.  `ring'
+   holds the counter values of the voice that ring modulates this one.  */
+static void fastsid_block_voice(voice_t *pv, const uint32_t *phase,
+                                const uint32_t *noise, const uint32_t *ring,
+                                uint32_t *out, int n, int muted)
+{
+    int i;
+    uint32_t o, adsr = pv->adsr, adsrz = pv->adsrz;
+    int32_t adsrs = pv->adsrs;
+    const uint16_t *wt = pv->wt;
+    uint32_t wtpf = pv->wtpf, wtl = pv->wtl;
+    uint16_t wtr[2];
+
+    wtr[0] = pv->wtr[0];
+    wtr[1] = pv->wtr[1];
+
+    for (i = 0; i < n; i++) {
+        if ((adsr += adsrs) + 0x80000000 < adsrz + 0x80000000) {
+            pv->adsr = adsr;
+            trigger_adsr(pv);
+            adsr = pv->adsr;
+            adsrs = pv->adsrs;
+            adsrz = pv->adsrz;
+        }
+        o = muted ? 0 : adsr >> 16;
+        if (o) {
+            if (noise != NULL) {
+                o *= noise[i];
+            } else {
+                o *= wt[(phase[i] + wtpf) >> wtl] ^ wtr[ring[i] >> 31];
+            }
+        }
+        out[i] = o;
+    }
+    pv->adsr = adsr;
+}
+
+/* Run the filters over a block.  The three voices are filtered in the same
+   loop, as each filter is a serial recurrence and interleaving them keeps
+   the pipeline busy.  The state is worked on in local copies, so it can
+   stay in registers.  */
+static void fastsid_block_filter(sound_t *psid, uint32_t *out0, uint32_t *out1,
+                                 uint32_t *out2, int n)
+{
+    int i, v;
+    voice_t fv[3];
+
+    for (v = 0; v < 3; v++) {
+        fv[v].s = psid;
+        fv[v].filter = psid->v[v].filter;
+        fv[v].filtLow = psid->v[v].filtLow;
+        fv[v].filtRef = psid->v[v].filtRef;
+        fv[v].filtIO = psid->v[v].filtIO;
+    }
+
+    for (i = 0; i < n; i++) {
+        fv[0].filtIO = ampMod1x8[(out0[i] >> 22)];
+        dofilter(&fv[0]);
+        out0[i] = ((uint32_t)(fv[0].filtIO) + 0x80) << (7 + 15);
+        fv[1].filtIO = ampMod1x8[(out1[i] >> 22)];
+        dofilter(&fv[1]);
+        out1[i] = ((uint32_t)(fv[1].filtIO) + 0x80) << (7 + 15);
+        fv[2].filtIO = ampMod1x8[(out2[i] >> 22)];
+        dofilter(&fv[2]);
+        out2[i] = ((uint32_t)(fv[2].filtIO) + 0x80) << (7 + 15);
+    }
+
+    for (v = 0; v < 3; v++) {
+        psid->v[v].filtLow = fv[v].filtLow;
+        psid->v[v].filtRef = fv[v].filtRef;
+        psid->v[v].filtIO = fv[v].filtIO;
+    }
+}
+
+/* Calculate `nr' samples one voice at a time.  Register writes only
+   happen between calls, so the SID and voice setup is valid for the whole
+   buffer; hard sync couples the oscillators of different voices within
+   a sample, so it is left to the per-sample path.  */
+static void fastsid_calculate_block(sound_t *psid, int16_t *pbuf, int nr,
+                                    int interleave)
+{
+    uint32_t phase[3][FASTSID_BLOCK_SIZE];
+    uint32_t noise[3][FASTSID_BLOCK_SIZE];
+    uint32_t out[3][FASTSID_BLOCK_SIZE];
+    int i, n, v;
+
+    while (nr > 0) {
+        n = nr > FASTSID_BLOCK_SIZE ? FASTSID_BLOCK_SIZE : nr;
+
+        for (v = 0; v < 3; v++) {
+            fastsid_block_osc(&psid->v[v], phase[v], noise[v], n);
+        }
+
+        for (v = 0; v < 3; v++) {
+            fastsid_block_voice(&psid->v[v], phase[v],
+                                psid->v[v].noise ? noise[v] : NULL,
+                                phase[(v + 2) % 3], out[v], n,
+                                v == 2 && !psid->has3);
+        }
+
+        if (psid->emulatefilter) {
+            fastsid_block_filter(psid, out[0], out[1], out[2], n);
+        }
+
+        for (i = 0; i < n; i++) {
+            pbuf[i * interleave] = (int16_t)(((int32_t)((out[0][i] + out[1][i] + out[2][i]) >> 20) - 0x600) * psid->vol);
+        }
+
+        pbuf += n * interleave;
+        nr -= n;
+    }
+}
+#endif
+
+/* Calculate `nr' samples, in blocks when possible.  */
+static void fastsid_calculate_buffer(sound_t *psid, int16_t *pbuf, int nr,
+                                     int interleave)
+{
+    int i;
+
+    setup_sid(psid);
+    setup_voice(&psid->v[0]);
+    setup_voice(&psid->v[1]);
+    setup_voice(&psid->v[2]);
+
+#ifdef WAVETABLES
+    if (!psid->v[0].sync && !psid->v[1].sync && !psid->v[2].sync) {
+        fastsid_calculate_block(psid, pbuf, nr, interleave);
+        return;
+    }
+#endif
+
+    for (i = 0; i < nr; i++) {
+        pbuf[i * interleave] = fastsid_calculate_single_sample(psid, i);
+    }
+}
+
 static int fastsid_calculate_samples(sound_t *psid, int16_t *pbuf, int nr,
                                      int interleave, int *delta_t)
 {
-    int i;
     int16_t *tmp_buf;
 
     if (psid->factor == 1000) {
-        for (i = 0; i < nr; i++) {
-            pbuf[i * interleave] = fastsid_calculate_single_sample(psid, i);
-        }
+        fastsid_calculate_buffer(psid, pbuf, nr, interleave);
         return nr;
     }
     tmp_buf = getbuf(2 * nr * psid->factor / 1000);
-    for (i = 0; i < (nr * psid->factor / 1000); i++) {
-        tmp_buf[i * interleave] = fastsid_calculate_single_sample(psid, i);
-    }
+    fastsid_calculate_buffer(psid, tmp_buf, nr * psid->factor / 1000, interleave);
     memcpy(pbuf, tmp_buf, 2 * nr);
     return nr;
 }
@@ -273,6 +273,11 @@ static void resid_prevent_clk_overflow(sound_t *psid, CLOCK sub)
 {
 }
 
+static void resid_adjust_sampling_frequency(sound_t *psid, double sample_freq)
+{
+    psid->sid->adjust_sampling_frequency(sample_freq * psid->factor / 1000);
+}
+
 static char *resid_dump_state(sound_t *psid)
 {
     return lib_stralloc("");
@@ -365,7 +370,8 @@ sid_engine_t resid_hooks =
     resid_prevent_clk_overflow,
     resid_dump_state,
     resid_state_read,
-    resid_state_write
+    resid_state_write,
+    resid_adjust_sampling_frequency
 };
 
 } // extern "C"
@@ -60,6 +60,9 @@ static void set_sid_engine_with_fallback(int engine)
 
 static int intended_sid_engine = -1;
 
+/* Whether the snapshot being read changes the sound setup.  */
+static int sound_reopen = 1;
+
 /* ---------------------------------------------------------------------*/
 
 /* SID snapshot module format:
@@ -207,38 +210,60 @@ static int sid_snapshot_read_module_simple(snapshot_t *s, int sidnr)
     /* Handle 1.3 snapshots differently */
     if (SNAPVAL(major_version, minor_version, 1, 3)) {
         if (!sidnr) {
+            int cur_sids, cur_sound, cur_engine;
+
             if (SMR_B_INT(m, &sids) < 0) {
                 goto fail;
             }
-            resources_set_int("SidStereo", sids);
             if (0
                 || SMR_B(m, &tmp[0]) < 0
                 || SMR_B(m, &tmp[1]) < 0) {
                 goto fail;
             }
-            screenshot_prepare_reopen();
-            sound_close();
-            screenshot_try_reopen();
-            resources_set_int("Sound", (int)tmp[0]);
+
+            /* Reopening sound re-initializes the engine, which is far too
+               slow for in-memory snapshots taken every few frames (rewind,
+               run-ahead); only do it if the setup actually changes. The
+               engine state itself is restored by the extended module. */
+            resources_get_int("SidStereo", &cur_sids);
+            resources_get_int("Sound", &cur_sound);
+            resources_get_int("SidEngine", &cur_engine);
+            sound_reopen = (sids != cur_sids || tmp[0] != cur_sound
+                            || tmp[1] != cur_engine);
 
             intended_sid_engine = tmp[1];
-            set_sid_engine_with_fallback(tmp[1]);
+            if (sound_reopen) {
+                resources_set_int("SidStereo", sids);
+                screenshot_prepare_reopen();
+                sound_close();
+                screenshot_try_reopen();
+                resources_set_int("Sound", (int)tmp[0]);
+
+                set_sid_engine_with_fallback(tmp[1]);
+            }
         } else {
             if (SMR_W_INT(m, &sid_address) < 0) {
                 goto fail;
             }
         }
-        if (sidnr == 1) {
-            resources_set_int("SidStereoAddressStart", sid_address);
-        }
-        if (sidnr == 2) {
-            resources_set_int("SidTripleAddressStart", sid_address);
+        if (sidnr) {
+            const char *address_resource = (sidnr == 1)
+                                           ? "SidStereoAddressStart"
+                                           : "SidTripleAddressStart";
+            int cur_address;
+
+            resources_get_int(address_resource, &cur_address);
+            if (sound_reopen || sid_address != cur_address) {
+                resources_set_int(address_resource, sid_address);
+            }
         }
         if (SMR_BA(m, tmp + 2, 32) < 0) {
             goto fail;
         }
         memcpy(sid_get_siddata(sidnr), &tmp[2], 32);
-        sound_open();
+        if (sound_reopen) {
+            sound_open();
+        }
         return snapshot_module_close(m);
     }
 
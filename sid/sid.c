@@ -536,6 +536,14 @@ char *sid_sound_machine_dump_state(sound_t *psid)
     return sid_engine.dump_state(psid);
 }
 
+/* Fine-tune the output rate of the running engine, if it supports it.  */
+void sid_sound_machine_adjust_sampling_frequency(sound_t *psid, double sample_freq)
+{
+    if (sid_engine.adjust_sampling_frequency) {
+        sid_engine.adjust_sampling_frequency(psid, sample_freq);
+    }
+}
+
 int sid_sound_machine_cycle_based(void)
 {
     switch (sidengine) {
@@ -110,6 +110,8 @@ struct sid_engine_s {
                        struct sid_snapshot_state_s *sid_state);
     void (*state_write)(struct sound_s *psid,
                         struct sid_snapshot_state_s *sid_state);
+    void (*adjust_sampling_frequency)(struct sound_s *psid,
+                                      double sample_freq);
 };
 typedef struct sid_engine_s sid_engine_t;
 
@@ -131,6 +133,7 @@ extern void sid_sound_machine_prevent_clk_overflow(sound_t *psid, CLOCK sub);
 extern char *sid_sound_machine_dump_state(sound_t *psid);
 extern int sid_sound_machine_cycle_based(void);
 extern int sid_sound_machine_channels(void);
+extern void sid_sound_machine_adjust_sampling_frequency(sound_t *psid, double sample_freq);
 extern void sid_sound_machine_enable(int enable);
 extern sid_engine_model_t **sid_get_engine_model_list(void);
 extern int sid_set_engine_model(int engine, int model);
@@ -58,10 +58,28 @@ char snapshot_version_magic_string[] = "VICE Version\032";
 #define SNAPSHOT_MAGIC_LEN              19
 #define SNAPSHOT_VERSION_MAGIC_LEN      13
 
-struct snapshot_module_s {
-    /* File descriptor.  */
+struct snapshot_stream_s {
+    /* File descriptor, NULL for memory streams.  */
     FILE *file;
 
+    /* Flag: was the file opened through zfile?  */
+    int zfile;
+
+    /* Memory buffer, length of valid data, allocated size and current
+       position.  */
+    uint8_t *buffer;
+    size_t size;
+    size_t allocated;
+    size_t pos;
+
+    /* Flag: is this a memory stream we are writing (and own)?  */
+    int write_mode;
+};
+
+struct snapshot_module_s {
+    /* Stream.  */
+    snapshot_stream_t *file;
+
     /* Flag: are we writing it?  */
     int write_mode;
 
@@ -76,21 +94,110 @@ struct snapshot_module_s {
 };
 
 struct snapshot_s {
-    /* File descriptor.  */
-    FILE *file;
+    /* Stream.  */
+    snapshot_stream_t *file;
 
     /* Offset of the first module.  */
     long first_module_offset;
 
     /* Flag: are we writing it?  */
     int write_mode;
+
+    /* Flag: was the stream opened by us (and must be closed by us)?  */
+    int own_stream;
 };
 
 /* ------------------------------------------------------------------------- */
 
-static int snapshot_write_byte(FILE *f, uint8_t data)
+/* Low level stream access.  Memory streams copy straight into and out of
+   the buffer; file streams fall back to stdio.  */
+
+static int snapshot_stream_reserve(snapshot_stream_t *f, size_t num)
+{
+    size_t needed = f->pos + num;
+    size_t new_size;
+
+    if (needed <= f->allocated) {
+        return 0;
+    }
+
+    if (!f->write_mode) {
+        return -1;
+    }
+
+    new_size = f->allocated ? f->allocated : 0x1000;
+    while (new_size < needed) {
+        new_size <<= 1;
+    }
+
+    f->buffer = lib_realloc(f->buffer, new_size);
+    f->allocated = new_size;
+
+    return 0;
+}
+
+/* Return a pointer to `num' bytes at the current position of a memory
+   stream and advance past them, or NULL if they are not available.  */
+static uint8_t *snapshot_stream_advance(snapshot_stream_t *f, size_t num, int writing)
 {
-    if (fputc(data, f) == EOF) {
+    uint8_t *p;
+
+    if (writing) {
+        if (snapshot_stream_reserve(f, num) < 0) {
+            return NULL;
+        }
+    } else if (f->pos + num > f->size) {
+        return NULL;
+    }
+
+    p = f->buffer + f->pos;
+    f->pos += num;
+    if (f->pos > f->size) {
+        f->size = f->pos;
+    }
+
+    return p;
+}
+
+static long snapshot_stream_tell(snapshot_stream_t *f)
+{
+    if (f->file != NULL) {
+        return ftell(f->file);
+    }
+
+    return (long)f->pos;
+}
+
+static int snapshot_stream_seek(snapshot_stream_t *f, long offset)
+{
+    if (f->file != NULL) {
+        return fseek(f->file, offset, SEEK_SET);
+    }
+
+    if (offset < 0 || (size_t)offset > (f->write_mode ? f->allocated : f->size)) {
+        return -1;
+    }
+
+    f->pos = (size_t)offset;
+    return 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int snapshot_write_byte(snapshot_stream_t *f, uint8_t data)
+{
+    if (f->file == NULL) {
+        uint8_t *p = snapshot_stream_advance(f, 1, 1);
+
+        if (p == NULL) {
+            snapshot_error = SNAPSHOT_WRITE_EOF_ERROR;
+            return -1;
+        }
+        *p = data;
+        return 0;
+    }
+
+    if (fputc(data, f->file) == EOF) {
         snapshot_error = SNAPSHOT_WRITE_EOF_ERROR;
         return -1;
     }
@@ -98,7 +205,7 @@ static int snapshot_write_byte(FILE *f, uint8_t data)
     return 0;
 }
 
-static int snapshot_write_word(FILE *f, uint16_t data)
+static int snapshot_write_word(snapshot_stream_t *f, uint16_t data)
 {
     if (snapshot_write_byte(f, (uint8_t)(data & 0xff)) < 0
         || snapshot_write_byte(f, (uint8_t)(data >> 8)) < 0) {
@@ -108,7 +215,7 @@ static int snapshot_write_word(FILE *f, uint16_t data)
     return 0;
 }
 
-static int snapshot_write_dword(FILE *f, uint32_t data)
+static int snapshot_write_dword(snapshot_stream_t *f, uint32_t data)
 {
     if (snapshot_write_word(f, (uint16_t)(data & 0xffff)) < 0
         || snapshot_write_word(f, (uint16_t)(data >> 16)) < 0) {
@@ -118,7 +225,7 @@ static int snapshot_write_dword(FILE *f, uint32_t data)
     return 0;
 }
 
-static int snapshot_write_double(FILE *f, double data)
+static int snapshot_write_double(snapshot_stream_t *f, double data)
 {
     uint8_t *byte_data = (uint8_t *)&data;
     int i;
@@ -131,7 +238,7 @@ static int snapshot_write_double(FILE *f, double data)
     return 0;
 }
 
-static int snapshot_write_padded_string(FILE *f, const char *s, uint8_t pad_char,
+static int snapshot_write_padded_string(snapshot_stream_t *f, const char *s, uint8_t pad_char,
                                         int len)
 {
     int i, found_zero;
@@ -150,9 +257,24 @@ static int snapshot_write_padded_string(FILE *f, const char *s, uint8_t pad_char
     return 0;
 }
 
-static int snapshot_write_byte_array(FILE *f, const uint8_t *data, unsigned int num)
+static int snapshot_write_byte_array(snapshot_stream_t *f, const uint8_t *data, unsigned int num)
 {
-    if (num > 0 && fwrite(data, (size_t)num, 1, f) < 1) {
+    if (num == 0) {
+        return 0;
+    }
+
+    if (f->file == NULL) {
+        uint8_t *p = snapshot_stream_advance(f, (size_t)num, 1);
+
+        if (p == NULL) {
+            snapshot_error = SNAPSHOT_WRITE_BYTE_ARRAY_ERROR;
+            return -1;
+        }
+        memcpy(p, data, (size_t)num);
+        return 0;
+    }
+
+    if (fwrite(data, (size_t)num, 1, f->file) < 1) {
         snapshot_error = SNAPSHOT_WRITE_BYTE_ARRAY_ERROR;
         return -1;
     }
@@ -160,10 +282,24 @@ static int snapshot_write_byte_array(FILE *f, const uint8_t *data, unsigned int
     return 0;
 }
 
-static int snapshot_write_word_array(FILE *f, const uint16_t *data, unsigned int num)
+static int snapshot_write_word_array(snapshot_stream_t *f, const uint16_t *data, unsigned int num)
 {
     unsigned int i;
 
+    if (f->file == NULL) {
+        uint8_t *p = snapshot_stream_advance(f, (size_t)num * 2, 1);
+
+        if (p == NULL) {
+            snapshot_error = SNAPSHOT_WRITE_BYTE_ARRAY_ERROR;
+            return -1;
+        }
+        for (i = 0; i < num; i++) {
+            *p++ = (uint8_t)(data[i] & 0xff);
+            *p++ = (uint8_t)(data[i] >> 8);
+        }
+        return 0;
+    }
+
     for (i = 0; i < num; i++) {
         if (snapshot_write_word(f, data[i]) < 0) {
             return -1;
@@ -173,10 +309,26 @@ static int snapshot_write_word_array(FILE *f, const uint16_t *data, unsigned int
     return 0;
 }
 
-static int snapshot_write_dword_array(FILE *f, const uint32_t *data, unsigned int num)
+static int snapshot_write_dword_array(snapshot_stream_t *f, const uint32_t *data, unsigned int num)
 {
     unsigned int i;
 
+    if (f->file == NULL) {
+        uint8_t *p = snapshot_stream_advance(f, (size_t)num * 4, 1);
+
+        if (p == NULL) {
+            snapshot_error = SNAPSHOT_WRITE_BYTE_ARRAY_ERROR;
+            return -1;
+        }
+        for (i = 0; i < num; i++) {
+            *p++ = (uint8_t)(data[i] & 0xff);
+            *p++ = (uint8_t)((data[i] >> 8) & 0xff);
+            *p++ = (uint8_t)((data[i] >> 16) & 0xff);
+            *p++ = (uint8_t)(data[i] >> 24);
+        }
+        return 0;
+    }
+
     for (i = 0; i < num; i++) {
         if (snapshot_write_dword(f, data[i]) < 0) {
             return -1;
@@ -187,9 +339,9 @@ static int snapshot_write_dword_array(FILE *f, const uint32_t *data, unsigned in
 }
 
 
-static int snapshot_write_string(FILE *f, const char *s)
+static int snapshot_write_string(snapshot_stream_t *f, const char *s)
 {
-    size_t len, i;
+    size_t len;
 
     len = s ? (strlen(s) + 1) : 0;      /* length includes nullbyte */
 
@@ -197,20 +349,30 @@ static int snapshot_write_string(FILE *f, const char *s)
         return -1;
     }
 
-    for (i = 0; i < len; i++) {
-        if (snapshot_write_byte(f, s[i]) < 0) {
-            return -1;
-        }
+    if (snapshot_write_byte_array(f, (const uint8_t *)s, (unsigned int)len) < 0) {
+        snapshot_error = SNAPSHOT_WRITE_EOF_ERROR;
+        return -1;
     }
 
     return (int)(len + sizeof(uint16_t));
 }
 
-static int snapshot_read_byte(FILE *f, uint8_t *b_return)
+static int snapshot_read_byte(snapshot_stream_t *f, uint8_t *b_return)
 {
     int c;
 
-    c = fgetc(f);
+    if (f->file == NULL) {
+        uint8_t *p = snapshot_stream_advance(f, 1, 0);
+
+        if (p == NULL) {
+            snapshot_error = SNAPSHOT_READ_EOF_ERROR;
+            return -1;
+        }
+        *b_return = *p;
+        return 0;
+    }
+
+    c = fgetc(f->file);
     if (c == EOF) {
         snapshot_error = SNAPSHOT_READ_EOF_ERROR;
         return -1;
@@ -219,7 +381,7 @@ static int snapshot_read_byte(FILE *f, uint8_t *b_return)
     return 0;
 }
 
-static int snapshot_read_word(FILE *f, uint16_t *w_return)
+static int snapshot_read_word(snapshot_stream_t *f, uint16_t *w_return)
 {
     uint8_t lo, hi;
 
@@ -231,7 +393,7 @@ static int snapshot_read_word(FILE *f, uint16_t *w_return)
     return 0;
 }
 
-static int snapshot_read_dword(FILE *f, uint32_t *dw_return)
+static int snapshot_read_dword(snapshot_stream_t *f, uint32_t *dw_return)
 {
     uint16_t lo, hi;
 
@@ -243,28 +405,39 @@ static int snapshot_read_dword(FILE *f, uint32_t *dw_return)
     return 0;
 }
 
-static int snapshot_read_double(FILE *f, double *d_return)
+static int snapshot_read_double(snapshot_stream_t *f, double *d_return)
 {
     int i;
-    int c;
     double val;
     uint8_t *byte_val = (uint8_t *)&val;
 
     for (i = 0; i < sizeof(double); i++) {
-        c = fgetc(f);
-        if (c == EOF) {
-            snapshot_error = SNAPSHOT_READ_EOF_ERROR;
+        if (snapshot_read_byte(f, &byte_val[i]) < 0) {
             return -1;
         }
-        byte_val[i] = (uint8_t)c;
     }
     *d_return = val;
     return 0;
 }
 
-static int snapshot_read_byte_array(FILE *f, uint8_t *b_return, unsigned int num)
+static int snapshot_read_byte_array(snapshot_stream_t *f, uint8_t *b_return, unsigned int num)
 {
-    if (num > 0 && fread(b_return, (size_t)num, 1, f) < 1) {
+    if (num == 0) {
+        return 0;
+    }
+
+    if (f->file == NULL) {
+        uint8_t *p = snapshot_stream_advance(f, (size_t)num, 0);
+
+        if (p == NULL) {
+            snapshot_error = SNAPSHOT_READ_BYTE_ARRAY_ERROR;
+            return -1;
+        }
+        memcpy(b_return, p, (size_t)num);
+        return 0;
+    }
+
+    if (fread(b_return, (size_t)num, 1, f->file) < 1) {
         snapshot_error = SNAPSHOT_READ_BYTE_ARRAY_ERROR;
         return -1;
     }
@@ -272,10 +445,23 @@ static int snapshot_read_byte_array(FILE *f, uint8_t *b_return, unsigned int num
     return 0;
 }
 
-static int snapshot_read_word_array(FILE *f, uint16_t *w_return, unsigned int num)
+static int snapshot_read_word_array(snapshot_stream_t *f, uint16_t *w_return, unsigned int num)
 {
     unsigned int i;
 
+    if (f->file == NULL) {
+        uint8_t *p = snapshot_stream_advance(f, (size_t)num * 2, 0);
+
+        if (p == NULL) {
+            snapshot_error = SNAPSHOT_READ_BYTE_ARRAY_ERROR;
+            return -1;
+        }
+        for (i = 0; i < num; i++, p += 2) {
+            w_return[i] = (uint16_t)(p[0] | (p[1] << 8));
+        }
+        return 0;
+    }
+
     for (i = 0; i < num; i++) {
         if (snapshot_read_word(f, w_return + i) < 0) {
             return -1;
@@ -285,10 +471,24 @@ static int snapshot_read_word_array(FILE *f, uint16_t *w_return, unsigned int nu
     return 0;
 }
 
-static int snapshot_read_dword_array(FILE *f, uint32_t *dw_return, unsigned int num)
+static int snapshot_read_dword_array(snapshot_stream_t *f, uint32_t *dw_return, unsigned int num)
 {
     unsigned int i;
 
+    if (f->file == NULL) {
+        uint8_t *p = snapshot_stream_advance(f, (size_t)num * 4, 0);
+
+        if (p == NULL) {
+            snapshot_error = SNAPSHOT_READ_BYTE_ARRAY_ERROR;
+            return -1;
+        }
+        for (i = 0; i < num; i++, p += 4) {
+            dw_return[i] = (uint32_t)p[0] | ((uint32_t)p[1] << 8)
+                           | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+        }
+        return 0;
+    }
+
     for (i = 0; i < num; i++) {
         if (snapshot_read_dword(f, dw_return + i) < 0) {
             return -1;
@@ -298,9 +498,9 @@ static int snapshot_read_dword_array(FILE *f, uint32_t *dw_return, unsigned int
     return 0;
 }
 
-static int snapshot_read_string(FILE *f, char **s)
+static int snapshot_read_string(snapshot_stream_t *f, char **s)
 {
-    int i, len;
+    int len;
     uint16_t w;
     char *p = NULL;
 
@@ -318,11 +518,10 @@ static int snapshot_read_string(FILE *f, char **s)
         p = lib_malloc(len);
         *s = p;
 
-        for (i = 0; i < len; i++) {
-            if (snapshot_read_byte(f, (uint8_t *)(p + i)) < 0) {
-                p[0] = 0;
-                return -1;
-            }
+        if (snapshot_read_byte_array(f, (uint8_t *)p, (unsigned int)len) < 0) {
+            p[0] = 0;
+            snapshot_error = SNAPSHOT_READ_EOF_ERROR;
+            return -1;
         }
         p[len - 1] = 0;   /* just to be save */
     }
@@ -331,6 +530,87 @@ static int snapshot_read_string(FILE *f, char **s)
 
 /* ------------------------------------------------------------------------- */
 
+snapshot_stream_t *snapshot_memory_write_fopen(size_t initial_size)
+{
+    snapshot_stream_t *f;
+
+    f = lib_calloc(1, sizeof(snapshot_stream_t));
+    f->write_mode = 1;
+    if (initial_size > 0) {
+        f->buffer = lib_malloc(initial_size);
+        f->allocated = initial_size;
+    }
+
+    return f;
+}
+
+snapshot_stream_t *snapshot_memory_read_fopen(const void *buffer, size_t size)
+{
+    snapshot_stream_t *f;
+
+    f = lib_calloc(1, sizeof(snapshot_stream_t));
+    f->buffer = (uint8_t *)buffer;
+    f->size = size;
+    f->allocated = size;
+
+    return f;
+}
+
+void snapshot_memory_reset(snapshot_stream_t *f)
+{
+    f->pos = 0;
+    if (f->write_mode) {
+        f->size = 0;
+    }
+}
+
+const void *snapshot_memory_get_buffer(snapshot_stream_t *f, size_t *size_return)
+{
+    if (size_return != NULL) {
+        *size_return = f->size;
+    }
+    return f->buffer;
+}
+
+void snapshot_fclose(snapshot_stream_t *f)
+{
+    if (f == NULL) {
+        return;
+    }
+
+    if (f->write_mode) {
+        lib_free(f->buffer);
+    }
+    lib_free(f);
+}
+
+static snapshot_stream_t *snapshot_file_fopen(FILE *file, int zfile)
+{
+    snapshot_stream_t *f;
+
+    f = lib_calloc(1, sizeof(snapshot_stream_t));
+    f->file = file;
+    f->zfile = zfile;
+
+    return f;
+}
+
+static int snapshot_file_fclose(snapshot_stream_t *f)
+{
+    int retval;
+
+    if (f->zfile) {
+        retval = zfile_fclose(f->file);
+    } else {
+        retval = fclose(f->file);
+    }
+    lib_free(f);
+
+    return retval;
+}
+
+/* ------------------------------------------------------------------------- */
+
 int snapshot_module_write_byte(snapshot_module_t *m, uint8_t b)
 {
     if (snapshot_write_byte(m->file, b) < 0) {
@@ -428,7 +708,7 @@ int snapshot_module_write_string(snapshot_module_t *m, const char *s)
 
 int snapshot_module_read_byte(snapshot_module_t *m, uint8_t *b_return)
 {
-    if (ftell(m->file) + sizeof(uint8_t) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(uint8_t) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -438,7 +718,7 @@ int snapshot_module_read_byte(snapshot_module_t *m, uint8_t *b_return)
 
 int snapshot_module_read_word(snapshot_module_t *m, uint16_t *w_return)
 {
-    if (ftell(m->file) + sizeof(uint16_t) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(uint16_t) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -448,7 +728,7 @@ int snapshot_module_read_word(snapshot_module_t *m, uint16_t *w_return)
 
 int snapshot_module_read_dword(snapshot_module_t *m, uint32_t *dw_return)
 {
-    if (ftell(m->file) + sizeof(uint32_t) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(uint32_t) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -458,7 +738,7 @@ int snapshot_module_read_dword(snapshot_module_t *m, uint32_t *dw_return)
 
 int snapshot_module_read_double(snapshot_module_t *m, double *db_return)
 {
-    if (ftell(m->file) + sizeof(double) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(double) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -468,7 +748,7 @@ int snapshot_module_read_double(snapshot_module_t *m, double *db_return)
 
 int snapshot_module_read_byte_array(snapshot_module_t *m, uint8_t *b_return, unsigned int num)
 {
-    if ((long)(ftell(m->file) + num) > (long)(m->offset + m->size)) {
+    if ((long)(snapshot_stream_tell(m->file) + num) > (long)(m->offset + m->size)) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -478,7 +758,7 @@ int snapshot_module_read_byte_array(snapshot_module_t *m, uint8_t *b_return, uns
 
 int snapshot_module_read_word_array(snapshot_module_t *m, uint16_t *w_return, unsigned int num)
 {
-    if ((long)(ftell(m->file) + num * sizeof(uint16_t)) > (long)(m->offset + m->size)) {
+    if ((long)(snapshot_stream_tell(m->file) + num * sizeof(uint16_t)) > (long)(m->offset + m->size)) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -488,7 +768,7 @@ int snapshot_module_read_word_array(snapshot_module_t *m, uint16_t *w_return, un
 
 int snapshot_module_read_dword_array(snapshot_module_t *m, uint32_t *dw_return, unsigned int num)
 {
-    if ((long)(ftell(m->file) + num * sizeof(uint32_t)) > (long)(m->offset + m->size)) {
+    if ((long)(snapshot_stream_tell(m->file) + num * sizeof(uint32_t)) > (long)(m->offset + m->size)) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -498,7 +778,7 @@ int snapshot_module_read_dword_array(snapshot_module_t *m, uint32_t *dw_return,
 
 int snapshot_module_read_string(snapshot_module_t *m, char **charp_return)
 {
-    if (ftell(m->file) + sizeof(uint16_t) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(uint16_t) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -571,7 +851,7 @@ snapshot_module_t *snapshot_module_create(snapshot_t *s, const char *name, uint8
 
     m = lib_malloc(sizeof(snapshot_module_t));
     m->file = s->file;
-    m->offset = ftell(s->file);
+    m->offset = snapshot_stream_tell(s->file);
     if (m->offset == -1) {
         snapshot_error = SNAPSHOT_ILLEGAL_OFFSET_ERROR;
         lib_free(m);
@@ -586,8 +866,8 @@ snapshot_module_t *snapshot_module_create(snapshot_t *s, const char *name, uint8
         return NULL;
     }
 
-    m->size = ftell(s->file) - m->offset;
-    m->size_offset = ftell(s->file) - sizeof(uint32_t);
+    m->size = snapshot_stream_tell(s->file) - m->offset;
+    m->size_offset = snapshot_stream_tell(s->file) - sizeof(uint32_t);
 
     return m;
 }
@@ -600,7 +880,7 @@ snapshot_module_t *snapshot_module_open(snapshot_t *s, const char *name, uint8_t
 
     current_module = (char *)name;
 
-    if (fseek(s->file, s->first_module_offset, SEEK_SET) < 0) {
+    if (snapshot_stream_seek(s->file, s->first_module_offset) < 0) {
         snapshot_error = SNAPSHOT_FIRST_MODULE_NOT_FOUND_ERROR;
         return NULL;
     }
@@ -630,18 +910,18 @@ snapshot_module_t *snapshot_module_open(snapshot_t *s, const char *name, uint8_t
         }
 
         m->offset += m->size;
-        if (fseek(s->file, m->offset, SEEK_SET) < 0) {
+        if (snapshot_stream_seek(s->file, m->offset) < 0) {
             snapshot_error = SNAPSHOT_MODULE_NOT_FOUND_ERROR;
             goto fail;
         }
     }
 
-    m->size_offset = ftell(s->file) - sizeof(uint32_t);
+    m->size_offset = snapshot_stream_tell(s->file) - sizeof(uint32_t);
 
     return m;
 
 fail:
-    fseek(s->file, s->first_module_offset, SEEK_SET);
+    snapshot_stream_seek(s->file, s->first_module_offset);
     lib_free(m);
     return NULL;
 }
@@ -650,14 +930,14 @@ int snapshot_module_close(snapshot_module_t *m)
 {
     /* Backpatch module size if writing.  */
     if (m->write_mode
-        && (fseek(m->file, m->size_offset, SEEK_SET) < 0
+        && (snapshot_stream_seek(m->file, m->size_offset) < 0
             || snapshot_write_dword(m->file, m->size) < 0)) {
         snapshot_error = SNAPSHOT_MODULE_CLOSE_ERROR;
         return -1;
     }
 
     /* Skip module.  */
-    if (fseek(m->file, m->offset + m->size, SEEK_SET) < 0) {
+    if (snapshot_stream_seek(m->file, m->offset + m->size) < 0) {
         snapshot_error = SNAPSHOT_MODULE_SKIP_ERROR;
         return -1;
     }
@@ -668,28 +948,11 @@ int snapshot_module_close(snapshot_module_t *m)
 
 /* ------------------------------------------------------------------------- */
 
-snapshot_t *snapshot_create(const char *filename, uint8_t major_version, uint8_t minor_version, const char *snapshot_machine_name)
+static snapshot_t *snapshot_create_internal(snapshot_stream_t *f, uint8_t major_version, uint8_t minor_version, const char *snapshot_machine_name)
 {
-    FILE *f;
     snapshot_t *s;
     unsigned char viceversion[4] = { VERSION_RC_NUMBER };
 
-    current_filename = (char *)filename;
-
-#ifdef PSP
-    /* HACK: if it's a filename, fail */
-    if (strncasecmp(filename, "ms0", 3) == 0 || strncasecmp(filename, "umd0", 4) == 0)
-        return NULL;
-    f = (FILE*)filename;
-#else
-    f = fopen(filename, MODE_WRITE);
-#endif
-
-    if (f == NULL) {
-        snapshot_error = SNAPSHOT_CANNOT_CREATE_SNAPSHOT_ERROR;
-        return NULL;
-    }
-
     /* Magic string.  */
     if (snapshot_write_padded_string(f, snapshot_magic_string, (uint8_t)0, SNAPSHOT_MAGIC_LEN) < 0) {
         snapshot_error = SNAPSHOT_CANNOT_WRITE_MAGIC_STRING_ERROR;
@@ -730,47 +993,69 @@ snapshot_t *snapshot_create(const char *filename, uint8_t major_version, uint8_t
 
     s = lib_malloc(sizeof(snapshot_t));
     s->file = f;
-    s->first_module_offset = ftell(f);
+    s->first_module_offset = snapshot_stream_tell(f);
     s->write_mode = 1;
+    s->own_stream = 0;
 
     return s;
 
 fail:
-    fclose(f);
-    ioutil_remove(filename);
     return NULL;
 }
 
+snapshot_t *snapshot_create(const char *filename, uint8_t major_version, uint8_t minor_version, const char *snapshot_machine_name)
+{
+    FILE *file;
+    snapshot_stream_t *f;
+    snapshot_t *s;
+
+    current_filename = (char *)filename;
+
+    file = fopen(filename, MODE_WRITE);
+
+    if (file == NULL) {
+        snapshot_error = SNAPSHOT_CANNOT_CREATE_SNAPSHOT_ERROR;
+        return NULL;
+    }
+
+    f = snapshot_file_fopen(file, 0);
+    s = snapshot_create_internal(f, major_version, minor_version, snapshot_machine_name);
+    if (s == NULL) {
+        snapshot_file_fclose(f);
+        ioutil_remove(filename);
+        return NULL;
+    }
+
+    s->own_stream = 1;
+    return s;
+}
+
+snapshot_t *snapshot_create_stream(snapshot_stream_t *f, uint8_t major_version, uint8_t minor_version, const char *snapshot_machine_name)
+{
+    current_filename = "(memory)";
+
+    if (f == NULL) {
+        snapshot_error = SNAPSHOT_CANNOT_CREATE_SNAPSHOT_ERROR;
+        return NULL;
+    }
+
+    return snapshot_create_internal(f, major_version, minor_version, snapshot_machine_name);
+}
+
 /* informal only, used by the error message created below */
 static unsigned char snapshot_viceversion[4];
 static uint32_t snapshot_vicerevision;
 
-snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, uint8_t *minor_version_return, const char *snapshot_machine_name)
+static snapshot_t *snapshot_open_internal(snapshot_stream_t *f, uint8_t *major_version_return, uint8_t *minor_version_return, const char *snapshot_machine_name)
 {
-    FILE *f;
     char magic[SNAPSHOT_MAGIC_LEN];
     snapshot_t *s = NULL;
     int machine_name_len;
-    size_t offs;
+    long offs;
 
     current_machine_name = (char *)snapshot_machine_name;
-    current_filename = (char *)filename;
     current_module = NULL;
 
-#ifdef PSP
-    /* HACK: if it's a filename, fail.. */
-    if (strncasecmp(filename, "ms0", 3) == 0 || strncasecmp(filename, "umd0", 4) == 0)
-        return NULL;
-    f = (FILE*)filename;
-#else
-    f = zfile_fopen(filename, MODE_READ);
-#endif
-
-    if (f == NULL) {
-        snapshot_error = SNAPSHOT_CANNOT_OPEN_FOR_READ_ERROR;
-        return NULL;
-    }
-
     /* Magic string.  */
     if (snapshot_read_byte_array(f, (uint8_t *)magic, SNAPSHOT_MAGIC_LEN) < 0
         || memcmp(magic, snapshot_magic_string, SNAPSHOT_MAGIC_LEN) != 0) {
@@ -803,12 +1088,12 @@ snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, u
     /* VICE version and revision */
     memset(snapshot_viceversion, 0, 4);
     snapshot_vicerevision = 0;
-    offs = ftell(f);
+    offs = snapshot_stream_tell(f);
 
     if (snapshot_read_byte_array(f, (uint8_t *)magic, SNAPSHOT_VERSION_MAGIC_LEN) < 0
         || memcmp(magic, snapshot_version_magic_string, SNAPSHOT_VERSION_MAGIC_LEN) != 0) {
         /* old snapshots do not contain VICE version */
-        fseek(f, offs, SEEK_SET);
+        snapshot_stream_seek(f, offs);
         log_warning(LOG_DEFAULT, "attempting to load pre 2.4.30 snapshot");
     } else {
         /* actually read the version */
@@ -824,41 +1109,67 @@ snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, u
 
     s = lib_malloc(sizeof(snapshot_t));
     s->file = f;
-    s->first_module_offset = ftell(f);
+    s->first_module_offset = snapshot_stream_tell(f);
     s->write_mode = 0;
+    s->own_stream = 0;
 
-    vsync_suspend_speed_eval();
     return s;
 
 fail:
-    fclose(f);
     return NULL;
 }
 
-int snapshot_close(snapshot_t *s)
+snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, uint8_t *minor_version_return, const char *snapshot_machine_name)
 {
-    int retval;
+    FILE *file;
+    snapshot_stream_t *f;
+    snapshot_t *s;
 
-#ifdef PSP
-    retval = 0;
-#else
+    current_filename = (char *)filename;
 
-    if (!s->write_mode) {
-        if (zfile_fclose(s->file) == EOF) {
-            snapshot_error = SNAPSHOT_READ_CLOSE_EOF_ERROR;
-            retval = -1;
-        } else {
-            retval = 0;
-        }
-    } else {
-        if (fclose(s->file) == EOF) {
-            snapshot_error = SNAPSHOT_WRITE_CLOSE_EOF_ERROR;
-            retval = -1;
-        } else {
-            retval = 0;
-        }
+    file = zfile_fopen(filename, MODE_READ);
+
+    if (file == NULL) {
+        snapshot_error = SNAPSHOT_CANNOT_OPEN_FOR_READ_ERROR;
+        return NULL;
     }
-#endif
+
+    f = snapshot_file_fopen(file, 1);
+    s = snapshot_open_internal(f, major_version_return, minor_version_return, snapshot_machine_name);
+    if (s == NULL) {
+        snapshot_file_fclose(f);
+        return NULL;
+    }
+
+    s->own_stream = 1;
+    vsync_suspend_speed_eval();
+    return s;
+}
+
+snapshot_t *snapshot_open_stream(snapshot_stream_t *f, uint8_t *major_version_return, uint8_t *minor_version_return, const char *snapshot_machine_name)
+{
+    current_filename = "(memory)";
+
+    if (f == NULL) {
+        snapshot_error = SNAPSHOT_CANNOT_OPEN_FOR_READ_ERROR;
+        return NULL;
+    }
+
+    /* Memory snapshots are taken and restored while running (rewind,
+       quicksave), so leave the speed evaluation alone.  */
+    return snapshot_open_internal(f, major_version_return, minor_version_return, snapshot_machine_name);
+}
+
+int snapshot_close(snapshot_t *s)
+{
+    int retval = 0;
+
+    if (s->own_stream && snapshot_file_fclose(s->file) == EOF) {
+        snapshot_error = s->write_mode ? SNAPSHOT_WRITE_CLOSE_EOF_ERROR
+                                       : SNAPSHOT_READ_CLOSE_EOF_ERROR;
+        retval = -1;
+    }
+
     lib_free(s);
     return retval;
 }
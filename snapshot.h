@@ -28,6 +28,8 @@
 #ifndef SNAPSHOT_H
 #define SNAPSHOT_H
 
+#include <stddef.h>
+
 #include "types.h"
 
 #define SNAPSHOT_MACHINE_NAME_LEN       16
@@ -62,6 +64,7 @@
 
 typedef struct snapshot_module_s snapshot_module_t;
 typedef struct snapshot_s snapshot_t;
+typedef struct snapshot_stream_s snapshot_stream_t;
 
 extern void snapshot_display_error(void);
 
@@ -145,6 +148,27 @@ extern snapshot_t *snapshot_open(const char *filename,
                                  const char *snapshot_machine_name);
 extern int snapshot_close(snapshot_t *s);
 
+/* Memory snapshots.  A write stream owns a buffer that grows as needed and
+   can be reused with `snapshot_memory_reset()'; a read stream reads from
+   a buffer owned by the caller.  Streams are not closed by
+   `snapshot_close()'.  */
+extern snapshot_stream_t *snapshot_memory_write_fopen(size_t initial_size);
+extern snapshot_stream_t *snapshot_memory_read_fopen(const void *buffer,
+                                                     size_t size);
+extern void snapshot_memory_reset(snapshot_stream_t *f);
+extern const void *snapshot_memory_get_buffer(snapshot_stream_t *f,
+                                              size_t *size_return);
+extern void snapshot_fclose(snapshot_stream_t *f);
+
+extern snapshot_t *snapshot_create_stream(snapshot_stream_t *f,
+                                          uint8_t major_version,
+                                          uint8_t minor_version,
+                                          const char *snapshot_machine_name);
+extern snapshot_t *snapshot_open_stream(snapshot_stream_t *f,
+                                        uint8_t *major_version_return,
+                                        uint8_t *minor_version_return,
+                                        const char *snapshot_machine_name);
+
 extern void snapshot_set_error(int error);
 
 extern int snapshot_version_at_least(uint8_t major_version, uint8_t minor_version, uint8_t major_version_required, uint8_t minor_version_required);
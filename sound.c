@@ -50,6 +50,7 @@
 #include "machine.h"
 #include "maincpu.h"
 #include "monitor.h"
+#include "profile.h"
 #include "resources.h"
 #include "sound.h"
 #include "translate.h"
@@ -310,6 +311,17 @@ static int sound_machine_cycle_based(void)
     return retval;
 }
 
+static void sound_machine_adjust_sampling_frequency(sound_t *psid, double sample_freq)
+{
+    int i;
+
+    for (i = 0; i < (offset >> 5); i++) {
+        if (sound_calls[i]->adjust_sampling_frequency) {
+            sound_calls[i]->adjust_sampling_frequency(psid, sample_freq);
+        }
+    }
+}
+
 static int sound_machine_channels(void)
 {
     int i;
@@ -495,20 +507,26 @@ static int set_suspend_time(int val, void *param)
 
 static int set_speed_adjustment_setting(int val, void *param)
 {
-    if (val == SOUND_ADJUST_DEFAULT) {
-        speed_adjustment_setting = SOUND_ADJUST_EXACT;
-    } else {
-        switch (val) {
-            case SOUND_ADJUST_FLEXIBLE:
-            case SOUND_ADJUST_ADJUSTING:
-            case SOUND_ADJUST_EXACT:
-                break;
-            default:
-                return -1;
-        }
-        speed_adjustment_setting = val;
+    switch (val) {
+        case SOUND_ADJUST_DEFAULT:
+            val = SOUND_ADJUST_EXACT;
+            break;
+        case SOUND_ADJUST_FLEXIBLE:
+        case SOUND_ADJUST_ADJUSTING:
+        case SOUND_ADJUST_EXACT:
+        case SOUND_ADJUST_DYNAMIC:
+            break;
+        default:
+            return -1;
     }
 
+    if (val != speed_adjustment_setting) {
+        /* re-init the sid engine so a dynamic rate correction is dropped
+           and the nominal sampling rate is applied again */
+        sid_state_changed = TRUE;
+    }
+    speed_adjustment_setting = val;
+
     return 0;
 }
 
@@ -772,6 +790,9 @@ typedef struct {
     int prevused;
     int prevfill;
 
+    /* relative sample rate correction used by SOUND_ADJUST_DYNAMIC */
+    double rate_adjust;
+
     /* is the device suspended? */
     int issuspended;
     int16_t lastsample[SOUND_CHANNELS_MAX];
@@ -951,6 +972,7 @@ static int sid_init(void)
     snddata.fclk = SOUNDCLK_CONSTANT(maincpu_clk);
     snddata.wclk = maincpu_clk;
     snddata.lastclk = maincpu_clk;
+    snddata.rate_adjust = 0.0;
 
     return 0;
 }
@@ -1292,6 +1314,8 @@ static int sound_run_sound(void)
         }
     }
 
+    PROFILE_ADD(PROFILE_SID_SAMPLES, nr);
+
     snddata.bufptr += nr;
     snddata.lastclk = maincpu_clk;
 
@@ -1328,6 +1352,42 @@ static void prevent_clk_overflow_callback(CLOCK sub, void *data)
     }
 }
 
+/* Dynamic rate control: keep the device buffer about half full by nudging
+   the output sample rate instead of sleeping or dropping samples, so small
+   buffers can be used without drift corrections being audible.  */
+#define SOUND_DYNAMIC_GAIN          0.02
+#define SOUND_DYNAMIC_MAX_ADJUST    0.005
+
+static void sound_dynamic_rate_control(int fill)
+{
+    double target, factor;
+    int c, speed_factor;
+
+    target = SOUND_DYNAMIC_GAIN * (fill - snddata.bufsize / 2) / snddata.bufsize;
+    if (target > SOUND_DYNAMIC_MAX_ADJUST) {
+        target = SOUND_DYNAMIC_MAX_ADJUST;
+    } else if (target < -SOUND_DYNAMIC_MAX_ADJUST) {
+        target = -SOUND_DYNAMIC_MAX_ADJUST;
+    }
+    snddata.rate_adjust += (target - snddata.rate_adjust) / 8;
+
+    speed_factor = speed_percent ? speed_percent : 100;
+    factor = speed_factor / 100.0;
+
+    if (cycle_based) {
+        /* the engine resamples itself; a lower output rate means fewer
+           samples per emulated second */
+        for (c = 0; c < snddata.sound_chip_channels; c++) {
+            sound_machine_adjust_sampling_frequency(snddata.psid[c],
+                (sample_rate * 100.0 / speed_factor) / (1.0 + snddata.rate_adjust));
+        }
+    } else {
+        /* more clocks per sample means fewer samples */
+        factor *= 1.0 + snddata.rate_adjust;
+    }
+    snddata.clkfactor = SOUNDCLK_CONSTANT(factor);
+}
+
 /* flush all generated samples from buffer to sounddevice. adjust sid runspeed
    to match real running speed of program */
 #ifdef __MSDOS__
@@ -1439,7 +1499,9 @@ double sound_flush()
             }
             vsync_sync_reset();
         }
-        if (cycle_based || speed_adjustment_setting != SOUND_ADJUST_ADJUSTING) {
+        if (speed_adjustment_setting == SOUND_ADJUST_DYNAMIC) {
+            sound_dynamic_rate_control(used + nr);
+        } else if (cycle_based || speed_adjustment_setting != SOUND_ADJUST_ADJUSTING) {
             if (speed_percent > 0) {
                 snddata.clkfactor = SOUNDCLK_CONSTANT(speed_percent) / 100;
             }
@@ -1457,6 +1519,7 @@ double sound_flush()
         snddata.prevfill = 0;
 
         if (!cycle_based && speed_adjustment_setting != SOUND_ADJUST_EXACT
+            && speed_adjustment_setting != SOUND_ADJUST_DYNAMIC
             && snddata.recdev == NULL) {
             snddata.clkfactor = SOUNDCLK_MULT(snddata.clkfactor,
                                               SOUNDCLK_CONSTANT(0.9)
@@ -1514,6 +1577,7 @@ double sound_flush()
     }
 
     if (snddata.playdev->bufferspace
+        && speed_adjustment_setting != SOUND_ADJUST_DYNAMIC
         && (cycle_based || speed_adjustment_setting == SOUND_ADJUST_EXACT))
 #ifdef __MSDOS__
     {
@@ -1717,9 +1781,31 @@ void sound_snapshot_prepare(void)
 
 void sound_snapshot_finish(void)
 {
+    /* The sound device is not reopened if the snapshot leaves the sound
+       setup unchanged; resync to the restored clock here instead.  */
+    snddata.fclk = SOUNDCLK_CONSTANT(maincpu_clk);
+    snddata.wclk = maincpu_clk;
     snddata.lastclk = maincpu_clk;
 }
 
+/* Samples generated after the mark belong to frames that are emulated
+   ahead of time and then thrown away by restoring a snapshot.  */
+static int sample_mark = -1;
+
+void sound_mark_samples(void)
+{
+    sound_run_sound();
+    sample_mark = snddata.bufptr;
+}
+
+void sound_drop_marked_samples(void)
+{
+    if (sample_mark >= 0 && sample_mark <= snddata.bufptr) {
+        snddata.bufptr = sample_mark;
+    }
+    sample_mark = -1;
+}
+
 void sound_dac_init(sound_dac_t *dac, int speed)
 {
     /* 20 dB/Decade high pass filter, cutoff at 5 Hz. For DC offset filtering. */
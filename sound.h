@@ -147,6 +147,7 @@ static inline int16_t sound_audio_mix(int ch1, int ch2)
 #define SOUND_ADJUST_FLEXIBLE   0
 #define SOUND_ADJUST_ADJUSTING  1
 #define SOUND_ADJUST_EXACT      2
+#define SOUND_ADJUST_DYNAMIC    3
 
 /* Fragment sizes */
 #define SOUND_FRAGMENT_VERY_SMALL    0
@@ -178,6 +179,10 @@ extern void sound_set_machine_parameter(long clock_rate, long ticks_per_frame);
 extern void sound_snapshot_prepare(void);
 extern void sound_snapshot_finish(void);
 
+/* run-ahead support: drop the samples generated after the mark */
+extern void sound_mark_samples(void);
+extern void sound_drop_marked_samples(void);
+
 extern int sound_resources_init(void);
 extern void sound_resources_shutdown(void);
 extern int sound_cmdline_options_init(void);
@@ -250,6 +255,7 @@ typedef struct sound_chip_s {
     int (*cycle_based)(void);
     int (*channels)(void);
     int chip_enabled;
+    void (*adjust_sampling_frequency)(sound_t *psid, double sample_freq);
 } sound_chip_t;
 
 extern uint16_t sound_chip_register(sound_chip_t *chip);
@@ -42,6 +42,9 @@
 static sfifo_t sound_fifo;
 static int sound_initted = 0;
 static int sound_rendering = 0;
+static int sound_buffer_size = 0;
+static int sound_channels = 1;
+static volatile int sound_discard = 0;
 
 static void psp_sound_callback(pl_snd_sample* stream, unsigned int samples);
 
@@ -53,10 +56,16 @@ static int psp_sound_init(const char *param, int *speed,
   *fragsize = SND_FRAG_SIZE;//(*speed)/50;
   *channels = 1;
 
-  int buffer_size = (*fragnr) * (*channels) * (*fragsize) + 1;
+  /* In bytes; the FIFO is written by the emulation thread and read by
+     the audio callback, without any locking */
+  int buffer_size = (*fragnr) * (*channels) * (*fragsize) * sizeof(SWORD);
   if (sfifo_init(&sound_fifo, buffer_size))
     return 1;
 
+  sound_buffer_size = buffer_size;
+  sound_channels = *channels;
+  sound_discard = 0;
+
   log_debug("psp_sound_init speed:%d, fragsize:%d, fragnr:%d, buffer size:%d", *speed, *fragsize, *fragnr, buffer_size);
 
   pl_snd_set_callback(psp_sound_callback);
@@ -96,6 +105,19 @@ static int psp_sound_write(SWORD *pbuf, size_t nr)
   return 0;
 }
 
+/* Free space in samples, as far as the sound core is concerned */
+static int psp_sound_bufferspace(void)
+{
+  int space = sound_buffer_size - sfifo_used(&sound_fifo);
+
+  if (sound_discard || space > sound_buffer_size)
+    space = sound_buffer_size;
+  else if (space < 0)
+    space = 0;
+
+  return space / (sound_channels * sizeof(SWORD));
+}
+
 static int psp_sound_suspend(void)
 {
   if (!sound_initted) return 0;
@@ -128,7 +150,7 @@ static sound_device_t psp_sound =
     psp_sound_write,
     NULL,
     NULL,
-    NULL,
+    psp_sound_bufferspace,
     psp_sound_close,
     psp_sound_suspend,
     psp_sound_resume,
@@ -144,7 +166,11 @@ void sound_flush_psp(void)
 {
   if (sound_initted)
   {
-    sfifo_flush(&sound_fifo);
+    /* Only the callback may move the read position while it runs */
+    if (sound_rendering)
+      sound_discard = 1;
+    else
+      sfifo_flush(&sound_fifo);
   }
 }
 
@@ -152,14 +178,21 @@ static void psp_sound_callback(pl_snd_sample* stream, unsigned int samples)
 {
   //log_debug("psp_sound_callback samples:%d", samples);
   unsigned int length = samples << 1; /* 2 bytes per sample */
-  if (sfifo_used(&sound_fifo) <= 0)
-  {
-    /* Render silence if not enough sound data */
-    memset(stream, 0, length);
-  }
-  else
+  int read = 0;
+
+  if (sound_discard)
   {
-    sfifo_read(&sound_fifo, stream, length);
+    sfifo_discard(&sound_fifo);
+    sound_discard = 0;
   }
+
+  if (sfifo_used(&sound_fifo) > 0)
+    read = sfifo_read(&sound_fifo, stream, length);
+
+  /* Pad with silence if not enough sound data */
+  if (read < 0)
+    read = 0;
+  if ((unsigned int)read < length)
+    memset((BYTE*)stream + read, 0, length - read);
 }
 
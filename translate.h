@@ -1192,6 +1192,21 @@ IDGS_MON_NEXT_DESCRIPTION_RU,
 IDGS_MON_NEXT_DESCRIPTION_SV,
 IDGS_MON_NEXT_DESCRIPTION_TR,
 
+/* monitor/mon_command.c */
+IDGS_MON_PROFILE_DESCRIPTION,
+IDGS_MON_PROFILE_DESCRIPTION_DA,
+IDGS_MON_PROFILE_DESCRIPTION_DE,
+IDGS_MON_PROFILE_DESCRIPTION_ES,
+IDGS_MON_PROFILE_DESCRIPTION_FR,
+IDGS_MON_PROFILE_DESCRIPTION_HU,
+IDGS_MON_PROFILE_DESCRIPTION_IT,
+IDGS_MON_PROFILE_DESCRIPTION_KO,
+IDGS_MON_PROFILE_DESCRIPTION_NL,
+IDGS_MON_PROFILE_DESCRIPTION_PL,
+IDGS_MON_PROFILE_DESCRIPTION_RU,
+IDGS_MON_PROFILE_DESCRIPTION_SV,
+IDGS_MON_PROFILE_DESCRIPTION_TR,
+
 /* monitor/mon_command.c */
 IDGS_REG_NAME,
 IDGS_REG_NAME_DA,
@@ -1337,6 +1337,23 @@ translate_t string_table[] = {
 /* tr */ {IDGS_MON_NEXT_DESCRIPTION_TR, "Sonraki komuta ilerle.  Altrutinler tek bir komutmu\ngibi ilendi."},
 #endif
 
+/* monitor/mon_command.c */
+/* en */ {IDGS_MON_PROFILE_DESCRIPTION,    N_("Show the profiling counters as totals and per frame and per second averages\nsince the last reset.  With `reset', clear the counters.")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDGS_MON_PROFILE_DESCRIPTION_DA, ""},  /* fuzzy */
+/* de */ {IDGS_MON_PROFILE_DESCRIPTION_DE, ""},  /* fuzzy */
+/* es */ {IDGS_MON_PROFILE_DESCRIPTION_ES, ""},  /* fuzzy */
+/* fr */ {IDGS_MON_PROFILE_DESCRIPTION_FR, ""},  /* fuzzy */
+/* hu */ {IDGS_MON_PROFILE_DESCRIPTION_HU, ""},  /* fuzzy */
+/* it */ {IDGS_MON_PROFILE_DESCRIPTION_IT, ""},  /* fuzzy */
+/* ko */ {IDGS_MON_PROFILE_DESCRIPTION_KO, ""},  /* fuzzy */
+/* nl */ {IDGS_MON_PROFILE_DESCRIPTION_NL, ""},  /* fuzzy */
+/* pl */ {IDGS_MON_PROFILE_DESCRIPTION_PL, ""},  /* fuzzy */
+/* ru */ {IDGS_MON_PROFILE_DESCRIPTION_RU, ""},  /* fuzzy */
+/* sv */ {IDGS_MON_PROFILE_DESCRIPTION_SV, ""},  /* fuzzy */
+/* tr */ {IDGS_MON_PROFILE_DESCRIPTION_TR, ""},  /* fuzzy */
+#endif
+
 /* monitor/mon_command.c */
 /* en */ {IDGS_REG_NAME,    N_("reg_name")},
 #ifdef HAS_TRANSLATION
@@ -17688,7 +17705,7 @@ translate_t string_table[] = {
 #endif
 
 /* sound.c */
-/* en */ {IDCLS_SET_SOUND_SPEED_ADJUST,    N_("Set sound speed adjustment (0: flexible, 1: adjusting, 2: exact)")},
+/* en */ {IDCLS_SET_SOUND_SPEED_ADJUST,    N_("Set sound speed adjustment (0: flexible, 1: adjusting, 2: exact, 3: dynamic)")},
 #ifdef HAS_TRANSLATION
 /* da */ {IDCLS_SET_SOUND_SPEED_ADJUST_DA, "Indstil lydjusteringshastighed (0: fleksibel, 1: justerende, 2: njagtig)"},
 /* de */ {IDCLS_SET_SOUND_SPEED_ADJUST_DE, "Setze Sound Geschwindigkeit Anpassung (0: flexibel, 1: anpassend, 2: exakt)"},
@@ -69,6 +69,13 @@ static feature_list_t featurelist[] = {
 #else
         1 },
 #endif
+/* (all) */
+    { "FEATURE_PROFILING", "Use the hot path profiling counters.",
+#ifndef FEATURE_PROFILING
+        0 },
+#else
+        1 },
+#endif
 #ifdef UNIX /* (unix) */
     { "HAS_DIGITAL_JOYSTICK", "Enable emulation for digital joysticks.",
 #ifndef HAS_DIGITAL_JOYSTICK
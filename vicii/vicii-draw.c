@@ -52,10 +52,21 @@
 /* foreground(4) | background(4) | nibble(4) -> 4 pixels.  */
 static uint32_t hr_table[16 * 16 * 16];
 
-/* mc flag(1) | idx(2) | byte(8) -> index into double-pixel table.  */
-static uint8_t mc_table[3 * 256];
 static uint8_t mcmsktable[256];
 
+/* mc nibble(4) | idx(2) -> mask for the double-pixels of color `idx'.  */
+static uint32_t mc_mask_table[16 * 4];
+
+/* Expand the multicolor nibble `n' to 4 pixels, a word at a time; `c'
+   holds the four colors replicated into every byte of a word.  */
+#define MC_NIBBLE(c, n)                                 \
+    (((c)[0] & mc_mask_table[((n) << 2)])               \
+     | ((c)[1] & mc_mask_table[((n) << 2) + 1])         \
+     | ((c)[2] & mc_mask_table[((n) << 2) + 2])         \
+     | ((c)[3] & mc_mask_table[((n) << 2) + 3]))
+
+#define MC_COLOR(c) ((uint32_t)(c) * 0x01010101)
+
 
 /* These functions draw the background from `start_pixel' to `end_pixel'.  */
 
@@ -498,38 +509,36 @@ static int get_mc_text(raster_cache_t *cache, unsigned int *xs,
 inline static void _draw_mc_text(uint8_t *p, unsigned int xs, unsigned int xe,
                                  uint8_t *gfx_msk_ptr)
 {
-    uint8_t c[8];
+    uint32_t c[4];
     uint32_t *table_ptr;
     uint8_t *char_ptr, *msk_ptr;
-    uint16_t *ptmp;
+    uint32_t *ptmp;
     unsigned int i;
 
     table_ptr = hr_table + (vicii.raster.background_color << 4);
     char_ptr = vicii.chargen_ptr + vicii.raster.ycounter;
     msk_ptr = gfx_msk_ptr + GFX_MSK_LEFTBORDER_SIZE;
 
-    c[1] = c[0] = vicii.raster.background_color;
-    c[3] = c[2] = vicii.ext_background_color[0];
-    c[5] = c[4] = vicii.ext_background_color[1];
+    c[0] = MC_COLOR(vicii.raster.background_color);
+    c[1] = MC_COLOR(vicii.ext_background_color[0]);
+    c[2] = MC_COLOR(vicii.ext_background_color[1]);
 
-    ptmp = (uint16_t *)(p + xs * 8);
+    ptmp = (uint32_t *)(p + xs * 8);
 
     for (i = xs; i <= xe; i++) {
         unsigned int d = char_ptr[vicii.vbuf[i] * 8];
         uint8_t c3 = vicii.cbuf[i];
         if (c3 & 0x8) {
-            c[7] = c[6] = c3 & 0x7;
-            ptmp[0] = ((uint16_t *)c)[mc_table[d]];
-            ptmp[1] = ((uint16_t *)c)[mc_table[0x100 + d]];
-            ptmp[2] = ((uint16_t *)c)[mc_table[0x200 + d]];
-            ptmp[3] = ((uint16_t *)c)[d & 3];
-            ptmp += 4;
+            c[3] = MC_COLOR(c3 & 0x7);
+            ptmp[0] = MC_NIBBLE(c, d >> 4);
+            ptmp[1] = MC_NIBBLE(c, d & 0xf);
+            ptmp += 2;
             msk_ptr[i] = mcmsktable[d];
         } else {
             uint32_t *ptr = table_ptr + (c3 << 8);
-            *((uint32_t *)ptmp) = ptr[d >> 4];
-            *((uint32_t *)(ptmp + 2)) = ptr[d & 0xf];
-            ptmp += 4;
+            ptmp[0] = ptr[d >> 4];
+            ptmp[1] = ptr[d & 0xf];
+            ptmp += 2;
             msk_ptr[i] = d;
         }
     }
@@ -537,10 +546,10 @@ inline static void _draw_mc_text(uint8_t *p, unsigned int xs, unsigned int xe,
 
 inline static void _draw_mc_text_cached(uint8_t *p, unsigned int xs, unsigned int xe, raster_cache_t *cache)
 {
-    uint8_t c[8];
+    uint32_t c[4];
     uint32_t *table_ptr;
     uint8_t *foreground_data, *color_data_3, *msk_ptr;
-    uint16_t *ptmp;
+    uint32_t *ptmp;
     unsigned int i;
 
     foreground_data = cache->foreground_data;
@@ -548,28 +557,26 @@ inline static void _draw_mc_text_cached(uint8_t *p, unsigned int xs, unsigned in
     table_ptr = hr_table + (cache->background_data[0] << 4);
     msk_ptr = cache->gfx_msk + GFX_MSK_LEFTBORDER_SIZE;
 
-    c[1] = c[0] = cache->background_data[0];
-    c[3] = c[2] = cache->color_data_1[0];
-    c[5] = c[4] = cache->color_data_1[1];
+    c[0] = MC_COLOR(cache->background_data[0]);
+    c[1] = MC_COLOR(cache->color_data_1[0]);
+    c[2] = MC_COLOR(cache->color_data_1[1]);
 
-    ptmp = (uint16_t *)(p + xs * 8);
+    ptmp = (uint32_t *)(p + xs * 8);
 
     for (i = xs; i <= xe; i++) {
         unsigned int d = foreground_data[i];
         uint8_t c3 = color_data_3[i];
         if (c3 & 0x8) {
-            c[7] = c[6] = c3 & 0x7;
-            ptmp[0] = ((uint16_t *)c)[mc_table[d]];
-            ptmp[1] = ((uint16_t *)c)[mc_table[0x100 + d]];
-            ptmp[2] = ((uint16_t *)c)[mc_table[0x200 + d]];
-            ptmp[3] = ((uint16_t *)c)[d & 3];
-            ptmp += 4;
+            c[3] = MC_COLOR(c3 & 0x7);
+            ptmp[0] = MC_NIBBLE(c, d >> 4);
+            ptmp[1] = MC_NIBBLE(c, d & 0xf);
+            ptmp += 2;
             msk_ptr[i] = mcmsktable[d];
         } else {
             uint32_t *ptr = table_ptr + (c3 << 8);
-            *((uint32_t *)ptmp) = ptr[d >> 4];
-            *((uint32_t *)(ptmp + 2)) = ptr[d & 0xf];
-            ptmp += 4;
+            ptmp[0] = ptr[d >> 4];
+            ptmp[1] = ptr[d & 0xf];
+            ptmp += 2;
             msk_ptr[i] = d;
         }
     }
@@ -727,8 +734,9 @@ static int get_mc_bitmap(raster_cache_t *cache, unsigned int *xs,
 inline static void _draw_mc_bitmap(uint8_t *p, unsigned int xs, unsigned int xe,
                                    uint8_t *gfx_msk_ptr)
 {
-    uint8_t *colptr, *bmptr_low, *bmptr_high, *msk_ptr, *ptmp;
-    uint8_t c[4];
+    uint8_t *colptr, *bmptr_low, *bmptr_high, *msk_ptr;
+    uint32_t *ptmp;
+    uint32_t c[4];
     unsigned int i, j;
 
     colptr = vicii.cbuf;
@@ -736,9 +744,9 @@ inline static void _draw_mc_bitmap(uint8_t *p, unsigned int xs, unsigned int xe,
     bmptr_high = vicii.bitmap_high_ptr;
     msk_ptr = gfx_msk_ptr + GFX_MSK_LEFTBORDER_SIZE;
 
-    c[0] = vicii.raster.background_color;
+    c[0] = MC_COLOR(vicii.raster.background_color);
 
-    ptmp = p + xs * 8;
+    ptmp = (uint32_t *)(p + xs * 8);
 
     for (j = ((vicii.memptr + xs) << 3) + vicii.raster.ycounter,
          i = xs; i <= xe; i++, j += 8) {
@@ -752,15 +760,13 @@ inline static void _draw_mc_bitmap(uint8_t *p, unsigned int xs, unsigned int xe,
 
         msk_ptr[i] = mcmsktable[d];
 
-        c[1] = vicii.vbuf[i] >> 4;
-        c[2] = vicii.vbuf[i] & 0xf;
-        c[3] = colptr[i];
+        c[1] = MC_COLOR(vicii.vbuf[i] >> 4);
+        c[2] = MC_COLOR(vicii.vbuf[i] & 0xf);
+        c[3] = MC_COLOR(colptr[i]);
 
-        ptmp[1] = ptmp[0] = c[mc_table[d]];
-        ptmp[3] = ptmp[2] = c[mc_table[0x100 + d]];
-        ptmp[5] = ptmp[4] = c[mc_table[0x200 + d]];
-        ptmp[7] = ptmp[6] = c[d & 3];
-        ptmp += 8;
+        ptmp[0] = MC_NIBBLE(c, d >> 4);
+        ptmp[1] = MC_NIBBLE(c, d & 0xf);
+        ptmp += 2;
     }
 }
 
@@ -769,8 +775,9 @@ inline static void _draw_mc_bitmap_cached(uint8_t *p, unsigned int xs,
                                           raster_cache_t *cache)
 {
     uint8_t *foreground_data, *color_data_1, *color_data_3;
-    uint8_t *msk_ptr, *ptmp;
-    uint8_t c[4];
+    uint8_t *msk_ptr;
+    uint32_t *ptmp;
+    uint32_t c[4];
     unsigned int i;
 
     foreground_data = cache->foreground_data;
@@ -778,9 +785,9 @@ inline static void _draw_mc_bitmap_cached(uint8_t *p, unsigned int xs,
     color_data_3 = cache->color_data_3;
     msk_ptr = cache->gfx_msk + GFX_MSK_LEFTBORDER_SIZE;
 
-    c[0] = cache->background_data[0];
+    c[0] = MC_COLOR(cache->background_data[0]);
 
-    ptmp = p + xs * 8;
+    ptmp = (uint32_t *)(p + xs * 8);
 
     for (i = xs; i <= xe; i++) {
         unsigned int d;
@@ -789,15 +796,13 @@ inline static void _draw_mc_bitmap_cached(uint8_t *p, unsigned int xs,
 
         msk_ptr[i] = mcmsktable[d];
 
-        c[1] = color_data_1[i] >> 4;
-        c[2] = color_data_1[i] & 0xf;
-        c[3] = color_data_3[i];
+        c[1] = MC_COLOR(color_data_1[i] >> 4);
+        c[2] = MC_COLOR(color_data_1[i] & 0xf);
+        c[3] = MC_COLOR(color_data_3[i]);
 
-        ptmp[1] = ptmp[0] = c[mc_table[d]];
-        ptmp[3] = ptmp[2] = c[mc_table[0x100 + d]];
-        ptmp[5] = ptmp[4] = c[mc_table[0x200 + d]];
-        ptmp[7] = ptmp[6] = c[d & 3];
-        ptmp += 8;
+        ptmp[0] = MC_NIBBLE(c, d >> 4);
+        ptmp[1] = MC_NIBBLE(c, d & 0xf);
+        ptmp += 2;
     }
 }
 
@@ -1346,26 +1351,21 @@ inline static void _draw_idle(uint8_t *p, unsigned int xs, unsigned int xe,
         memset(msk_ptr + xs, d, xe + 1 - xs);
     } else {
         if (vicii.raster.video_mode == VICII_MULTICOLOR_BITMAP_MODE) {
-            /* FIXME: Could be optimized */
-            uint8_t *ptmp;
-            uint8_t c[4];
+            uint32_t c[4], c1, c2;
 
-            c[0] = vicii.raster.background_color;
+            c[0] = MC_COLOR(vicii.raster.background_color);
             c[1] = 0;
             c[2] = 0;
             c[3] = 0;
 
-            ptmp = p + xs * 8;
-
-            for (i = xs; i <= xe; i++) {
-                msk_ptr[i] = mcmsktable[d];
+            c1 = MC_NIBBLE(c, d >> 4);
+            c2 = MC_NIBBLE(c, d & 0xf);
 
-                ptmp[1] = ptmp[0] = c[mc_table[d]];
-                ptmp[3] = ptmp[2] = c[mc_table[0x100 + d]];
-                ptmp[5] = ptmp[4] = c[mc_table[0x200 + d]];
-                ptmp[7] = ptmp[6] = c[d & 3];
-                ptmp += 8;
+            for (i = xs * 8; i <= xe * 8; i += 8) {
+                *((uint32_t *)(p + i)) = c1;
+                *((uint32_t *)(p + i + 4)) = c2;
             }
+            memset(msk_ptr + xs, mcmsktable[d], xe + 1 - xs);
         } else {
             memset(p + xs * 8, 0, (xe + 1 - xs) * 8);
             if (vicii.raster.video_mode == VICII_ILLEGAL_BITMAP_MODE_2) {
@@ -1498,11 +1498,18 @@ static void init_drawing_tables(void)
     }
 
     for (i = 0; i <= 0xff; i++) {
-        mc_table[i] = (uint8_t)(i >> 6);
-        mc_table[i + 0x100] = (uint8_t)((i >> 4) & 0x3);
-        mc_table[i + 0x200] = (uint8_t)((i >> 2) & 0x3);
         mcmsktable[i] = (uint8_t)((i & 0xaa) | ((i & 0xaa) >> 1));
     }
+
+    p = (uint8_t *)mc_mask_table;
+
+    for (i = 0; i <= 0xf; i++) {
+        for (b = 0; b <= 3; b++) {
+            p[1] = p[0] = ((i >> 2) == b) ? 0xff : 0;
+            p[3] = p[2] = ((i & 3) == b) ? 0xff : 0;
+            p += 4;
+        }
+    }
 }
 
 void vicii_draw_init(void)
@@ -420,6 +420,9 @@ static void init_drawing_tables(void)
         for (__m = 1 << ((size) - 1), __p = 0;                   \
              __p < (size);                                       \
              __p++, __m >>= 1) {                                 \
+            if (!((msk) & (__m | (__m - 1)))) {                  \
+                break;                                           \
+            }                                                    \
             if ((msk) & __m) {                                   \
                 if ((gfxmsk) & __m) {                            \
                     DRAW(0, sprite_bit, imgptr, collmskptr, __p, \
@@ -448,6 +451,9 @@ static void init_drawing_tables(void)
              __p += 2, __m >>= 2, (mcmsk) <<= 2, (trmsk) <<= 2) {        \
             uint8_t __c, __t;                                               \
                                                                          \
+            if (!((mcmsk) & 0xffffff)) {                                 \
+                break;                                                   \
+            }                                                            \
             __c = (uint8_t)(((mcmsk) >> 22) & 0x3);                         \
             __t = (uint8_t)(((trmsk) >> 22) & 0x3);                         \
                                                                          \
@@ -495,11 +501,18 @@ static void init_drawing_tables(void)
             uint8_t __c;                                                 \
             uint8_t __t;                                                 \
                                                                       \
+            if (!((mcmsk) & 0xffffff)) {                              \
+                break;                                                \
+            }                                                         \
             __c = (uint8_t)(((mcmsk) >> 22) & 0x3);                      \
+            if (!__c) {                                               \
+                __m >>= 4;                                            \
+                continue;                                             \
+            }                                                         \
             __t = (uint8_t)(((trmsk) >> (size - 4)) & 0xf);              \
                                                                       \
             for (__i = 0; __i < 4; __i++, __m >>= 1, __t <<= 1) {     \
-                if (__c && (__t & 0x8)) {                             \
+                if (__t & 0x8) {                                      \
                     if ((gfxmsk) & __m) {                             \
                         DRAW(0, sprite_bit, imgptr, collmskptr,       \
                              __p + __i, pixel_table[__c],             \
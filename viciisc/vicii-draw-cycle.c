@@ -135,7 +135,7 @@ static const uint8_t colors[] = {
     COL_NONE, COL_NONE, COL_NONE, COL_NONE          /* ECM=1 BMM=1 MCM=1 */
 };
 
-static DRAW_INLINE void draw_graphics(int i)
+static DRAW_INLINE void draw_graphics(int i, int blank)
 {
     uint8_t px;
     uint8_t cc;
@@ -151,6 +151,16 @@ static DRAW_INLINE void draw_graphics(int i)
         gbuf_mc_flop = 1;
     }
 
+    /*
+     * nothing left to shift out and the pixel gets covered by the
+     * border anyway; only keep the sequencer state going.
+     */
+    if (blank) {
+        gbuf_mc_flop ^= 1;
+        pri_buffer[i] = 0;
+        return;
+    }
+
     /*
      * read pixels depending on video mode
      * mc pixels if MCM=1 and BMM=1, or MCM=1 and cbuf bit 3 = 1
@@ -221,39 +231,44 @@ static DRAW_INLINE void draw_graphics(int i)
 static DRAW_INLINE void draw_graphics8(unsigned int cycle_flags)
 {
     int vis_en;
+    int blank;
 
     vis_en = cycle_is_visible(cycle_flags);
 
+    /* the whole cycle is continuous border and the shifter is empty */
+    blank = border_state && vicii.main_border
+            && !(gbuf_reg | gbuf_pixel_reg | gbuf_pipe1_reg);
+
     /* render pixels */
     /* pixel 0 */
-    draw_graphics(0);
+    draw_graphics(0, blank);
     /* pixel 1 */
-    draw_graphics(1);
+    draw_graphics(1, blank);
     /* pixel 2 */
-    draw_graphics(2);
+    draw_graphics(2, blank);
     /* pixel 3 */
-    draw_graphics(3);
+    draw_graphics(3, blank);
     /* pixel 4 */
     vmode16_pipe = ( vicii.regs[0x16] & 0x10 ) >> 2;
     if (vicii.color_latency) {
         /* handle rising edge of internal signal */
         vmode11_pipe |= ( vicii.regs[0x11] & 0x60 ) >> 2;
     }
-    draw_graphics(4);
+    draw_graphics(4, blank);
     /* pixel 5 */
-    draw_graphics(5);
+    draw_graphics(5, blank);
     /* pixel 6 */
     if (vicii.color_latency) {
         /* handle falling edge of internal signal */
         vmode11_pipe &= ( vicii.regs[0x11] & 0x60 ) >> 2;
     }
-    draw_graphics(6);
+    draw_graphics(6, blank);
     /* pixel 7 */
     if (vmode16_pipe && !vmode16_pipe2) {
         gbuf_mc_flop = 0;
     }
     vmode16_pipe2 = vmode16_pipe;
-    draw_graphics(7);
+    draw_graphics(7, blank);
 
     if (!vicii.color_latency) {
         vmode11_pipe = ( vicii.regs[0x11] & 0x60 ) >> 2;
@@ -482,6 +497,27 @@ static DRAW_INLINE void draw_sprites8(unsigned int cycle_flags)
     if (cycle_is_sprite_dma1_dma2(cycle_flags)) {
         dma_cycle_2 = 1 << cycle_get_sprite_num(cycle_flags);
     }
+
+    /*
+     * fast path: no sprite is shifting out and none can be triggered
+     * during this cycle, so only the latches need to be updated.
+     */
+    if (!(sprite_pending_bits | sprite_active_bits) && !spr_en) {
+        sprite_halt_bits |= dma_cycle_0;
+        update_sprite_data(cycle_flags);
+        if (!vicii.color_latency) {
+            update_sprite_mc_bits_8565();
+        }
+        sprite_pri_bits = vicii.regs[0x1b];
+        sprite_expx_bits = vicii.regs[0x1d];
+        if (vicii.color_latency) {
+            update_sprite_mc_bits_6569();
+        }
+        sprite_halt_bits &= ~dma_cycle_2;
+        update_sprite_xpos();
+        return;
+    }
+
     candidate_bits = get_trigger_candidates(xpos);
 
     /* process and render sprites */
@@ -135,6 +135,21 @@ typedef struct video_chip_cap_s video_chip_cap_t;
 
 #define VIDEO_MAX_OUTPUT_WIDTH  2048
 
+/* settings a stage of the color tables was calculated with */
+typedef struct video_color_key_s {
+    const void *source;         /* internal palette of the video chip */
+    unsigned int serial;        /* external palette, 0 if none */
+    int video;
+    int saturation;
+    int contrast;
+    int brightness;
+    int gamma;
+    int tint;
+    int blur;
+    int oddlines_phase;
+    int filter;
+} video_color_key_t;
+
 struct video_render_color_tables_s {
     int updated;                /* tables here are up to date */
     uint32_t physical_colors[256];
@@ -155,6 +170,9 @@ struct video_render_color_tables_s {
     int32_t line_yuv_0[VIDEO_MAX_OUTPUT_WIDTH * 3];
     int16_t prevrgbline[VIDEO_MAX_OUTPUT_WIDTH * 3];
     uint8_t rgbscratchbuffer[VIDEO_MAX_OUTPUT_WIDTH * 4];
+
+    video_color_key_t ycbcr_key;     /* tables for even lines */
+    video_color_key_t ycbcr_odd_key; /* tables for odd lines */
 };
 typedef struct video_render_color_tables_s video_render_color_tables_t;
 
@@ -303,6 +321,7 @@ extern void video_color_palette_internal(struct video_canvas_s *canvas,
                                          struct video_cbm_palette_s *cbm_palette);
 extern int video_color_update_palette(struct video_canvas_s *canvas);
 extern void video_color_palette_free(struct palette_s *palette);
+extern void video_color_shutdown(void);
 
 /* FIXME: implement a central function that inits the renderer(s) */
 extern void video_render_1x2_init(void);
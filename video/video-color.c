@@ -37,7 +37,9 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>       /* needed for pow function */
+#include <sys/stat.h>
 
 #include "videoarch.h"
 
@@ -46,6 +48,8 @@
 #include "machine.h"
 #include "palette.h"
 #include "resources.h"
+#include "sysfile.h"
+#include "util.h"
 #include "viewport.h"
 #include "video-canvas.h"
 #include "video-color.h"
@@ -65,6 +69,36 @@ static uint32_t color_red[256];
 static uint32_t color_grn[256];
 static uint32_t color_blu[256];
 
+/* bumped whenever the raw rgb values above change */
+static unsigned int color_raw_serial = 1;
+
+/* settings the shared gamma tables were last calculated with */
+typedef struct gammatable_key_s {
+    unsigned int raw_serial;
+    int video;
+    int brightness;
+    int contrast;
+    int gamma;
+    int scanlineshade;
+} gammatable_key_t;
+
+static gammatable_key_t gammatable_key;
+
+/* Loaded external palettes, most recently used first, so that switching
+   between them does not read the palette files again.  An entry is only
+   used while the file keeps the modification time it was loaded with.  */
+#define PALETTE_CACHE_SIZE 4
+
+typedef struct palette_cache_entry_s {
+    char *name;
+    palette_t *palette;
+    time_t mtime;
+    unsigned int serial;
+} palette_cache_entry_t;
+
+static palette_cache_entry_t palette_cache[PALETTE_CACHE_SIZE];
+static unsigned int palette_cache_serial = 0;
+
 #define RMIN(x,min) (((x) < (min)) ? (min) : (x))
 #define RMAX(x,max) (((x) > (max)) ? (max) : (x))
 #define RMINMAX(x,min,max) RMIN(RMAX(x,max),min)
@@ -84,6 +118,9 @@ typedef struct video_ycbcr_palette_s {
 
 void video_render_setrawrgb(unsigned int index, uint32_t r, uint32_t g, uint32_t b)
 {
+    if (color_red[index] != r || color_grn[index] != g || color_blu[index] != b) {
+        color_raw_serial++;
+    }
     color_red[index] = r;
     color_grn[index] = g;
     color_blu[index] = b;
@@ -499,6 +536,21 @@ static void video_calc_gammatable(video_resources_t *video_resources, int video)
     float bri, con, gam, scn, v;
     double factor;
     uint32_t vi;
+    gammatable_key_t key;
+
+    /* the tables are shared by all canvases; only recalculate them when
+       something they depend on changed */
+    memset(&key, 0, sizeof(key));
+    key.raw_serial = color_raw_serial;
+    key.video = video;
+    key.brightness = video_resources->color_brightness;
+    key.contrast = video_resources->color_contrast;
+    key.gamma = video_resources->color_gamma;
+    key.scanlineshade = video_resources->pal_scanlineshade;
+    if (memcmp(&key, &gammatable_key, sizeof(key)) == 0) {
+        return;
+    }
+    gammatable_key = key;
 
     bri = ((float)(video_resources->color_brightness - 1000))
           * (128.0f / 1000.0f);
@@ -825,32 +877,118 @@ static palette_t *video_calc_palette(struct video_canvas_s *canvas, const video_
     return prgb;
 }
 
-/* Load RGB palette.  */
+/* Modification time of a palette file, or 0 if there is no such file.  */
+static time_t video_palette_mtime(const char *name)
+{
+    struct stat st;
+    char *complete_path = NULL;
+    char *tmp;
+    time_t mtime = 0;
+
+    if (sysfile_locate(name, &complete_path) < 0) {
+        tmp = lib_stralloc(name);
+        util_add_extension(&tmp, "vpl");
+        if (sysfile_locate(tmp, &complete_path) < 0) {
+            complete_path = NULL;
+        }
+        lib_free(tmp);
+    }
+
+    if (complete_path != NULL) {
+        if (stat(complete_path, &st) == 0) {
+            mtime = st.st_mtime;
+        }
+        lib_free(complete_path);
+    }
+
+    return mtime;
+}
+
+/* Load RGB palette, or take it from the cache of loaded palettes. The
+   caller owns the returned copy; `serial_return' identifies its contents. */
 static palette_t *video_load_palette(const video_cbm_palette_t *p,
-                                     const char *name)
+                                     const char *name,
+                                     unsigned int *serial_return)
 {
     palette_t *palette;
+    palette_cache_entry_t entry;
+    time_t mtime;
+    int i;
 
-    palette = palette_create(p->num_entries, NULL);
+    mtime = video_palette_mtime(name);
 
-    if (palette == NULL) {
-        return NULL;
+    for (i = 0; i < PALETTE_CACHE_SIZE; i++) {
+        if (palette_cache[i].name != NULL
+            && palette_cache[i].palette->num_entries == p->num_entries
+            && palette_cache[i].mtime == mtime
+            && strcmp(palette_cache[i].name, name) == 0) {
+            break;
+        }
+    }
+
+    if (i < PALETTE_CACHE_SIZE) {
+        entry = palette_cache[i];
+    } else {
+        entry.palette = palette_create(p->num_entries, NULL);
+
+        if (entry.palette == NULL) {
+            return NULL;
+        }
+
+        if (!video_disabled_mode && palette_load(name, entry.palette) < 0) {
+            /* log_message(vicii.log, "Cannot load palette file `%s'.", name); */
+            palette_free(entry.palette);
+            return NULL;
+        }
+
+        entry.name = lib_stralloc(name);
+        entry.mtime = mtime;
+        entry.serial = ++palette_cache_serial;
+
+        /* drop the least recently used palette */
+        i = PALETTE_CACHE_SIZE - 1;
+        if (palette_cache[i].name != NULL) {
+            lib_free(palette_cache[i].name);
+            palette_free(palette_cache[i].palette);
+        }
     }
 
-    if (!video_disabled_mode && palette_load(name, palette) < 0) {
-        /* log_message(vicii.log, "Cannot load palette file `%s'.", name); */
+    /* move to front */
+    memmove(&palette_cache[1], &palette_cache[0], i * sizeof(palette_cache_entry_t));
+    palette_cache[0] = entry;
+
+    palette = palette_create(p->num_entries, NULL);
+    if (palette == NULL) {
         return NULL;
     }
+    palette_copy(palette, entry.palette);
 
+    *serial_return = entry.serial;
     return palette;
 }
 
+void video_color_shutdown(void)
+{
+    int i;
+
+    for (i = 0; i < PALETTE_CACHE_SIZE; i++) {
+        if (palette_cache[i].name != NULL) {
+            lib_free(palette_cache[i].name);
+            palette_free(palette_cache[i].palette);
+        }
+    }
+    memset(palette_cache, 0, sizeof(palette_cache));
+}
+
 /* Calculate or load a palette, depending on configuration.  */
 int video_color_update_palette(struct video_canvas_s *canvas)
 {
     palette_t *palette;
     video_ycbcr_palette_t *ycbcr;
     video_resources_t *video_resources;
+    video_render_color_tables_t *color_tables;
+    video_color_key_t key, odd_key;
+    unsigned int serial = 0;
     int video;
 
     DBG(("video_color_update_palette canvas: %p", canvas));
@@ -871,6 +1009,7 @@ int video_color_update_palette(struct video_canvas_s *canvas)
     /*resources_get_int("MachineVideoStandard", &video);*/
     video = canvas->viewport->crt_type;
     video_resources = &(canvas->videoconfig->video_resources);
+    color_tables = &canvas->videoconfig->color_tables;
 
 #if 0
     /* setup the palette params so we get 100% the same as in peptos calculations */
@@ -890,32 +1029,72 @@ int video_color_update_palette(struct video_canvas_s *canvas)
 
     if (canvas->videoconfig->external_palette) {
         palette = video_load_palette(canvas->videoconfig->cbm_palette,
-                                     canvas->videoconfig->external_palette_name);
+                                     canvas->videoconfig->external_palette_name,
+                                     &serial);
 
         if (!palette) {
             return -1;
         }
+    }
+
+    /* Each stage of the renderer tables is only recalculated when one of
+       the settings it depends on changed.  */
+    memset(&key, 0, sizeof(key));
+    key.source = canvas->videoconfig->cbm_palette;
+    key.serial = serial;
+    key.video = video;
+    key.saturation = video_resources->color_saturation;
+    key.tint = video_resources->color_tint;
+    odd_key = key;
+
+    key.contrast = video_resources->color_contrast;
+    key.brightness = video_resources->color_brightness;
+    key.gamma = video_resources->color_gamma;
+    key.blur = video_resources->pal_blur;
+
+    odd_key.oddlines_phase = video_resources->pal_oddlines_phase;
+    odd_key.filter = canvas->videoconfig->filter;
+    if (serial && odd_key.filter == VIDEO_FILTER_CRT) {
+        /* odd lines are derived from the adjusted palette */
+        odd_key.contrast = key.contrast;
+        odd_key.brightness = key.brightness;
+        odd_key.gamma = key.gamma;
+    }
 
-        video_calc_gammatable(video_resources, video);
+    video_calc_gammatable(video_resources, video);
+
+    if (canvas->videoconfig->external_palette) {
         ycbcr = video_ycbcr_palette_create(palette->num_entries);
         video_palette_to_ycbcr(palette, ycbcr, video);
-        video_calc_ycbcrtable(video_resources, ycbcr, &canvas->videoconfig->color_tables, video);
+        if (memcmp(&key, &color_tables->ycbcr_key, sizeof(key)) != 0) {
+            video_calc_ycbcrtable(video_resources, ycbcr, color_tables, video);
+            color_tables->ycbcr_key = key;
+        }
         if (canvas->videoconfig->filter == VIDEO_FILTER_CRT) {
             palette_free(palette);
             palette = video_calc_palette(canvas, ycbcr, video);
         }
         /* additional table for odd lines */
-        video_palette_to_ycbcr_oddlines(palette, ycbcr, video);
-        video_calc_ycbcrtable_oddlines(video_resources, ycbcr, &canvas->videoconfig->color_tables, video);
+        if (palette != NULL
+            && memcmp(&odd_key, &color_tables->ycbcr_odd_key, sizeof(odd_key)) != 0) {
+            video_palette_to_ycbcr_oddlines(palette, ycbcr, video);
+            video_calc_ycbcrtable_oddlines(video_resources, ycbcr, color_tables, video);
+            color_tables->ycbcr_odd_key = odd_key;
+        }
     } else {
-        video_calc_gammatable(video_resources, video);
         ycbcr = video_ycbcr_palette_create(canvas->videoconfig->cbm_palette->num_entries);
         video_cbm_palette_to_ycbcr(canvas->videoconfig->cbm_palette, ycbcr, video);
-        video_calc_ycbcrtable(video_resources, ycbcr, &canvas->videoconfig->color_tables, video);
+        if (memcmp(&key, &color_tables->ycbcr_key, sizeof(key)) != 0) {
+            video_calc_ycbcrtable(video_resources, ycbcr, color_tables, video);
+            color_tables->ycbcr_key = key;
+        }
         palette = video_calc_palette(canvas, ycbcr, video);
         /* additional table for odd lines */
-        video_cbm_palette_to_ycbcr_oddlines(video_resources, canvas->videoconfig->cbm_palette, ycbcr, video);
-        video_calc_ycbcrtable_oddlines(video_resources, ycbcr, &canvas->videoconfig->color_tables, video);
+        if (memcmp(&odd_key, &color_tables->ycbcr_odd_key, sizeof(odd_key)) != 0) {
+            video_cbm_palette_to_ycbcr_oddlines(video_resources, canvas->videoconfig->cbm_palette, ycbcr, video);
+            video_calc_ycbcrtable_oddlines(video_resources, ycbcr, color_tables, video);
+            color_tables->ycbcr_odd_key = odd_key;
+        }
     }
 
     video_ycbcr_palette_free(ycbcr);
@@ -85,6 +85,7 @@ int video_resources_init(void)
 
 void video_resources_shutdown(void)
 {
+    video_color_shutdown();
     video_arch_resources_shutdown();
 }
 
@@ -66,6 +66,7 @@ int vsync_frame_counter;
 #include "monitor_network.h"
 #endif
 #include "network.h"
+#include "profile.h"
 #include "resources.h"
 #include "sound.h"
 #include "translate.h"
@@ -73,6 +74,10 @@ int vsync_frame_counter;
 #include "vsync.h"
 #include "vsyncapi.h"
 
+#ifdef PSP
+extern int ExitPSP;
+#endif
+
 /* ------------------------------------------------------------------------- */
 
 static int set_timer_speed(int speed);
@@ -86,6 +91,10 @@ static int refresh_rate;
 /* "Warp mode".  If nonzero, attempt to run as fast as possible. */
 static int warp_mode_enabled;
 
+/* Benchmark mode.  If nonzero, run this many frames in warp mode, report
+   the achieved speed and quit. */
+static int benchmark_frames;
+
 
 static int set_relative_speed(int val, void *param)
 {
@@ -117,6 +126,17 @@ static int set_warp_mode(int val, void *param)
     return 0;
 }
 
+static int set_benchmark_frames(int val, void *param)
+{
+    if (val < 0) {
+        return -1;
+    }
+
+    benchmark_frames = val;
+
+    return 0;
+}
+
 
 /* Vsync-related resources. */
 static const resource_int_t resources_int[] = {
@@ -127,6 +147,8 @@ static const resource_int_t resources_int[] = {
     { "WarpMode", 0, RES_EVENT_STRICT, (resource_value_t)0,
       /* FIXME: maybe RES_EVENT_NO */
       &warp_mode_enabled, set_warp_mode, NULL },
+    { "BenchmarkFrames", 0, RES_EVENT_NO, NULL,
+      &benchmark_frames, set_benchmark_frames, NULL },
     RESOURCE_INT_LIST_END
 };
 
@@ -174,6 +196,11 @@ static const cmdline_option_t cmdline_options[] = {
       USE_PARAM_STRING, USE_DESCRIPTION_ID,
       IDCLS_UNUSED, IDCLS_DISABLE_WARP_MODE,
       NULL, NULL },
+    { "-benchframes", SET_RESOURCE, 1,
+      NULL, NULL, "BenchmarkFrames", NULL,
+      USE_PARAM_STRING, USE_DESCRIPTION_STRING,
+      IDCLS_UNUSED, IDCLS_UNUSED,
+      N_("<frames>"), N_("Run the given number of frames in warp mode, report the speed and quit") },
     CMDLINE_LIST_END
 };
 
@@ -221,6 +248,11 @@ static long cycles_per_sec;
 /* Function to call at the end of every screen frame. */
 static void (*vsync_hook)(void);
 
+/* Function deciding whether a frame is a speculative run-ahead frame. Such
+   frames are thrown away afterwards, so they get no sync, sound or speed
+   handling; the hook sets whether the next frame is to be skipped. */
+static int (*run_ahead_hook)(int *skip_next_frame);
+
 /* ------------------------------------------------------------------------- */
 
 /* static guarantees zero values. */
@@ -278,9 +310,62 @@ static void display_speed(int num_frames)
     speed_eval_prev_clk = maincpu_clk;
 }
 
+/* Benchmark state, see `benchmark_frames'. */
+static int benchmark_count = -1;
+static unsigned long benchmark_start;
+static CLOCK benchmark_start_clk;
+
+/* Called once per frame while benchmark mode is active.  The first frame
+   switches to warp mode and starts the clock; once `benchmark_frames'
+   frames have passed, the results are logged and the emulator quits. */
+static void benchmark_frame(void)
+{
+    unsigned long elapsed;
+    CLOCK diff_clk;
+    double diff_sec;
+
+    if (benchmark_count < 0) {
+        resources_set_int("WarpMode", 1);
+        benchmark_start = vsyncarch_gettime();
+        benchmark_start_clk = maincpu_clk;
+        benchmark_count = 0;
+        return;
+    }
+
+    if (benchmark_count >= benchmark_frames) {
+        /* Results already reported, waiting for the main loop to stop. */
+        return;
+    }
+
+    if (++benchmark_count < benchmark_frames) {
+        return;
+    }
+
+    elapsed = vsyncarch_gettime() - benchmark_start;
+    diff_clk = maincpu_clk - benchmark_start_clk;
+    diff_sec = (double)elapsed / vsyncarch_freq;
+    if (diff_sec <= 0.0) {
+        diff_sec = 1.0 / vsyncarch_freq;
+    }
+
+    log_message(LOG_DEFAULT, "Benchmark: %d frames, %u cycles in %.3f seconds.",
+                benchmark_count, (unsigned int)diff_clk, diff_sec);
+    log_message(LOG_DEFAULT, "Benchmark: %.2f frames/sec, %.0f cycles/sec, %.1f%% of real speed.",
+                benchmark_count / diff_sec, diff_clk / diff_sec,
+                100.0 * diff_clk / (cycles_per_sec * diff_sec));
+
+#ifdef PSP
+    /* Leave the main loop, so that main() shuts everything down. */
+    ExitPSP = 1;
+#else
+    exit(EXIT_SUCCESS);
+#endif
+}
+
 static void clk_overflow_callback(CLOCK amount, void *data)
 {
     speed_eval_prev_clk -= amount;
+    benchmark_start_clk -= amount;
 }
 
 /* ------------------------------------------------------------------------- */
@@ -309,6 +394,11 @@ void vsync_init(void (*hook)(void))
     /* log_message(LOG_DEFAULT, "VSYNC Init freq: %u", (unsigned int)vsyncarch_freq); */
 }
 
+void vsync_set_run_ahead_hook(int (*hook)(int *skip_next_frame))
+{
+    run_ahead_hook = hook;
+}
+
 /* FIXME: This function is not needed here anymore, however it is
    called from sound.c and can only be removed if all other ports are
    changed to use similar vsync code. */
@@ -376,8 +466,14 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
     monitor_check_remote();
 #endif
 
+    if (run_ahead_hook != NULL && run_ahead_hook(&skip_next_frame)) {
+        return skip_next_frame;
+    }
+
     vsync_frame_counter++;
 
+    profile_frame();
+
     /*
      * process everything wich should be done before the synchronisation
      * e.g. OS/2: exit the programm if trigger_shutdown set
@@ -391,6 +487,10 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
 
     vsync_hook();
 
+    if (benchmark_frames > 0) {
+        benchmark_frame();
+    }
+
     if (network_connected()) {
         network_hook_time = vsyncarch_gettime() - network_hook_time;
 